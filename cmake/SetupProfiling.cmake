@@ -27,6 +27,20 @@ if (ENABLE_PROFILING)
     )
 endif()
 
+option(SPECTRE_TRACE_ACTIONS
+  "Record the wall time of every iterable action executed by the parallel \
+components and write it to a Chrome trace file on each node at exit"
+  OFF)
+
+if (SPECTRE_TRACE_ACTIONS)
+  set_property(
+    TARGET Profiling::EnableProfiling
+    APPEND PROPERTY
+    INTERFACE_COMPILE_DEFINITIONS
+    $<$<COMPILE_LANGUAGE:CXX>:SPECTRE_TRACE_ACTIONS>
+    )
+endif()
+
 target_link_libraries(
   SpectreFlags
   INTERFACE
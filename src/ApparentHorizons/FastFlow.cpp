@@ -6,7 +6,10 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <limits>
+#include <optional>
 #include <pup.h>
+#include <pup_stl.h>
 #include <string>
 #include <utility>
 
@@ -19,6 +22,7 @@
 #include "NumericalAlgorithms/SphericalHarmonics/Strahlkorper.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Tags.hpp"
 #include "Options/ParseOptions.hpp"
+#include "Parallel/PupStlCpp17.hpp"
 #include "PointwiseFunctions/GeneralRelativity/IndexManipulation.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/EqualWithinRoundoff.hpp"
@@ -35,7 +39,8 @@ FastFlow::FastFlow(FastFlow::Flow::type flow, FastFlow::Alpha::type alpha,
                    FastFlow::TruncationTol::type trunc_tol,
                    FastFlow::DivergenceTol::type divergence_tol,
                    FastFlow::DivergenceIter::type divergence_iter,
-                   FastFlow::MaxIts::type max_its)
+                   FastFlow::MaxIts::type max_its,
+                   std::optional<size_t> coarse_l_max)
     : alpha_(alpha),
       beta_(beta),
       abs_tol_(abs_tol),
@@ -47,7 +52,8 @@ FastFlow::FastFlow(FastFlow::Flow::type flow, FastFlow::Alpha::type alpha,
       current_iter_(0),
       previous_residual_mesh_norm_(0.0),
       min_residual_mesh_norm_(std::numeric_limits<double>::max()),
-      iter_at_min_residual_mesh_norm_(0) {}
+      iter_at_min_residual_mesh_norm_(0),
+      coarse_l_max_(coarse_l_max) {}
 
 template <typename Frame>
 size_t FastFlow::current_l_mesh(const Strahlkorper<Frame>& strahlkorper) const {
@@ -215,9 +221,16 @@ FastFlow::iterate_horizon_finder(
   // residual_mesh_norm-previous_residual_mesh_norm_ is small on the
   // first step, since previous_residual_mesh_norm_ is not defined, so
   // we skip this part of the check on the first iteration.
+  //
+  // When iterating on the coarse surface, convergence means that we
+  // continue iterating on the full-resolution surface instead.
+  bool has_converged_on_coarse_surface = false;
   if (residual_ylm_norm < abs_tol_) {
-    // clang-tidy: std::move of trivially-copyable type
-    return std::make_pair(Status::AbsTol, std::move(iter_info));  // NOLINT
+    if (not fine_resolution_.has_value()) {
+      // clang-tidy: std::move of trivially-copyable type
+      return std::make_pair(Status::AbsTol, std::move(iter_info));  // NOLINT
+    }
+    has_converged_on_coarse_surface = true;
   } else if (residual_ylm_norm < trunc_tol_ * residual_mesh_norm) {
     // This may be convergence by TruncationTol, but first make sure
     // that either residual_mesh_norm is converging, or that it is the
@@ -226,14 +239,18 @@ FastFlow::iterate_horizon_finder(
     if (previous_residual_mesh_norm_ == 0 or
         equal_within_roundoff(residual_mesh_norm, previous_residual_mesh_norm_,
                               divergence_tol_ - 1.0, 0.0)) {
-      // clang-tidy: std::move of trivially-copyable type
-      return std::make_pair(Status::TruncationTol,
-                            std::move(iter_info));  // NOLINT
+      if (not fine_resolution_.has_value()) {
+        // clang-tidy: std::move of trivially-copyable type
+        return std::make_pair(Status::TruncationTol,
+                              std::move(iter_info));  // NOLINT
+      }
+      has_converged_on_coarse_surface = true;
     }
   }
 
   // Treat the case in which residual_mesh_norm is increasing
-  if (residual_mesh_norm > divergence_tol_ * min_residual_mesh_norm_ and
+  if (not has_converged_on_coarse_surface and
+      residual_mesh_norm > divergence_tol_ * min_residual_mesh_norm_ and
       iter_at_min_residual_mesh_norm_ <= current_iter_ - divergence_iter_) {
     // clang-tidy: std::move of trivially-copyable type
     return std::make_pair(Status::DivergenceError,
@@ -248,6 +265,28 @@ FastFlow::iterate_horizon_finder(
   // We have succeeded in an iteration.  So return the next guess.
   ++current_iter_;
 
+  // The residual norms on surfaces of different resolution are not
+  // comparable, so we restart the convergence and divergence monitoring
+  // whenever we change the resolution of the surface.
+  const auto restart_residual_monitoring = [this]() {
+    previous_residual_mesh_norm_ = 0.0;
+    min_residual_mesh_norm_ = std::numeric_limits<double>::max();
+    iter_at_min_residual_mesh_norm_ = current_iter_;
+  };
+
+  if (has_converged_on_coarse_surface) {
+    // Promote the surface to full resolution. The next iteration is evaluated
+    // on the points of the full-resolution surface.
+    *current_strahlkorper = Strahlkorper<Frame>(
+        fine_resolution_->first, fine_resolution_->second,
+        *current_strahlkorper);
+    fine_resolution_.reset();
+    restart_residual_monitoring();
+    // clang-tidy: std::move of trivially-copyable type
+    return std::make_pair(Status::SuccessfulIteration,
+                          std::move(iter_info));  // NOLINT
+  }
+
   // Construct new coefs.  Parameters flow_A and flow_B are from
   // Gundlach, PRD 57, 863 (1998), eq. 44.
   const double flow_A = alpha_ / (l_surface * (l_surface + 1)) + beta_;
@@ -266,6 +305,20 @@ FastFlow::iterate_horizon_finder(
   // Set up for next iter
   previous_residual_mesh_norm_ = residual_mesh_norm;
 
+  // The first iteration of a horizon find is evaluated at full resolution
+  // because the points for it have already been interpolated to. For the
+  // subsequent iterations we restrict the surface to the coarse resolution,
+  // if requested.
+  if (current_iter_ == 1 and coarse_l_max_.has_value() and
+      l_surface > *coarse_l_max_) {
+    fine_resolution_ =
+        std::make_pair(l_surface, current_strahlkorper->m_max());
+    *current_strahlkorper = Strahlkorper<Frame>(
+        *coarse_l_max_, std::min(*coarse_l_max_, fine_resolution_->second),
+        *current_strahlkorper);
+    restart_residual_monitoring();
+  }
+
   // clang-tidy: std::move of trivially-copyable type
   return std::make_pair(Status::SuccessfulIteration,
                         std::move(iter_info));  // NOLINT
@@ -300,6 +353,8 @@ void FastFlow::pup(PUP::er& p) {
   p | previous_residual_mesh_norm_;
   p | min_residual_mesh_norm_;
   p | iter_at_min_residual_mesh_norm_;
+  p | coarse_l_max_;
+  p | fine_resolution_;
 }
 
 std::ostream& operator<<(std::ostream& os, const FastFlow::Status& status) {
@@ -336,7 +391,9 @@ bool operator==(const FastFlow& lhs, const FastFlow& rhs) {
              rhs.previous_residual_mesh_norm_ and
          lhs.min_residual_mesh_norm_ == rhs.min_residual_mesh_norm_ and
          lhs.iter_at_min_residual_mesh_norm_ ==
-             rhs.iter_at_min_residual_mesh_norm_;
+             rhs.iter_at_min_residual_mesh_norm_ and
+         lhs.coarse_l_max_ == rhs.coarse_l_max_ and
+         lhs.fine_resolution_ == rhs.fine_resolution_;
 }
 
 template <>
@@ -5,10 +5,12 @@
 
 #include <cstddef>
 #include <limits>
+#include <optional>
 #include <ostream>
 #include <utility>
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Options/Auto.hpp"
 #include "Options/Options.hpp"
 #include "Utilities/ForceInline.hpp"
 #include "Utilities/TMPL.hpp"
@@ -116,8 +118,16 @@ class FastFlow {
     static type suggested_value() { return 100; }
   };
 
+  struct CoarseLMax {
+    using type = Options::Auto<size_t, Options::AutoLabel::None>;
+    static constexpr Options::String help = {
+        "Iterate on a surface of this l_max until convergence before iterating "
+        "at the full l_max of the surface, or 'None' to always iterate at the "
+        "full l_max."};
+  };
+
   using options = tmpl::list<Flow, Alpha, Beta, AbsTol, TruncationTol,
-                             DivergenceTol, DivergenceIter, MaxIts>;
+                             DivergenceTol, DivergenceIter, MaxIts, CoarseLMax>;
 
   static constexpr Options::String help{
       "Find a Strahlkorper using a 'fast flow' method.\n"
@@ -138,12 +148,18 @@ class FastFlow {
       "If instead |R_{mesh}|_i > DivergenceTol * min_{j}(|R_{mesh}|_j) where\n"
       "i is the iteration index and j runs from 0 to i-DivergenceIter, then\n"
       "FastFlow exits with Status::DivergenceError.  Here DivergenceIter and\n"
-      "DivergenceTol are input parameters."};
+      "DivergenceTol are input parameters.\n\n"
+      "If CoarseLMax is smaller than l_surface, then all iterations after the\n"
+      "first one are done on a surface restricted to l=CoarseLMax, which\n"
+      "needs far fewer interpolation points. Once these iterations converge,\n"
+      "the surface is prolonged to l_surface and iterated until it converges\n"
+      "at full resolution."};
 
   FastFlow(Flow::type flow, Alpha::type alpha, Beta::type beta,
            AbsTol::type abs_tol, TruncationTol::type trunc_tol,
            DivergenceTol::type divergence_tol,
-           DivergenceIter::type divergence_iter, MaxIts::type max_its);
+           DivergenceIter::type divergence_iter, MaxIts::type max_its,
+           std::optional<size_t> coarse_l_max = std::nullopt);
 
   FastFlow() : FastFlow(FlowType::Fast, 1.0, 0.5, 1.e-12, 1.e-2, 1.2, 5, 100) {}
 
@@ -161,6 +177,14 @@ class FastFlow {
   /// modified and `current_iteration()` is incremented.  Otherwise, we
   /// end with success or failure, and neither `current_strahlkorper`
   /// nor `current_iteration()` is changed.
+  ///
+  /// If a `CoarseLMax` is set, the `current_strahlkorper` is restricted to
+  /// that resolution after the first iteration, and prolonged back to its
+  /// original resolution once the coarse iterations have converged. The
+  /// resolution of the `current_strahlkorper` therefore changes between
+  /// iterations, and the next iteration must be evaluated on the points of
+  /// the modified `current_strahlkorper` (see `current_l_mesh`). The
+  /// surface always has its original resolution when the finder terminates.
   template <typename Frame>
   std::pair<Status, IterInfo> iterate_horizon_finder(
       gsl::not_null<Strahlkorper<Frame>*> current_strahlkorper,
@@ -170,6 +194,12 @@ class FastFlow {
 
   size_t current_iteration() const { return current_iter_; }
 
+  /// Whether the finder currently iterates on a surface restricted to the
+  /// `CoarseLMax`.
+  bool iterating_on_coarse_surface() const {
+    return fine_resolution_.has_value();
+  }
+
   /// Given a Strahlkorper defined up to some maximum Y_lm l called
   /// l_surface, returns a larger value of l, l_mesh, that is used for
   /// evaluating convergence.
@@ -182,6 +212,7 @@ class FastFlow {
     previous_residual_mesh_norm_ = 0.0;
     min_residual_mesh_norm_ = std::numeric_limits<double>::max();
     iter_at_min_residual_mesh_norm_ = 0;
+    fine_resolution_.reset();
   }
 
  private:
@@ -192,6 +223,10 @@ class FastFlow {
   size_t current_iter_;
   double previous_residual_mesh_norm_, min_residual_mesh_norm_;
   size_t iter_at_min_residual_mesh_norm_;
+  std::optional<size_t> coarse_l_max_;
+  // Holds the full l_max and m_max of the surface while iterating on the
+  // coarse surface
+  std::optional<std::pair<size_t, size_t>> fine_resolution_{};
 };
 
 SPECTRE_ALWAYS_INLINE bool converged(const FastFlow::Status& status) {
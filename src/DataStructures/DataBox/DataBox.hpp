@@ -15,6 +15,7 @@
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/DataBox/Item.hpp"
@@ -246,6 +247,15 @@ class DataBox<tmpl::list<Tags...>> : private detail::Item<Tags>... {
   /// Print the items
   std::string print_items() const;
 
+  /// \brief The name and the size in bytes of each item that is serialized
+  /// with the DataBox
+  ///
+  /// \details The sizes are computed with a `PUP::sizer`, so they add up to
+  /// the size of the serialized DataBox. Subitems are not listed separately
+  /// because they are part of their parent item. Compute items that have not
+  /// been evaluated only contribute the flag that marks them as unevaluated.
+  std::vector<std::pair<std::string, size_t>> size_of_items() const;
+
   /// Retrieve the tag `Tag`, should be called by the free function db::get
   template <typename Tag>
   const auto& get() const;
@@ -419,6 +429,27 @@ std::string DataBox<tmpl::list<Tags...>>::print_items() const {
   return os.str();
 }
 
+template <typename... Tags>
+std::vector<std::pair<std::string, size_t>>
+DataBox<tmpl::list<Tags...>>::size_of_items() const {
+  using mutable_item_creation_tags =
+      tmpl::list_difference<mutable_item_tags, mutable_subitem_tags>;
+  std::vector<std::pair<std::string, size_t>> result{};
+  result.reserve(tmpl::size<mutable_item_creation_tags>::value +
+                 tmpl::size<immutable_item_creation_tags>::value);
+  const auto size_of_item = [this, &result](auto tag_v) {
+    (void)this;
+    using tag = tmpl::type_from<decltype(tag_v)>;
+    PUP::sizer sizer{};
+    // The items are only read by the sizer
+    const_cast<detail::Item<tag>&>(get_item<tag>()).pup(sizer);  // NOLINT
+    result.emplace_back(db::tag_name<tag>(), sizer.size());
+  };
+  tmpl::for_each<mutable_item_creation_tags>(size_of_item);
+  tmpl::for_each<immutable_item_creation_tags>(size_of_item);
+  return result;
+}
+
 namespace detail {
 // This function exists so that the user can look at the template
 // arguments to find out what triggered the static_assert.
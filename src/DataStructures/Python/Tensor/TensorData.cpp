@@ -1,10 +1,13 @@
 // Distributed under the MIT License.
 // See LICENSE.txt for details.
 
+#include <pybind11/numpy.h>
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <string>
+#include <type_traits>
+#include <variant>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
@@ -23,6 +26,44 @@ void bind_tensordata(py::module& m) {  // NOLINT
            py::arg("data"))
       .def_readwrite("name", &TensorComponent::name)
       .def_readwrite("data", &TensorComponent::data)
+      // Expose the data to NumPy without copying it. The returned array keeps
+      // the TensorComponent alive and is read-only so that it can't be
+      // modified behind the back of the C++ object. A writable copy is made
+      // when `copy=True` is passed or when the data must be converted to the
+      // requested `dtype`.
+      .def(
+          "__array__",
+          [](const py::object& self, const py::object& dtype,
+             const py::object& copy) -> py::array {
+            const auto& component = self.cast<const TensorComponent&>();
+            py::array array = std::visit(
+                [&self](const auto& data) {
+                  using ValueType = std::decay_t<decltype(data[0])>;
+                  py::array view{py::dtype::of<ValueType>(),
+                                 {data.size()},
+                                 {sizeof(ValueType)},
+                                 data.data(),
+                                 self};
+                  view.attr("flags").attr("writeable") = false;
+                  return view;
+                },
+                component.data);
+            const py::dtype target_dtype =
+                dtype.is_none() ? array.dtype() : py::dtype::from_args(dtype);
+            const bool needs_conversion = not target_dtype.equal(array.dtype());
+            if (copy.is_none() ? needs_conversion : copy.cast<bool>()) {
+              return array.attr("astype")(target_dtype);
+            }
+            if (needs_conversion) {
+              throw py::value_error(
+                  "Can't convert the data of tensor component '" +
+                  component.name + "' to " +
+                  py::str(target_dtype).cast<std::string>() +
+                  " without a copy.");
+            }
+            return array;
+          },
+          py::arg("dtype") = py::none(), py::arg("copy") = py::none())
       .def("__str__", get_output<TensorComponent>)
       .def("__repr__", get_output<TensorComponent>)
       // NOLINTNEXTLINE(misc-redundant-expression)
@@ -6,10 +6,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <blaze/math/Subvector.h>
 #include <cstddef>
+#include <iterator>
 #include <type_traits>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Expressions/IndexPropertyCheck.hpp"
 #include "DataStructures/Tensor/Expressions/LhsTensorSymmAndIndices.hpp"
 #include "DataStructures/Tensor/Expressions/TensorExpression.hpp"
@@ -18,6 +22,7 @@
 #include "DataStructures/Tensor/Expressions/TimeIndex.hpp"
 #include "DataStructures/Tensor/Structure.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Utilities/Algorithm.hpp"
 #include "Utilities/ContainerHelpers.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
@@ -91,6 +96,15 @@ constexpr bool is_evaluated_lhs_multi_index(
   return true;
 }
 
+/// \brief The number of grid points in each block when the components of a LHS
+/// tensor holding `DataVector`s are computed one block of grid points at a time
+///
+/// \details See `evaluate_impl`. The block size is chosen so that the blocks of
+/// all the tensor components typically involved in a RHS expression (e.g. the
+/// components of the metric, its derivatives and the Christoffel symbols) fit
+/// in the L2 cache together.
+constexpr size_t points_per_block = 128;
+
 template <typename SymmList>
 struct CheckNoLhsAntiSymmetries;
 
@@ -129,6 +143,20 @@ struct CheckNoLhsAntiSymmetries<SymmList<Symm...>> {
  * implementation-dependent. Specifically, the safety of the operation depends
  * on the order of LHS component access and assignment.
  *
+ * If `EvaluateSubtrees == false`, the tensors hold `DataVector`s, more than one
+ * LHS component is computed and the `DataVector`s are longer than
+ * `points_per_block`, the LHS is computed one block of grid points at a time:
+ * the outer loop is over blocks of `points_per_block` grid points and the inner
+ * loop is over the LHS components, evaluating the RHS expression of each
+ * component on the block only. This way the blocks of the RHS operands stay in
+ * cache while all LHS components that depend on them are computed, instead of
+ * streaming every operand from memory once per LHS component. This is still a
+ * safe operation when the LHS tensor is used in the RHS expression with the
+ * same generic index order, because each LHS component at each grid point is
+ * still only computed from the same LHS component at the same grid point.
+ * Expressions that are split into subtrees (`EvaluateSubtrees == true`) are not
+ * blocked, because each subtree is evaluated into a whole LHS component.
+ *
  * \note `LhsTensorIndices` must be passed by reference because non-type
  * template parameters cannot be class types until C++20.
  *
@@ -233,24 +261,73 @@ void evaluate_impl(
   using rhs_expression_type =
       typename std::decay_t<decltype(~rhs_tensorexpression)>;
 
+  // The RHS multi-index to evaluate for each LHS component, if the LHS
+  // component is computed at all
+  std::array<bool, lhs_tensor_type::size()> lhs_component_is_evaluated{};
+  std::array<std::array<size_t, num_rhs_indices>, lhs_tensor_type::size()>
+      rhs_multi_indices{};
+  size_t number_of_evaluated_components = 0;
   for (size_t i = 0; i < lhs_tensor_type::size(); i++) {
     auto lhs_multi_index =
         lhs_tensor_type::structure::get_canonical_tensor_index(i);
-    if (is_evaluated_lhs_multi_index(lhs_multi_index,
-                                     lhs_spatial_spacetime_index_positions,
-                                     lhs_time_index_positions)) {
+    gsl::at(lhs_component_is_evaluated, i) = is_evaluated_lhs_multi_index(
+        lhs_multi_index, lhs_spatial_spacetime_index_positions,
+        lhs_time_index_positions);
+    if (gsl::at(lhs_component_is_evaluated, i)) {
+      ++number_of_evaluated_components;
       for (size_t j = 0; j < lhs_spatial_spacetime_index_positions.size();
            j++) {
         gsl::at(lhs_multi_index,
                 gsl::at(lhs_spatial_spacetime_index_positions, j)) -= 1;
       }
-      auto rhs_multi_index =
+      auto& rhs_multi_index = gsl::at(rhs_multi_indices, i);
+      rhs_multi_index =
           transform_multi_index(lhs_multi_index, index_transformation);
       for (size_t j = 0; j < rhs_spatial_spacetime_index_positions.size();
            j++) {
         gsl::at(rhs_multi_index,
                 gsl::at(rhs_spatial_spacetime_index_positions, j)) += 1;
       }
+    }
+  }
+
+  if constexpr (not EvaluateSubtrees and std::is_same_v<X, DataVector>) {
+    if (number_of_evaluated_components > 1) {
+      const size_t first_evaluated_component = static_cast<size_t>(
+          std::distance(lhs_component_is_evaluated.begin(),
+                        alg::find(lhs_component_is_evaluated, true)));
+      const size_t number_of_points =
+          (~rhs_tensorexpression)
+              .get(gsl::at(rhs_multi_indices, first_evaluated_component))
+              .size();
+      if (number_of_points > points_per_block) {
+        for (size_t i = 0; i < lhs_tensor_type::size(); i++) {
+          if (gsl::at(lhs_component_is_evaluated, i) and
+              (*lhs_tensor)[i].size() != number_of_points) {
+            (*lhs_tensor)[i].destructive_resize(number_of_points);
+          }
+        }
+        for (size_t offset = 0; offset < number_of_points;
+             offset += points_per_block) {
+          const size_t block_size =
+              std::min(points_per_block, number_of_points - offset);
+          for (size_t i = 0; i < lhs_tensor_type::size(); i++) {
+            if (gsl::at(lhs_component_is_evaluated, i)) {
+              blaze::subvector((*lhs_tensor)[i], offset, block_size) =
+                  blaze::subvector((~rhs_tensorexpression)
+                                       .get(gsl::at(rhs_multi_indices, i)),
+                                   offset, block_size);
+            }
+          }
+        }
+        return;
+      }
+    }
+  }
+
+  for (size_t i = 0; i < lhs_tensor_type::size(); i++) {
+    if (gsl::at(lhs_component_is_evaluated, i)) {
+      const auto& rhs_multi_index = gsl::at(rhs_multi_indices, i);
 
       // The expression will either be evaluated as one whole expression
       // or it will be split up into subtrees that are evaluated one at a time.
@@ -373,6 +450,13 @@ void evaluate_impl(
  * `TensorExpression` class). If you need to use the LHS `Tensor` on the RHS,
  * use `tenex::update` instead.
  *
+ * When the tensors hold `DataVector`s and the RHS expression is not split up,
+ * the LHS components are computed one block of grid points at a time so that
+ * the RHS operands stay in cache across components. Expressions with enough
+ * operations to be split up, such as long contractions, are computed one whole
+ * LHS component at a time instead. To benefit from the blocking, such an
+ * expression can be broken up with `tenex::update` (see below).
+ *
  * ### Example usage
  * Given `Tensor`s `R`, `S`, `T`, `G`, and `H`, we can compute the LHS tensor
  * \f$L\f$ in the equation \f$L_{a} = R_{ab} S^{b} + G_{a} - H_{ba}{}^{b} T\f$
@@ -17,16 +17,23 @@
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/StdHelpers.hpp"  // std::vector ostream
 
-TensorComponent::TensorComponent(std::string in_name, DataVector in_data)
-    : name(std::move(in_name)), data(std::move(in_data)) {}
+TensorComponent::TensorComponent(std::string in_name, DataVector in_data,
+                                 std::vector<size_t> in_modal_extents)
+    : name(std::move(in_name)),
+      data(std::move(in_data)),
+      modal_extents(std::move(in_modal_extents)) {}
 
 TensorComponent::TensorComponent(std::string in_name,
-                                 std::vector<float> in_data)
-    : name(std::move(in_name)), data(std::move(in_data)) {}
+                                 std::vector<float> in_data,
+                                 std::vector<size_t> in_modal_extents)
+    : name(std::move(in_name)),
+      data(std::move(in_data)),
+      modal_extents(std::move(in_modal_extents)) {}
 
 void TensorComponent::pup(PUP::er& p) {
   p | name;
   p | data;
+  p | modal_extents;
 }
 
 std::ostream& operator<<(std::ostream& os, const TensorComponent& t) {
@@ -42,7 +49,8 @@ std::ostream& operator<<(std::ostream& os, const TensorComponent& t) {
 }
 
 bool operator==(const TensorComponent& lhs, const TensorComponent& rhs) {
-  return lhs.name == rhs.name and lhs.data == rhs.data;
+  return lhs.name == rhs.name and lhs.data == rhs.data and
+         lhs.modal_extents == rhs.modal_extents;
 }
 
 bool operator!=(const TensorComponent& lhs, const TensorComponent& rhs) {
@@ -26,16 +26,23 @@ class er;
  * The name should be a path inside an H5 file, typically starting with the name
  * of the volume subfile. For example,
  * `element_volume_data.vol/ObservationId[ID]/[ElementIdName]/psi_xx`.
+ *
+ * If the `modal_extents` are not empty, the `data` are the modal coefficients
+ * of the tensor component truncated to a block of lowest modes with these
+ * extents (see `h5::truncate_modes`) instead of its nodal values.
  */
 struct TensorComponent {
   TensorComponent() = default;
-  TensorComponent(std::string in_name, DataVector in_data);
-  TensorComponent(std::string in_name, std::vector<float> in_data);
+  TensorComponent(std::string in_name, DataVector in_data,
+                  std::vector<size_t> in_modal_extents = {});
+  TensorComponent(std::string in_name, std::vector<float> in_data,
+                  std::vector<size_t> in_modal_extents = {});
 
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p);
   std::string name{};
   std::variant<DataVector, std::vector<float>> data{};
+  std::vector<size_t> modal_extents{};
 };
 
 std::ostream& operator<<(std::ostream& os, const TensorComponent& t);
@@ -170,6 +170,18 @@ size_t BlockZCurveProcDistribution<Dim>::get_proc_for_element(
       "Processor not successfully chosen. This indicates a flaw in the logic "
       "of BlockZCurveProcDistribution.");
 }
+
+template <size_t Dim>
+std::vector<size_t> BlockZCurveProcDistribution<Dim>::procs_for_block(
+    const size_t block_id) const {
+  std::vector<size_t> procs{};
+  for (const std::pair<size_t, size_t>& element_info :
+       gsl::at(block_element_distribution_, block_id)) {
+    procs.push_back(element_info.first);
+  }
+  return procs;
+}
+
 #define GET_DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
 #define INSTANTIATION(r, data) \
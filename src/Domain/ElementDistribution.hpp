@@ -119,6 +119,12 @@ struct BlockZCurveProcDistribution {
   /// assignment described in detail in the parent class documentation.
   size_t get_proc_for_element(const ElementId<Dim>& element_id) const;
 
+  /// The processor numbers that are assigned elements in the block with id
+  /// `block_id`, in the order in which they are assigned elements along the
+  /// Morton curve of the block. Use this to skip blocks that have no elements
+  /// on a particular processor.
+  std::vector<size_t> procs_for_block(size_t block_id) const;
+
  private:
   // in this nested data structure:
   // - The block id is the first index
@@ -0,0 +1,51 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <boost/functional/hash.hpp>
+#include <cstddef>
+#include <pup.h>
+#include <utility>
+
+#include "DataStructures/FixedHashMap.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/MaxNumberOfNeighbors.hpp"
+
+/// \ingroup DataStructuresGroup
+/// \ingroup ComputationalDomainGroup
+/// \brief An optimized map with (Direction, ElementId) pair keys, e.g. for
+/// data on the mortars of an element.
+///
+/// \details The entries are stored inline in an array with one slot for each of
+/// the `maximum_number_of_neighbors(Dim)` neighbors an element can have, so
+/// there are no allocations when entries are inserted and lookups and
+/// iterations don't chase pointers. See `FixedHashMap` for the interface.
+template <size_t Dim, typename T>
+class DirectionalIdMap
+    : public FixedHashMap<
+          maximum_number_of_neighbors(Dim),
+          std::pair<Direction<Dim>, ElementId<Dim>>, T,
+          boost::hash<std::pair<Direction<Dim>, ElementId<Dim>>>> {
+ public:
+  using base = FixedHashMap<
+      maximum_number_of_neighbors(Dim),
+      std::pair<Direction<Dim>, ElementId<Dim>>, T,
+      boost::hash<std::pair<Direction<Dim>, ElementId<Dim>>>>;
+  using base::base;
+};
+
+namespace PUP {
+template <size_t Dim, typename T>
+// NOLINTNEXTLINE(google-runtime-references)
+void pup(PUP::er& p, DirectionalIdMap<Dim, T>& t) {
+  pup(p, static_cast<typename DirectionalIdMap<Dim, T>::base&>(t));
+}
+
+template <size_t Dim, typename T>
+// NOLINTNEXTLINE(google-runtime-references)
+void operator|(PUP::er& p, DirectionalIdMap<Dim, T>& t) {
+  p | static_cast<typename DirectionalIdMap<Dim, T>::base&>(t);
+}
+}  // namespace PUP
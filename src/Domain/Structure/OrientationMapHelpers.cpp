@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <map>
 #include <numeric>
 
 #include "DataStructures/Index.hpp"
@@ -199,97 +200,142 @@ std::vector<size_t> compute_offset_permutation(
   return oriented_offsets;
 }
 
+// The permutations only depend on the extents, the orientation, and the sliced
+// dimension, of which there are only a few distinct combinations in a domain.
+// However, they are needed for every misaligned mortar and ghost zone on every
+// step, so we cache them. Each thread keeps its own cache so no locking is
+// needed. Volume permutations use `VolumeDim` as the sliced dimension.
+template <size_t VolumeDim, size_t ExtentsDim, typename ComputePermutation>
+const std::vector<size_t>& cached_offset_permutation(
+    const Index<ExtentsDim>& extents, const size_t sliced_dim,
+    const OrientationMap<VolumeDim>& orientation_of_neighbor,
+    const ComputePermutation& compute_permutation) {
+  static thread_local std::map<std::array<size_t, 2 * VolumeDim + 1>,
+                               std::vector<size_t>>
+      cache{};
+  std::array<size_t, 2 * VolumeDim + 1> key{};
+  for (size_t d = 0; d < ExtentsDim; ++d) {
+    gsl::at(key, d) = extents[d];
+  }
+  for (size_t d = 0; d < VolumeDim; ++d) {
+    const Direction<VolumeDim> neighbor_axis =
+        orientation_of_neighbor(Direction<VolumeDim>(d, Side::Upper));
+    gsl::at(key, VolumeDim + d) =
+        2 * neighbor_axis.dimension() +
+        (neighbor_axis.side() == Side::Upper ? 1 : 0);
+  }
+  gsl::at(key, 2 * VolumeDim) = sliced_dim;
+  auto cached_permutation = cache.find(key);
+  if (cached_permutation == cache.end()) {
+    cached_permutation = cache.emplace(key, compute_permutation()).first;
+  }
+  return cached_permutation->second;
+}
 }  // namespace
 
 namespace OrientationMapHelpers_detail {
 
 template <>
-std::vector<size_t> oriented_offset(
+const std::vector<size_t>& oriented_offset(
     const Index<1>& extents, const OrientationMap<1>& orientation_of_neighbor) {
-  const Direction<1> neighbor_axis =
-      orientation_of_neighbor(Direction<1>::upper_xi());
-  const bool is_aligned = (neighbor_axis.side() == Side::Upper);
-  return compute_offset_permutation(extents, is_aligned);
+  return cached_offset_permutation(extents, 1, orientation_of_neighbor, [&]() {
+    const Direction<1> neighbor_axis =
+        orientation_of_neighbor(Direction<1>::upper_xi());
+    const bool is_aligned = (neighbor_axis.side() == Side::Upper);
+    return compute_offset_permutation(extents, is_aligned);
+  });
 }
 
 template <>
-std::vector<size_t> oriented_offset(
+const std::vector<size_t>& oriented_offset(
     const Index<2>& extents, const OrientationMap<2>& orientation_of_neighbor) {
-  const Direction<2> neighbor_first_axis =
-      orientation_of_neighbor(Direction<2>::upper_xi());
-  const Direction<2> neighbor_second_axis =
-      orientation_of_neighbor(Direction<2>::upper_eta());
-  const bool axes_are_transposed =
-      (neighbor_first_axis.dimension() > neighbor_second_axis.dimension());
-  const bool neighbor_first_axis_is_aligned =
-      (Side::Upper == neighbor_first_axis.side());
-  const bool neighbor_second_axis_is_aligned =
-      (Side::Upper == neighbor_second_axis.side());
-
-  return compute_offset_permutation(extents, neighbor_first_axis_is_aligned,
-                                    neighbor_second_axis_is_aligned,
-                                    axes_are_transposed);
+  return cached_offset_permutation(extents, 2, orientation_of_neighbor, [&]() {
+    const Direction<2> neighbor_first_axis =
+        orientation_of_neighbor(Direction<2>::upper_xi());
+    const Direction<2> neighbor_second_axis =
+        orientation_of_neighbor(Direction<2>::upper_eta());
+    const bool axes_are_transposed =
+        (neighbor_first_axis.dimension() > neighbor_second_axis.dimension());
+    const bool neighbor_first_axis_is_aligned =
+        (Side::Upper == neighbor_first_axis.side());
+    const bool neighbor_second_axis_is_aligned =
+        (Side::Upper == neighbor_second_axis.side());
+
+    return compute_offset_permutation(extents, neighbor_first_axis_is_aligned,
+                                      neighbor_second_axis_is_aligned,
+                                      axes_are_transposed);
+  });
 }
 
 template <>
-std::vector<size_t> oriented_offset(
+const std::vector<size_t>& oriented_offset(
     const Index<3>& extents, const OrientationMap<3>& orientation_of_neighbor) {
-  const Direction<3> neighbor_first_axis =
-      orientation_of_neighbor(Direction<3>::upper_xi());
-  const Direction<3> neighbor_second_axis =
-      orientation_of_neighbor(Direction<3>::upper_eta());
-  const Direction<3> neighbor_third_axis =
-      orientation_of_neighbor(Direction<3>::upper_zeta());
-
-  const bool neighbor_first_axis_is_aligned =
-      (Side::Upper == neighbor_first_axis.side());
-  const bool neighbor_second_axis_is_aligned =
-      (Side::Upper == neighbor_second_axis.side());
-  const bool neighbor_third_axis_is_aligned =
-      (Side::Upper == neighbor_third_axis.side());
-
-  const auto neighbor_axis_permutation = make_array(
-      neighbor_first_axis.dimension(), neighbor_second_axis.dimension(),
-      neighbor_third_axis.dimension());
-
-  return compute_offset_permutation(
-      extents, neighbor_first_axis_is_aligned, neighbor_second_axis_is_aligned,
-      neighbor_third_axis_is_aligned, neighbor_axis_permutation);
+  return cached_offset_permutation(extents, 3, orientation_of_neighbor, [&]() {
+    const Direction<3> neighbor_first_axis =
+        orientation_of_neighbor(Direction<3>::upper_xi());
+    const Direction<3> neighbor_second_axis =
+        orientation_of_neighbor(Direction<3>::upper_eta());
+    const Direction<3> neighbor_third_axis =
+        orientation_of_neighbor(Direction<3>::upper_zeta());
+
+    const bool neighbor_first_axis_is_aligned =
+        (Side::Upper == neighbor_first_axis.side());
+    const bool neighbor_second_axis_is_aligned =
+        (Side::Upper == neighbor_second_axis.side());
+    const bool neighbor_third_axis_is_aligned =
+        (Side::Upper == neighbor_third_axis.side());
+
+    const auto neighbor_axis_permutation = make_array(
+        neighbor_first_axis.dimension(), neighbor_second_axis.dimension(),
+        neighbor_third_axis.dimension());
+
+    return compute_offset_permutation(
+        extents, neighbor_first_axis_is_aligned,
+        neighbor_second_axis_is_aligned, neighbor_third_axis_is_aligned,
+        neighbor_axis_permutation);
+  });
 }
 
-std::vector<size_t> oriented_offset_on_slice(
+const std::vector<size_t>& oriented_offset_on_slice(
     const Index<1>& slice_extents, const size_t sliced_dim,
     const OrientationMap<2>& orientation_of_neighbor) {
-  const Direction<2> my_slice_axis =
-      (0 == sliced_dim ? Direction<2>::upper_eta() : Direction<2>::upper_xi());
-  const Direction<2> neighbor_slice_axis =
-      orientation_of_neighbor(my_slice_axis);
-  const bool is_aligned = (neighbor_slice_axis.side() == Side::Upper);
-  return compute_offset_permutation(slice_extents, is_aligned);
+  return cached_offset_permutation(
+      slice_extents, sliced_dim, orientation_of_neighbor, [&]() {
+        const Direction<2> my_slice_axis =
+            (0 == sliced_dim ? Direction<2>::upper_eta()
+                             : Direction<2>::upper_xi());
+        const Direction<2> neighbor_slice_axis =
+            orientation_of_neighbor(my_slice_axis);
+        const bool is_aligned = (neighbor_slice_axis.side() == Side::Upper);
+        return compute_offset_permutation(slice_extents, is_aligned);
+      });
 }
 
-std::vector<size_t> oriented_offset_on_slice(
+const std::vector<size_t>& oriented_offset_on_slice(
     const Index<2>& slice_extents, const size_t sliced_dim,
     const OrientationMap<3>& orientation_of_neighbor) {
-  const std::array<size_t, 2> dims_of_slice =
-      (0 == sliced_dim ? make_array(1_st, 2_st)
-                       : (1 == sliced_dim) ? make_array(0_st, 2_st)
-                                           : make_array(0_st, 1_st));
-  const bool neighbor_axes_are_transposed =
-      (orientation_of_neighbor(dims_of_slice[0]) >
-       orientation_of_neighbor(dims_of_slice[1]));
-  const Direction<3> neighbor_first_axis =
-      orientation_of_neighbor(Direction<3>(dims_of_slice[0], Side::Upper));
-  const Direction<3> neighbor_second_axis =
-      orientation_of_neighbor(Direction<3>(dims_of_slice[1], Side::Upper));
-  const bool neighbor_first_axis_is_aligned =
-      (Side::Upper == neighbor_first_axis.side());
-  const bool neighbor_second_axis_is_aligned =
-      (Side::Upper == neighbor_second_axis.side());
-
-  return compute_offset_permutation(
-      slice_extents, neighbor_first_axis_is_aligned,
-      neighbor_second_axis_is_aligned, neighbor_axes_are_transposed);
+  return cached_offset_permutation(
+      slice_extents, sliced_dim, orientation_of_neighbor, [&]() {
+        const std::array<size_t, 2> dims_of_slice =
+            (0 == sliced_dim ? make_array(1_st, 2_st)
+                             : (1 == sliced_dim) ? make_array(0_st, 2_st)
+                                                 : make_array(0_st, 1_st));
+        const bool neighbor_axes_are_transposed =
+            (orientation_of_neighbor(dims_of_slice[0]) >
+             orientation_of_neighbor(dims_of_slice[1]));
+        const Direction<3> neighbor_first_axis = orientation_of_neighbor(
+            Direction<3>(dims_of_slice[0], Side::Upper));
+        const Direction<3> neighbor_second_axis = orientation_of_neighbor(
+            Direction<3>(dims_of_slice[1], Side::Upper));
+        const bool neighbor_first_axis_is_aligned =
+            (Side::Upper == neighbor_first_axis.side());
+        const bool neighbor_second_axis_is_aligned =
+            (Side::Upper == neighbor_second_axis.side());
+
+        return compute_offset_permutation(
+            slice_extents, neighbor_first_axis_is_aligned,
+            neighbor_second_axis_is_aligned, neighbor_axes_are_transposed);
+      });
 }
 
 template <typename T>
@@ -324,12 +370,14 @@ template void orient_each_component(
 }  // namespace OrientationMapHelpers_detail
 
 template <size_t VolumeDim>
-std::vector<double> orient_variables(
+void orient_variables(
+    const gsl::not_null<std::vector<double>*> oriented_variables,
     const std::vector<double>& variables, const Index<VolumeDim>& extents,
     const OrientationMap<VolumeDim>& orientation_of_neighbor) {
   // Skip work (aside from a copy) if neighbor is aligned
   if (orientation_of_neighbor.is_aligned()) {
-    return variables;
+    oriented_variables->assign(variables.begin(), variables.end());
+    return;
   }
 
   const size_t number_of_grid_points = extents.product();
@@ -337,25 +385,36 @@ std::vector<double> orient_variables(
          "The size of the variables must be divisible by the number of grid "
          "points. Number of grid points: "
              << number_of_grid_points << " size: " << variables.size());
-  std::vector<double> oriented_variables(variables.size());
-  const auto oriented_offset = OrientationMapHelpers_detail::oriented_offset(
-      extents, orientation_of_neighbor);
-  auto oriented_vars_view = gsl::make_span(oriented_variables);
+  oriented_variables->resize(variables.size());
+  auto oriented_vars_view = gsl::make_span(*oriented_variables);
   OrientationMapHelpers_detail::orient_each_component(
       make_not_null(&oriented_vars_view), gsl::make_span(variables),
-      number_of_grid_points, oriented_offset);
+      number_of_grid_points,
+      OrientationMapHelpers_detail::oriented_offset(extents,
+                                                    orientation_of_neighbor));
+}
 
+template <size_t VolumeDim>
+std::vector<double> orient_variables(
+    const std::vector<double>& variables, const Index<VolumeDim>& extents,
+    const OrientationMap<VolumeDim>& orientation_of_neighbor) {
+  std::vector<double> oriented_variables{};
+  orient_variables(make_not_null(&oriented_variables), variables, extents,
+                   orientation_of_neighbor);
   return oriented_variables;
 }
 
 template <size_t VolumeDim>
-std::vector<double> orient_variables_on_slice(
+void orient_variables_on_slice(
+    const gsl::not_null<std::vector<double>*> oriented_variables,
     const std::vector<double>& variables_on_slice,
     const Index<VolumeDim - 1>& slice_extents, const size_t sliced_dim,
     const OrientationMap<VolumeDim>& orientation_of_neighbor) {
   // Skip work (aside from a copy) if neighbor slice is aligned
   if (orientation_of_neighbor.is_aligned()) {
-    return variables_on_slice;
+    oriented_variables->assign(variables_on_slice.begin(),
+                               variables_on_slice.end());
+    return;
   }
 
   const size_t number_of_grid_points = slice_extents.product();
@@ -364,25 +423,42 @@ std::vector<double> orient_variables_on_slice(
          "points. Number of grid points: "
              << number_of_grid_points
              << " size: " << variables_on_slice.size());
-  std::vector<double> oriented_variables(variables_on_slice.size());
-  const auto oriented_offset =
-      OrientationMapHelpers_detail::oriented_offset_on_slice(
-          slice_extents, sliced_dim, orientation_of_neighbor);
-
-  auto oriented_vars_view = gsl::make_span(oriented_variables);
+  oriented_variables->resize(variables_on_slice.size());
+  auto oriented_vars_view = gsl::make_span(*oriented_variables);
   OrientationMapHelpers_detail::orient_each_component(
       make_not_null(&oriented_vars_view), gsl::make_span(variables_on_slice),
-      number_of_grid_points, oriented_offset);
+      number_of_grid_points,
+      OrientationMapHelpers_detail::oriented_offset_on_slice(
+          slice_extents, sliced_dim, orientation_of_neighbor));
+}
 
+template <size_t VolumeDim>
+std::vector<double> orient_variables_on_slice(
+    const std::vector<double>& variables_on_slice,
+    const Index<VolumeDim - 1>& slice_extents, const size_t sliced_dim,
+    const OrientationMap<VolumeDim>& orientation_of_neighbor) {
+  std::vector<double> oriented_variables{};
+  orient_variables_on_slice(make_not_null(&oriented_variables),
+                            variables_on_slice, slice_extents, sliced_dim,
+                            orientation_of_neighbor);
   return oriented_variables;
 }
 
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
 #define INSTANTIATION(r, data)                                               \
+  template void orient_variables<DIM(data)>(                                 \
+      gsl::not_null<std::vector<double>*> oriented_variables,                \
+      const std::vector<double>& variables, const Index<DIM(data)>& extents, \
+      const OrientationMap<DIM(data)>& orientation_of_neighbor);             \
   template std::vector<double> orient_variables<DIM(data)>(                  \
       const std::vector<double>& variables, const Index<DIM(data)>& extents, \
       const OrientationMap<DIM(data)>& orientation_of_neighbor);             \
+  template void orient_variables_on_slice<DIM(data)>(                        \
+      gsl::not_null<std::vector<double>*> oriented_variables,                \
+      const std::vector<double>& variables,                                  \
+      const Index<DIM(data) - 1>& extents, size_t sliced_dim,                \
+      const OrientationMap<DIM(data)>& orientation_of_neighbor);             \
   template std::vector<double> orient_variables_on_slice<DIM(data)>(         \
       const std::vector<double>& variables,                                  \
       const Index<DIM(data) - 1>& extents, size_t sliced_dim,                \
@@ -25,23 +25,26 @@ void orient_each_component(gsl::not_null<gsl::span<T>*> oriented_variables,
                            const gsl::span<const T>& variables, size_t num_pts,
                            const std::vector<size_t>& oriented_offset);
 
+// The offset permutations are cached per thread, so the returned references
+// remain valid for the lifetime of the calling thread.
 template <size_t VolumeDim>
-std::vector<size_t> oriented_offset(
+const std::vector<size_t>& oriented_offset(
     const Index<VolumeDim>& extents,
     const OrientationMap<VolumeDim>& orientation_of_neighbor);
 
-inline std::vector<size_t> oriented_offset_on_slice(
+inline const std::vector<size_t>& oriented_offset_on_slice(
     const Index<0>& /*slice_extents*/, const size_t /*sliced_dim*/,
     const OrientationMap<1>& /*orientation_of_neighbor*/) {
   // There is only one point on a slice of a 1D mesh
-  return {0};
+  static const std::vector<size_t> offset{0};
+  return offset;
 }
 
-std::vector<size_t> oriented_offset_on_slice(
+const std::vector<size_t>& oriented_offset_on_slice(
     const Index<1>& slice_extents, size_t sliced_dim,
     const OrientationMap<2>& orientation_of_neighbor);
 
-std::vector<size_t> oriented_offset_on_slice(
+const std::vector<size_t>& oriented_offset_on_slice(
     const Index<2>& slice_extents, size_t sliced_dim,
     const OrientationMap<3>& orientation_of_neighbor);
 
@@ -69,7 +72,7 @@ Variables<TagsList> orient_variables(
                 "  extents.product() = "
              << extents.product());
   Variables<TagsList> oriented_variables(number_of_grid_points);
-  const auto oriented_offset = OrientationMapHelpers_detail::oriented_offset(
+  const auto& oriented_offset = OrientationMapHelpers_detail::oriented_offset(
       extents, orientation_of_neighbor);
   auto oriented_vars_view = gsl::make_span(oriented_variables);
   OrientationMapHelpers_detail::orient_each_component(
@@ -98,7 +101,7 @@ Variables<TagsList> orient_variables_on_slice(
                 "  slice_extents.product() = "
              << slice_extents.product());
   Variables<TagsList> oriented_variables(number_of_grid_points);
-  const auto oriented_offset =
+  const auto& oriented_offset =
       OrientationMapHelpers_detail::oriented_offset_on_slice(
           slice_extents, sliced_dim, orientation_of_neighbor);
 
@@ -123,11 +126,29 @@ Variables<TagsList> orient_variables_on_slice(
 /// DG with finite difference methods, where sometimes the data sent is both the
 /// variables for reconstruction and the fluxes for either the DG or finite
 /// difference scheme, while at other points only one of these three is sent.
+///
+/// The overloads taking a `gsl::not_null` write into `oriented_variables`,
+/// which is resized to the size of the input without releasing its capacity.
+/// This allows orienting the data directly into a buffer that has been
+/// reserved for the whole message being sent to the neighbor.
+template <size_t VolumeDim>
+void orient_variables(gsl::not_null<std::vector<double>*> oriented_variables,
+                      const std::vector<double>& variables,
+                      const Index<VolumeDim>& extents,
+                      const OrientationMap<VolumeDim>& orientation_of_neighbor);
+
 template <size_t VolumeDim>
 std::vector<double> orient_variables(
     const std::vector<double>& variables, const Index<VolumeDim>& extents,
     const OrientationMap<VolumeDim>& orientation_of_neighbor);
 
+template <size_t VolumeDim>
+void orient_variables_on_slice(
+    gsl::not_null<std::vector<double>*> oriented_variables,
+    const std::vector<double>& variables_on_slice,
+    const Index<VolumeDim - 1>& slice_extents, size_t sliced_dim,
+    const OrientationMap<VolumeDim>& orientation_of_neighbor);
+
 template <size_t VolumeDim>
 std::vector<double> orient_variables_on_slice(
     const std::vector<double>& variables_on_slice,
@@ -12,6 +12,7 @@
 #include <utility>
 
 #include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/FixedHashMap.hpp"
 #include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
 #include "Domain/FaceNormal.hpp"
@@ -65,6 +66,13 @@ struct MortarDataInboxTag
                    boost::hash<::dg::MortarId<Dim>>>>;
 };
 
+// This tag holds a memory buffer for the primal fluxes with boundary
+// corrections added, so it isn't allocated in every operator application
+template <typename PrimalFluxesTag>
+struct PrimalFluxesCorrectedBuffer : db::SimpleTag {
+  using type = typename PrimalFluxesTag::type;
+};
+
 // Initializes all quantities the DG operator needs on internal and external
 // faces, as well as the mortars between neighboring elements. Also initializes
 // the variable-independent background fields in the PDEs.
@@ -173,7 +181,8 @@ struct PrepareAndSendMortarData<
   // and the remaining tags hold output of the operator.
   using simple_tags =
       tmpl::list<TemporalIdTag, PrimalFieldsTag, PrimalFluxesTag,
-                 OperatorAppliedToFieldsTag, all_mortar_data_tag>;
+                 OperatorAppliedToFieldsTag, all_mortar_data_tag,
+                 PrimalFluxesCorrectedBuffer<PrimalFluxesTag>>;
   using compute_tags = tmpl::list<>;
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
@@ -386,7 +395,9 @@ struct ReceiveMortarDataAndApplyOperator<
     }
 
     // Apply DG operator
-    db::mutate<OperatorAppliedToFieldsTag, all_mortar_data_tag>(
+    db::mutate<OperatorAppliedToFieldsTag,
+               PrimalFluxesCorrectedBuffer<PrimalFluxesTag>,
+               all_mortar_data_tag>(
         make_not_null(&box),
         [](const auto&... args) {
           elliptic::dg::apply_operator<System, Linearized>(args...);
@@ -468,7 +479,9 @@ using initialize_operator = tmpl::list<
  * The result of the computation is written to the `OperatorAppliedToFieldsTag`.
  * Additionally, the primal fluxes are written to the `PrimalFluxesTag` as an
  * intermediate result. The auxiliary fields and fluxes are discarded to avoid
- * inflating the memory usage.
+ * inflating the memory usage. The primal fluxes with boundary corrections
+ * added are kept in a DataBox buffer, so they aren't allocated in every
+ * application of the operator.
  *
  * You can specify the `PrimalMortarFieldsTag` and the `PrimalMortarFluxesTag`
  * to re-use mortar-data memory buffers from other operator applications, for
@@ -5,6 +5,8 @@
 
 #include <charm++.h>
 #include <cstddef>
+#include <tuple>
+#include <type_traits>
 #include <unordered_set>
 #include <vector>
 
@@ -23,14 +25,19 @@
 #include "Parallel/Phase.hpp"
 #include "Parallel/Protocols/ArrayElementsAllocator.hpp"
 #include "Parallel/Tags/ResourceInfo.hpp"
+#include "ParallelAlgorithms/Initialization/InsertInitialElements.hpp"
 #include "Utilities/Numeric.hpp"
 #include "Utilities/ProtocolHelpers.hpp"
-#include "Utilities/System/ParallelInfo.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
+#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
 
 namespace elliptic {
 
+namespace detail {
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(distribute_element_creation)
+}  // namespace detail
+
 /*!
  * \brief A `Parallel::protocols::ArrayElementsAllocator` that creates array
  * elements to cover the initial computational domain
@@ -41,6 +48,14 @@ namespace elliptic {
  * on processors using the `domain::BlockZCurveProcDistribution`. In both cases,
  * an unordered set of `size_t`s can be passed to the `allocate_array` function
  * which represents physical processors to avoid placing elements on.
+ *
+ * By default all elements are created on global proc 0. Specify
+ * `static constexpr bool distribute_element_creation = true;` in the
+ * `Metavariables` to create the elements in parallel instead: the
+ * initialization items are sent to every node once through the
+ * `Parallel::GlobalCache`, and each node creates only the elements placed on
+ * its own procs. The `Parallel::Main` chare waits until all nodes have inserted
+ * their elements before it executes the initialization phase.
  */
 template <size_t Dim>
 struct DefaultElementsAllocator
@@ -49,33 +64,32 @@ struct DefaultElementsAllocator
   using array_allocation_tags =
       tmpl::list<domain::Tags::InitialRefinementLevels<Dim>>;
 
+  template <typename Metavariables>
+  static constexpr bool distribute_element_creation =
+      detail::get_distribute_element_creation_or_default_v<Metavariables,
+                                                            false>;
+
   template <typename ParallelComponent, typename Metavariables,
             typename... InitializationTags>
   static void apply(
       Parallel::CProxy_GlobalCache<Metavariables>& global_cache,
       const tuples::TaggedTuple<InitializationTags...>& initialization_items,
       const std::unordered_set<size_t>& procs_to_ignore = {}) {
-    auto& local_cache = *Parallel::local_branch(global_cache);
-    auto& element_array =
-        Parallel::get_parallel_component<ParallelComponent>(local_cache);
-    const auto& domain = Parallel::get<domain::Tags::Domain<Dim>>(local_cache);
-    const auto& initial_refinement_levels =
-        get<domain::Tags::InitialRefinementLevels<Dim>>(initialization_items);
-    const size_t num_of_procs_to_use =
-        static_cast<size_t>(sys::number_of_procs()) - procs_to_ignore.size();
-    const domain::BlockZCurveProcDistribution<Dim> element_distribution{
-        num_of_procs_to_use, initial_refinement_levels, procs_to_ignore};
-    for (const auto& block : domain.blocks()) {
-      const std::vector<ElementId<Dim>> element_ids = initial_element_ids(
-          block.id(), initial_refinement_levels[block.id()]);
-      for (const auto& element_id : element_ids) {
-        const size_t target_proc =
-            element_distribution.get_proc_for_element(element_id);
-        element_array(element_id)
-            .insert(global_cache, initialization_items, target_proc);
-      }
+    if constexpr (distribute_element_creation<Metavariables>) {
+      // Main finishes the insertion once all nodes have inserted their
+      // elements
+      auto& local_cache = *Parallel::local_branch(global_cache);
+      global_cache.template invoke_on_node<
+          Initialization::InsertInitialElements<Dim, ParallelComponent>>(
+          std::make_tuple(initialization_items, procs_to_ignore),
+          CkCallback(Parallel::CkIndex_Main<
+                         Metavariables>::distributed_array_allocated(),
+                     local_cache.get_main_proxy().value()));
+      return;
     }
-    element_array.doneInserting();
+    Initialization::InsertInitialElements<Dim, ParallelComponent>::apply(
+        *Parallel::local_branch(global_cache), initialization_items,
+        procs_to_ignore, true);
   }
 };
 
@@ -105,6 +119,13 @@ struct DgElementArray {
   using phase_dependent_action_list = PhaseDepActionList;
   using array_index = ElementId<volume_dim>;
 
+  // Only the `DefaultElementsAllocator` can create the elements in parallel
+  static constexpr bool distribute_element_creation =
+      std::is_same_v<ElementsAllocator,
+                     DefaultElementsAllocator<volume_dim>> and
+      DefaultElementsAllocator<
+          volume_dim>::template distribute_element_creation<Metavariables>;
+
   using const_global_cache_tags = tmpl::list<domain::Tags::Domain<volume_dim>>;
 
   using array_allocation_tags =
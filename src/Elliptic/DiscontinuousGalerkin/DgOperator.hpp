@@ -661,6 +661,8 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
   static void apply_operator(
       const gsl::not_null<Variables<tmpl::list<OperatorTags...>>*>
           operator_applied_to_vars,
+      const gsl::not_null<Variables<tmpl::list<PrimalFluxesVars...>>*>
+          primal_fluxes_corrected,
       const gsl::not_null<::dg::MortarMap<
           Dim, MortarData<TemporalId, tmpl::list<PrimalMortarVars...>,
                           tmpl::list<PrimalMortarFluxes...>>>*>
@@ -726,11 +728,10 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
            "you also set 'Linearized' to 'true'.");
     const size_t num_points = mesh.number_of_grid_points();
 
-    // This function and the one above allocate various Variables to compute
-    // intermediate quantities. It could be a performance optimization to reduce
-    // the number of these allocations and/or move some of the memory buffers
-    // into the DataBox to keep them around permanently. The latter should be
-    // informed by profiling.
+    // The boundary-corrected primal fluxes are written into the
+    // `primal_fluxes_corrected` buffer so callers that apply the operator
+    // repeatedly can keep it around permanently. The per-mortar boundary
+    // corrections below are still allocated for every application.
 
     // Add boundary corrections to the auxiliary variables _before_ computing
     // the second derivative. This is called the "flux" formulation. It is
@@ -747,9 +748,9 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
     // the second derivative. This involves a slightly different lifting
     // operation with differentiation matrices, which we avoid to implement for
     // now by using the flux-formulation.
-    auto primal_fluxes_corrected = primal_fluxes;
     // Keeping track if any corrections were applied here, for an optimization
-    // below
+    // below. The primal fluxes are only copied to the buffer once the first
+    // correction is applied.
     bool has_any_boundary_corrections = false;
     for (const auto& [mortar_id, mortar_data] : *all_mortar_data) {
       const auto& [direction, neighbor_id] = mortar_id;
@@ -769,7 +770,10 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
           (not is_internal or data_is_zero(neighbor_id))) {
         continue;
       }
-      has_any_boundary_corrections = true;
+      if (not has_any_boundary_corrections) {
+        *primal_fluxes_corrected = primal_fluxes;
+        has_any_boundary_corrections = true;
+      }
 
       const auto face_mesh = mesh.slice_away(direction.dimension());
       const size_t slice_index = index_to_slice_at(mesh.extents(), direction);
@@ -818,7 +822,7 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
       auxiliary_boundary_corrections *= -1.;
 
       // Add the boundary corrections to the auxiliary variables
-      add_slice_to_data(make_not_null(&primal_fluxes_corrected),
+      add_slice_to_data(primal_fluxes_corrected,
                         auxiliary_boundary_corrections, mesh.extents(),
                         direction.dimension(), slice_index);
     }  // apply auxiliary boundary corrections on all mortars
@@ -831,8 +835,10 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
       // corrections will be added
       return;
     } else {
-      divergence(operator_applied_to_vars, primal_fluxes_corrected, mesh,
-                 inv_jacobian);
+      divergence(operator_applied_to_vars,
+                 has_any_boundary_corrections ? *primal_fluxes_corrected
+                                              : primal_fluxes,
+                 mesh, inv_jacobian);
       // This is the sign flip that makes the operator _minus_ the Laplacian for
       // a Poisson system
       *operator_applied_to_vars *= -1.;
@@ -941,6 +947,28 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
     }
   }
 
+  // Allocates the buffer for the boundary-corrected primal fluxes
+  template <bool AllDataIsZero, typename... OperatorTags,
+            typename... PrimalMortarVars, typename... PrimalMortarFluxes,
+            typename TemporalId, typename... PrimalVars,
+            typename... PrimalFluxesVars, typename... Args>
+  static void apply_operator(
+      const gsl::not_null<Variables<tmpl::list<OperatorTags...>>*>
+          operator_applied_to_vars,
+      const gsl::not_null<::dg::MortarMap<
+          Dim, MortarData<TemporalId, tmpl::list<PrimalMortarVars...>,
+                          tmpl::list<PrimalMortarFluxes...>>>*>
+          all_mortar_data,
+      const Variables<tmpl::list<PrimalVars...>>& primal_vars,
+      const Variables<tmpl::list<PrimalFluxesVars...>>& primal_fluxes,
+      Args&&... args) {
+    Variables<tmpl::list<PrimalFluxesVars...>> primal_fluxes_corrected{};
+    apply_operator<AllDataIsZero>(
+        operator_applied_to_vars, make_not_null(&primal_fluxes_corrected),
+        all_mortar_data, primal_vars, primal_fluxes,
+        std::forward<Args>(args)...);
+  }
+
   template <typename... FixedSourcesTags, typename ApplyBoundaryCondition,
             typename... FluxesArgs, typename... SourcesArgs,
             bool LocalLinearized = Linearized,
@@ -1030,6 +1058,12 @@ void prepare_mortar_data(Args&&... args) {
  * `elliptic::dg::prepare_mortar_data` function to prepare mortar data on
  * neighboring elements, then communicate the data and insert them on the
  * "remote" side of the mortars before calling this function.
+ *
+ * The operator adds boundary corrections to a copy of the primal fluxes. To
+ * avoid allocating this copy in every application, pass a buffer for it as
+ * second argument, i.e. right after the `operator_applied_to_vars`. The buffer
+ * is resized as needed, so it can be kept around between applications of the
+ * operator.
  */
 template <typename System, bool Linearized, typename... Args>
 void apply_operator(Args&&... args) {
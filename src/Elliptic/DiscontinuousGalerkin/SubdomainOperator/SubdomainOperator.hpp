@@ -11,6 +11,7 @@
 #include <tuple>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
@@ -222,6 +223,61 @@ struct SubdomainOperator
                                const BoundaryConditionsBase&,
                                boost::hash<std::pair<size_t, Direction<Dim>>>>&
           override_boundary_conditions = {}) const {
+    apply_impl(gsl::make_span(result.get(), 1), gsl::make_span(&operand, 1),
+               box, override_boundary_conditions);
+  }
+
+  /*!
+   * \brief Apply the operator to several operands at once
+   *
+   * The arguments are retrieved from the DataBox and prepared only once for
+   * all operands, and the memory buffers are reused. This function is used by
+   * `LinearSolver::Serial::build_matrix`, e.g. when the
+   * `LinearSolver::Serial::ExplicitInverse` subdomain solver builds the matrix
+   * representation of the subdomain operator. The `results` must have the same
+   * size as the `operands`.
+   *
+   * \warning This function is not thread-safe because it accesses mutable
+   * memory buffers.
+   */
+  template <typename ResultTags, typename OperandTags, typename DbTagsList>
+  void apply_batch(
+      const gsl::not_null<std::vector<LinearSolver::Schwarz::
+                                          ElementCenteredSubdomainData<
+                                              Dim, ResultTags>>*>
+          results,
+      const std::vector<LinearSolver::Schwarz::ElementCenteredSubdomainData<
+          Dim, OperandTags>>& operands,
+      const db::DataBox<DbTagsList>& box,
+      const std::unordered_map<std::pair<size_t, Direction<Dim>>,
+                               const BoundaryConditionsBase&,
+                               boost::hash<std::pair<size_t, Direction<Dim>>>>&
+          override_boundary_conditions = {}) const {
+    ASSERT(results->size() == operands.size(),
+           "Expected as many results as operands, but got "
+               << results->size() << " results and " << operands.size()
+               << " operands.");
+    apply_impl(gsl::make_span(*results), gsl::make_span(operands), box,
+               override_boundary_conditions);
+  }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& /*p*/) {}
+
+ private:
+  template <typename ResultTags, typename OperandTags, typename DbTagsList>
+  void apply_impl(
+      const gsl::span<
+          LinearSolver::Schwarz::ElementCenteredSubdomainData<Dim, ResultTags>>
+          results,
+      const gsl::span<const LinearSolver::Schwarz::ElementCenteredSubdomainData<
+          Dim, OperandTags>>
+          operands,
+      const db::DataBox<DbTagsList>& box,
+      const std::unordered_map<std::pair<size_t, Direction<Dim>>,
+                               const BoundaryConditionsBase&,
+                               boost::hash<std::pair<size_t, Direction<Dim>>>>&
+          override_boundary_conditions) const {
     // Used to retrieve items out of the DataBox to forward to functions. This
     // replaces a long series of db::get calls.
     const auto get_items = [](const auto&... args) {
@@ -330,166 +386,32 @@ struct SubdomainOperator
                                         fields_and_fluxes...);
         };
 
-    // Check if the subdomain data is sparse, i.e. if some elements have zero
-    // data. If they are, the operator is a lot cheaper to apply due to its
-    // linearity.
-    std::unordered_set<ElementId<Dim>> elements_in_subdomain{
-        central_element.id()};
-    std::unordered_set<ElementId<Dim>> elements_with_zero_data{};
-    if (equal_within_roundoff(operand.element_data, 0.)) {
-      elements_with_zero_data.insert(central_element.id());
-    }
-    for (const auto& [overlap_id, overlap_data] : operand.overlap_data) {
-      elements_in_subdomain.insert(overlap_id.second);
-      if (equal_within_roundoff(overlap_data, 0.)) {
-        elements_with_zero_data.insert(overlap_id.second);
-      }
-    }
-    const auto is_in_subdomain =
-        [&elements_in_subdomain](const ElementId<Dim>& element_id) {
-          return elements_in_subdomain.find(element_id) !=
-                 elements_in_subdomain.end();
-        };
-    const auto data_is_zero = [&elements_with_zero_data, &is_in_subdomain](
-                                  const ElementId<Dim>& element_id) {
-      return elements_with_zero_data.find(element_id) !=
-                 elements_with_zero_data.end() or
-             // Data outside the subdomain is zero by definition
-             not is_in_subdomain(element_id);
-    };
-    const bool central_data_is_zero = data_is_zero(central_element.id());
-
-    // The subdomain operator essentially does two sweeps over all elements in
-    // the subdomain: In the first sweep it prepares the mortar data and stores
-    // them on both sides of all mortars, and in the second sweep it consumes
-    // the mortar data to apply the operator. This implementation is relatively
-    // simple because it can re-use the implementation for the parallel DG
-    // operator. However, it is also possible to apply the subdomain operator in
-    // a single sweep over all elements, incrementally building up the mortar
-    // data and applying boundary corrections immediately to both adjacent
-    // elements once the data is available. That approach is possibly a
-    // performance optimization but requires re-implementing a lot of logic for
-    // the DG operator here. It should be considered once the subdomain operator
-    // has been identified as the performance bottleneck. An alternative to
-    // optimizing the subdomain operator performance is to precondition the
-    // subdomain solve with a _much_ simpler subdomain operator, such as a
-    // finite-difference Laplacian, so fewer applications of the more expensive
-    // DG subdomain operator are necessary.
-
-    // 1. Prepare mortar data on all elements in the subdomain and store them on
-    //    mortars, reorienting if needed
-    //
-    // Prepare central element
-    const auto apply_boundary_condition_center =
-        [&apply_boundary_condition, &local_central_element = central_element](
-            const Direction<Dim>& local_direction,
-            const auto... fields_and_fluxes) {
-          apply_boundary_condition(local_central_element.id(), local_direction,
-                                   std::false_type{}, local_direction,
-                                   fields_and_fluxes...);
-        };
-    db::apply<prepare_args_tags>(
-        [this, &operand](const auto&... args) {
-          elliptic::dg::prepare_mortar_data<System, linearized>(
-              make_not_null(&central_auxiliary_vars_),
-              make_not_null(&central_auxiliary_fluxes_),
-              make_not_null(&central_primal_fluxes_),
-              make_not_null(&central_mortar_data_), operand.element_data,
-              args...);
-        },
-        box, temporal_id, apply_boundary_condition_center, fluxes_args,
-        sources_args, fluxes_args_on_faces, data_is_zero);
-    // Prepare neighbors
+    // Retrieve the arguments on overlaps with neighbors once for all operands
+    using OverlapId = LinearSolver::Schwarz::OverlapId<Dim>;
+    using SourcesArgs = std::decay_t<decltype(sources_args)>;
+    std::unordered_map<OverlapId, FluxesArgs, boost::hash<OverlapId>>
+        fluxes_args_on_overlaps{};
+    std::unordered_map<OverlapId, SourcesArgs, boost::hash<OverlapId>>
+        sources_args_on_overlaps{};
+    std::unordered_map<OverlapId, DirectionMap<Dim, FluxesArgs>,
+                       boost::hash<OverlapId>>
+        fluxes_args_on_overlaps_faces{};
     for (const auto& [direction, neighbors] : central_element.neighbors()) {
-      const auto& orientation = neighbors.orientation();
-      const auto direction_from_neighbor = orientation(direction.opposite());
       for (const auto& neighbor_id : neighbors) {
-        const LinearSolver::Schwarz::OverlapId<Dim> overlap_id{direction,
-                                                               neighbor_id};
-        const auto& overlap_extent = all_overlap_extents.at(overlap_id);
-        const auto& neighbor = all_neighbor_elements.at(overlap_id);
-        const auto& neighbor_mesh = all_neighbor_meshes.at(overlap_id);
-        const auto& mortar_id = overlap_id;
-        const auto& mortar_mesh = central_mortar_meshes.at(mortar_id);
-        const ::dg::MortarId<Dim> mortar_id_from_neighbor{
-            direction_from_neighbor, central_element.id()};
-        const bool neighbor_data_is_zero = data_is_zero(neighbor_id);
-
-        // Intercept empty overlaps. In the unlikely case that overlaps have
-        // zero extent, meaning no point of the neighbor is part of the
-        // subdomain (which is fairly useless, except for testing), the
-        // subdomain is identical to the central element and no communication
-        // with neighbors is necessary. We can just handle the mortar between
-        // central element and neighbor and continue.
-        if (UNLIKELY(overlap_extent == 0)) {
-          const auto& mortar_mesh_from_neighbor =
-              all_neighbor_mortar_meshes.at(overlap_id)
-                  .at(mortar_id_from_neighbor);
-          const auto& mortar_size_from_neighbor =
-              all_neighbor_mortar_sizes.at(overlap_id)
-                  .at(mortar_id_from_neighbor);
-          auto remote_boundary_data =
-              elliptic::dg::zero_boundary_data_on_mortar<
-                  typename System::primal_fields,
-                  typename System::primal_fluxes>(
-                  direction_from_neighbor, neighbor_mesh,
-                  all_neighbor_face_normal_magnitudes.at(overlap_id)
-                      .at(direction_from_neighbor),
-                  mortar_mesh_from_neighbor, mortar_size_from_neighbor);
-          if (not orientation.is_aligned()) {
-            remote_boundary_data.orient_on_slice(
-                mortar_mesh_from_neighbor.extents(),
-                direction_from_neighbor.dimension(), orientation.inverse_map());
-          }
-          central_mortar_data_.at(mortar_id).remote_insert(
-              temporal_id, std::move(remote_boundary_data));
+        const OverlapId overlap_id{direction, neighbor_id};
+        if (UNLIKELY(all_overlap_extents.at(overlap_id) == 0)) {
           continue;
         }
-
-        // Copy the central element's mortar data to the neighbor
-        if (not(central_data_is_zero and neighbor_data_is_zero)) {
-          auto oriented_mortar_data =
-              central_mortar_data_.at(mortar_id).local_data(temporal_id);
-          if (not orientation.is_aligned()) {
-            oriented_mortar_data.orient_on_slice(
-                mortar_mesh.extents(), direction.dimension(), orientation);
-          }
-          neighbors_mortar_data_[overlap_id][::dg::MortarId<Dim>{
-                                                 direction_from_neighbor,
-                                                 central_element.id()}]
-              .remote_insert(temporal_id, std::move(oriented_mortar_data));
-        }
-
-        // Now we switch perspective to the neighbor. First, we extend the
-        // overlap data to the full neighbor mesh by padding it with zeros. This
-        // is necessary because spectral operators such as derivatives require
-        // data on the full mesh.
-        if (not neighbor_data_is_zero) {
-          LinearSolver::Schwarz::extended_overlap_data(
-              make_not_null(&extended_operand_vars_[overlap_id]),
-              operand.overlap_data.at(overlap_id), neighbor_mesh.extents(),
-              overlap_extent, direction_from_neighbor);
-        }
-
-        const auto apply_boundary_condition_neighbor =
-            [&apply_boundary_condition, &local_neighbor_id = neighbor_id,
-             &overlap_id](const Direction<Dim>& local_direction,
-                          const auto... fields_and_fluxes) {
-              apply_boundary_condition(
-                  local_neighbor_id, local_direction, std::true_type{},
-                  std::forward_as_tuple(overlap_id, local_direction),
-                  fields_and_fluxes...);
-            };
-
-        const auto fluxes_args_on_overlap =
-            elliptic::util::apply_at<fluxes_args_tags_overlap,
-                                     args_tags_from_center>(get_items, box,
-                                                            overlap_id);
-        const auto sources_args_on_overlap =
-            elliptic::util::apply_at<sources_args_tags_overlap,
-                                     args_tags_from_center>(get_items, box,
-                                                            overlap_id);
-        DirectionMap<Dim, FluxesArgs> fluxes_args_on_overlap_faces{};
+        fluxes_args_on_overlaps.emplace(
+            overlap_id, elliptic::util::apply_at<fluxes_args_tags_overlap,
+                                                 args_tags_from_center>(
+                            get_items, box, overlap_id));
+        sources_args_on_overlaps.emplace(
+            overlap_id, elliptic::util::apply_at<sources_args_tags_overlap,
+                                                 args_tags_from_center>(
+                            get_items, box, overlap_id));
+        auto& fluxes_args_on_overlap_faces =
+            fluxes_args_on_overlaps_faces[overlap_id];
         for (const auto& neighbor_direction :
              Direction<Dim>::all_directions()) {
           fluxes_args_on_overlap_faces.emplace(
@@ -499,208 +421,374 @@ struct SubdomainOperator
                   get_items, box,
                   std::forward_as_tuple(overlap_id, neighbor_direction)));
         }
+      }
+    }
 
-        elliptic::util::apply_at<prepare_args_tags_overlap,
-                                 args_tags_from_center>(
-            [this, &overlap_id](const auto&... args) {
-              elliptic::dg::prepare_mortar_data<System, linearized>(
-                  make_not_null(&neighbors_auxiliary_vars_[overlap_id]),
-                  make_not_null(&neighbors_auxiliary_fluxes_[overlap_id]),
-                  make_not_null(&neighbors_primal_fluxes_[overlap_id]),
-                  make_not_null(&neighbors_mortar_data_[overlap_id]),
-                  extended_operand_vars_[overlap_id], args...);
-            },
-            box, overlap_id, temporal_id, apply_boundary_condition_neighbor,
-            fluxes_args_on_overlap, sources_args_on_overlap,
-            fluxes_args_on_overlap_faces, data_is_zero);
-
-        // Copy this neighbor's mortar data to the other side of the mortars. On
-        // the other side we either have the central element, or another element
-        // that may or may not be part of the subdomain.
-        const auto& neighbor_mortar_meshes =
-            all_neighbor_mortar_meshes.at(overlap_id);
-        for (const auto& neighbor_mortar_id_and_data :
-             neighbors_mortar_data_.at(overlap_id)) {
-          // No structured bindings because capturing these in lambdas doesn't
-          // work until C++20
-          const auto& neighbor_mortar_id = neighbor_mortar_id_and_data.first;
-          const auto& neighbor_mortar_data = neighbor_mortar_id_and_data.second;
-          const auto& neighbor_direction = neighbor_mortar_id.first;
-          const auto& neighbors_neighbor_id = neighbor_mortar_id.second;
-          // No need to do anything on external boundaries
-          if (neighbors_neighbor_id == ElementId<Dim>::external_boundary_id()) {
+    for (size_t operand_index = 0; operand_index < operands.size();
+         ++operand_index) {
+      const auto result = make_not_null(&results[operand_index]);
+      const auto& operand = operands[operand_index];
+
+      // Check if the subdomain data is sparse, i.e. if some elements have zero
+      // data. If they are, the operator is a lot cheaper to apply due to its
+      // linearity.
+      std::unordered_set<ElementId<Dim>> elements_in_subdomain{
+          central_element.id()};
+      std::unordered_set<ElementId<Dim>> elements_with_zero_data{};
+      if (equal_within_roundoff(operand.element_data, 0.)) {
+        elements_with_zero_data.insert(central_element.id());
+      }
+      for (const auto& [overlap_id, overlap_data] : operand.overlap_data) {
+        elements_in_subdomain.insert(overlap_id.second);
+        if (equal_within_roundoff(overlap_data, 0.)) {
+          elements_with_zero_data.insert(overlap_id.second);
+        }
+      }
+      const auto is_in_subdomain =
+          [&elements_in_subdomain](const ElementId<Dim>& element_id) {
+            return elements_in_subdomain.find(element_id) !=
+                   elements_in_subdomain.end();
+          };
+      const auto data_is_zero = [&elements_with_zero_data, &is_in_subdomain](
+                                    const ElementId<Dim>& element_id) {
+        return elements_with_zero_data.find(element_id) !=
+                   elements_with_zero_data.end() or
+               // Data outside the subdomain is zero by definition
+               not is_in_subdomain(element_id);
+      };
+      const bool central_data_is_zero = data_is_zero(central_element.id());
+
+      // The subdomain operator essentially does two sweeps over all elements in
+      // the subdomain: In the first sweep it prepares the mortar data and
+      // stores them on both sides of all mortars, and in the second sweep it
+      // consumes the mortar data to apply the operator. This implementation is
+      // relatively simple because it can re-use the implementation for the
+      // parallel DG operator. However, it is also possible to apply the
+      // subdomain operator in a single sweep over all elements, incrementally
+      // building up the mortar data and applying boundary corrections
+      // immediately to both adjacent elements once the data is available. That
+      // approach is possibly a performance optimization but requires
+      // re-implementing a lot of logic for the DG operator here. It should be
+      // considered once the subdomain operator has been identified as the
+      // performance bottleneck. An alternative to optimizing the subdomain
+      // operator performance is to precondition the subdomain solve with a
+      // _much_ simpler subdomain operator, such as a finite-difference
+      // Laplacian, so fewer applications of the more expensive DG subdomain
+      // operator are necessary.
+
+      // 1. Prepare mortar data on all elements in the subdomain and store them
+      //    on mortars, reorienting if needed
+      //
+      // Prepare central element
+      const auto apply_boundary_condition_center =
+          [&apply_boundary_condition, &local_central_element = central_element](
+              const Direction<Dim>& local_direction,
+              const auto... fields_and_fluxes) {
+            apply_boundary_condition(local_central_element.id(),
+                                     local_direction, std::false_type{},
+                                     local_direction, fields_and_fluxes...);
+          };
+      db::apply<prepare_args_tags>(
+          [this, &operand](const auto&... args) {
+            elliptic::dg::prepare_mortar_data<System, linearized>(
+                make_not_null(&central_auxiliary_vars_),
+                make_not_null(&central_auxiliary_fluxes_),
+                make_not_null(&central_primal_fluxes_),
+                make_not_null(&central_mortar_data_), operand.element_data,
+                args...);
+          },
+          box, temporal_id, apply_boundary_condition_center, fluxes_args,
+          sources_args, fluxes_args_on_faces, data_is_zero);
+      // Prepare neighbors
+      for (const auto& [direction, neighbors] : central_element.neighbors()) {
+        const auto& orientation = neighbors.orientation();
+        const auto direction_from_neighbor = orientation(direction.opposite());
+        for (const auto& neighbor_id : neighbors) {
+          const LinearSolver::Schwarz::OverlapId<Dim> overlap_id{direction,
+                                                                 neighbor_id};
+          const auto& overlap_extent = all_overlap_extents.at(overlap_id);
+          const auto& neighbor = all_neighbor_elements.at(overlap_id);
+          const auto& neighbor_mesh = all_neighbor_meshes.at(overlap_id);
+          const auto& mortar_id = overlap_id;
+          const auto& mortar_mesh = central_mortar_meshes.at(mortar_id);
+          const ::dg::MortarId<Dim> mortar_id_from_neighbor{
+              direction_from_neighbor, central_element.id()};
+          const bool neighbor_data_is_zero = data_is_zero(neighbor_id);
+
+          // Intercept empty overlaps. In the unlikely case that overlaps have
+          // zero extent, meaning no point of the neighbor is part of the
+          // subdomain (which is fairly useless, except for testing), the
+          // subdomain is identical to the central element and no communication
+          // with neighbors is necessary. We can just handle the mortar between
+          // central element and neighbor and continue.
+          if (UNLIKELY(overlap_extent == 0)) {
+            const auto& mortar_mesh_from_neighbor =
+                all_neighbor_mortar_meshes.at(overlap_id)
+                    .at(mortar_id_from_neighbor);
+            const auto& mortar_size_from_neighbor =
+                all_neighbor_mortar_sizes.at(overlap_id)
+                    .at(mortar_id_from_neighbor);
+            auto remote_boundary_data =
+                elliptic::dg::zero_boundary_data_on_mortar<
+                    typename System::primal_fields,
+                    typename System::primal_fluxes>(
+                    direction_from_neighbor, neighbor_mesh,
+                    all_neighbor_face_normal_magnitudes.at(overlap_id)
+                        .at(direction_from_neighbor),
+                    mortar_mesh_from_neighbor, mortar_size_from_neighbor);
+            if (not orientation.is_aligned()) {
+              remote_boundary_data.orient_on_slice(
+                  mortar_mesh_from_neighbor.extents(),
+                  direction_from_neighbor.dimension(),
+                  orientation.inverse_map());
+            }
+            central_mortar_data_.at(mortar_id).remote_insert(
+                temporal_id, std::move(remote_boundary_data));
             continue;
           }
-          const auto& neighbor_orientation =
-              neighbor.neighbors().at(neighbor_direction).orientation();
-          const auto neighbors_neighbor_direction =
-              neighbor_orientation(neighbor_direction.opposite());
-          const ::dg::MortarId<Dim> mortar_id_from_neighbors_neighbor{
-              neighbors_neighbor_direction, neighbor_id};
-          const auto send_mortar_data =
-              [&neighbor_orientation, &neighbor_mortar_meshes,
-               &neighbor_mortar_data, &neighbor_mortar_id, &neighbor_direction,
-               &neighbor_data_is_zero,
-               &data_is_zero](auto& remote_mortar_data,
-                              const ElementId<Dim>& remote_element_id) {
-                if (neighbor_data_is_zero and data_is_zero(remote_element_id)) {
-                  return;
-                }
-                const auto& neighbor_mortar_mesh =
-                    neighbor_mortar_meshes.at(neighbor_mortar_id);
-                auto oriented_neighbor_mortar_data =
-                    neighbor_mortar_data.local_data(temporal_id);
-                if (not neighbor_orientation.is_aligned()) {
-                  oriented_neighbor_mortar_data.orient_on_slice(
-                      neighbor_mortar_mesh.extents(),
-                      neighbor_direction.dimension(), neighbor_orientation);
-                }
-                remote_mortar_data.remote_insert(
-                    temporal_id, std::move(oriented_neighbor_mortar_data));
-              };
-          if (neighbors_neighbor_id == central_element.id() and
-              mortar_id_from_neighbors_neighbor == mortar_id) {
-            send_mortar_data(central_mortar_data_.at(mortar_id),
-                             central_element.id());
-            continue;
+
+          // Copy the central element's mortar data to the neighbor
+          if (not(central_data_is_zero and neighbor_data_is_zero)) {
+            auto oriented_mortar_data =
+                central_mortar_data_.at(mortar_id).local_data(temporal_id);
+            if (not orientation.is_aligned()) {
+              oriented_mortar_data.orient_on_slice(
+                  mortar_mesh.extents(), direction.dimension(), orientation);
+            }
+            neighbors_mortar_data_[overlap_id][::dg::MortarId<Dim>{
+                                                   direction_from_neighbor,
+                                                   central_element.id()}]
+                .remote_insert(temporal_id, std::move(oriented_mortar_data));
           }
-          // Determine whether the neighbor's neighbor overlaps with the
-          // subdomain and find its overlap ID if it does.
-          const auto neighbors_neighbor_overlap_id =
-              [&local_all_neighbor_mortar_meshes = all_neighbor_mortar_meshes,
-               &neighbors_neighbor_id, &mortar_id_from_neighbors_neighbor,
-               &is_in_subdomain]()
-              -> std::optional<LinearSolver::Schwarz::OverlapId<Dim>> {
-            if (not is_in_subdomain(neighbors_neighbor_id)) {
-              return std::nullopt;
+
+          // Now we switch perspective to the neighbor. First, we extend the
+          // overlap data to the full neighbor mesh by padding it with zeros.
+          // This is necessary because spectral operators such as derivatives
+          // require data on the full mesh.
+          if (not neighbor_data_is_zero) {
+            LinearSolver::Schwarz::extended_overlap_data(
+                make_not_null(&extended_operand_vars_[overlap_id]),
+                operand.overlap_data.at(overlap_id), neighbor_mesh.extents(),
+                overlap_extent, direction_from_neighbor);
+          }
+
+          const auto apply_boundary_condition_neighbor =
+              [&apply_boundary_condition, &local_neighbor_id = neighbor_id,
+               &overlap_id](const Direction<Dim>& local_direction,
+                            const auto... fields_and_fluxes) {
+                apply_boundary_condition(
+                    local_neighbor_id, local_direction, std::true_type{},
+                    std::forward_as_tuple(overlap_id, local_direction),
+                    fields_and_fluxes...);
+              };
+
+          elliptic::util::apply_at<prepare_args_tags_overlap,
+                                   args_tags_from_center>(
+              [this, &overlap_id](const auto&... args) {
+                elliptic::dg::prepare_mortar_data<System, linearized>(
+                    make_not_null(&neighbors_auxiliary_vars_[overlap_id]),
+                    make_not_null(&neighbors_auxiliary_fluxes_[overlap_id]),
+                    make_not_null(&neighbors_primal_fluxes_[overlap_id]),
+                    make_not_null(&neighbors_mortar_data_[overlap_id]),
+                    extended_operand_vars_[overlap_id], args...);
+              },
+              box, overlap_id, temporal_id, apply_boundary_condition_neighbor,
+              fluxes_args_on_overlaps.at(overlap_id),
+              sources_args_on_overlaps.at(overlap_id),
+              fluxes_args_on_overlaps_faces.at(overlap_id), data_is_zero);
+
+          // Copy this neighbor's mortar data to the other side of the mortars.
+          // On the other side we either have the central element, or another
+          // element that may or may not be part of the subdomain.
+          const auto& neighbor_mortar_meshes =
+              all_neighbor_mortar_meshes.at(overlap_id);
+          for (const auto& neighbor_mortar_id_and_data :
+               neighbors_mortar_data_.at(overlap_id)) {
+            // No structured bindings because capturing these in lambdas doesn't
+            // work until C++20
+            const auto& neighbor_mortar_id = neighbor_mortar_id_and_data.first;
+            const auto& neighbor_mortar_data =
+                neighbor_mortar_id_and_data.second;
+            const auto& neighbor_direction = neighbor_mortar_id.first;
+            const auto& neighbors_neighbor_id = neighbor_mortar_id.second;
+            // No need to do anything on external boundaries
+            if (neighbors_neighbor_id ==
+                ElementId<Dim>::external_boundary_id()) {
+              continue;
             }
-            for (const auto& [local_overlap_id, local_mortar_meshes] :
-                 local_all_neighbor_mortar_meshes) {
-              if (local_overlap_id.second != neighbors_neighbor_id) {
-                continue;
+            const auto& neighbor_orientation =
+                neighbor.neighbors().at(neighbor_direction).orientation();
+            const auto neighbors_neighbor_direction =
+                neighbor_orientation(neighbor_direction.opposite());
+            const ::dg::MortarId<Dim> mortar_id_from_neighbors_neighbor{
+                neighbors_neighbor_direction, neighbor_id};
+            const auto send_mortar_data =
+                [&neighbor_orientation, &neighbor_mortar_meshes,
+                 &neighbor_mortar_data, &neighbor_mortar_id,
+                 &neighbor_direction, &neighbor_data_is_zero,
+                 &data_is_zero](auto& remote_mortar_data,
+                                const ElementId<Dim>& remote_element_id) {
+                  if (neighbor_data_is_zero and
+                      data_is_zero(remote_element_id)) {
+                    return;
+                  }
+                  const auto& neighbor_mortar_mesh =
+                      neighbor_mortar_meshes.at(neighbor_mortar_id);
+                  auto oriented_neighbor_mortar_data =
+                      neighbor_mortar_data.local_data(temporal_id);
+                  if (not neighbor_orientation.is_aligned()) {
+                    oriented_neighbor_mortar_data.orient_on_slice(
+                        neighbor_mortar_mesh.extents(),
+                        neighbor_direction.dimension(), neighbor_orientation);
+                  }
+                  remote_mortar_data.remote_insert(
+                      temporal_id, std::move(oriented_neighbor_mortar_data));
+                };
+            if (neighbors_neighbor_id == central_element.id() and
+                mortar_id_from_neighbors_neighbor == mortar_id) {
+              send_mortar_data(central_mortar_data_.at(mortar_id),
+                               central_element.id());
+              continue;
+            }
+            // Determine whether the neighbor's neighbor overlaps with the
+            // subdomain and find its overlap ID if it does.
+            const auto neighbors_neighbor_overlap_id =
+                [&local_all_neighbor_mortar_meshes = all_neighbor_mortar_meshes,
+                 &neighbors_neighbor_id, &mortar_id_from_neighbors_neighbor,
+                 &is_in_subdomain]()
+                -> std::optional<LinearSolver::Schwarz::OverlapId<Dim>> {
+              if (not is_in_subdomain(neighbors_neighbor_id)) {
+                return std::nullopt;
               }
-              for (const auto& local_mortar_id_and_mesh : local_mortar_meshes) {
-                if (local_mortar_id_and_mesh.first ==
-                    mortar_id_from_neighbors_neighbor) {
-                  return local_overlap_id;
+              for (const auto& [local_overlap_id, local_mortar_meshes] :
+                   local_all_neighbor_mortar_meshes) {
+                if (local_overlap_id.second != neighbors_neighbor_id) {
+                  continue;
+                }
+                for (const auto& local_mortar_id_and_mesh :
+                     local_mortar_meshes) {
+                  if (local_mortar_id_and_mesh.first ==
+                      mortar_id_from_neighbors_neighbor) {
+                    return local_overlap_id;
+                  }
                 }
               }
+              ERROR("The neighbor's neighbor "
+                    << neighbors_neighbor_id
+                    << " is part of the subdomain, but we didn't find its "
+                       "overlap ID. This is a bug, so please file an issue.");
+            }();
+            if (neighbors_neighbor_overlap_id.has_value()) {
+              // The neighbor's neighbor is part of the subdomain so we copy the
+              // mortar data over. Once the loop is complete we will also have
+              // received mortar data back. At that point, both neighbors have a
+              // copy of each other's mortar data, which is the subject of the
+              // possible optimizations mentioned above. Note that the data may
+              // differ by orientations.
+              send_mortar_data(
+                  neighbors_mortar_data_[*neighbors_neighbor_overlap_id]
+                                        [mortar_id_from_neighbors_neighbor],
+                  neighbors_neighbor_overlap_id->second);
+            } else if (not neighbor_data_is_zero) {
+              // The neighbor's neighbor does not overlap with the subdomain, so
+              // we don't copy mortar data and also don't expect to receive any.
+              // Instead, we assume the data on it is zero and manufacture
+              // appropriate remote boundary data.
+              const auto& neighbors_neighbor_mortar_mesh =
+                  all_neighbors_neighbor_mortar_meshes.at(overlap_id)
+                      .at(neighbor_mortar_id);
+              auto zero_mortar_data =
+                  elliptic::dg::zero_boundary_data_on_mortar<
+                      typename System::primal_fields,
+                      typename System::primal_fluxes>(
+                      neighbors_neighbor_direction,
+                      all_neighbors_neighbor_meshes.at(overlap_id)
+                          .at(neighbor_mortar_id),
+                      all_neighbors_neighbor_face_normal_magnitudes
+                          .at(overlap_id)
+                          .at(neighbor_mortar_id),
+                      neighbors_neighbor_mortar_mesh,
+                      all_neighbors_neighbor_mortar_sizes.at(overlap_id)
+                          .at(neighbor_mortar_id));
+              // The data is zero, but auxiliary quantities such as the face
+              // normal magnitude may need re-orientation
+              if (not neighbor_orientation.is_aligned()) {
+                zero_mortar_data.orient_on_slice(
+                    neighbors_neighbor_mortar_mesh.extents(),
+                    neighbors_neighbor_direction.dimension(),
+                    neighbor_orientation.inverse_map());
+              }
+              neighbors_mortar_data_.at(overlap_id)
+                  .at(neighbor_mortar_id)
+                  .remote_insert(temporal_id, std::move(zero_mortar_data));
             }
-            ERROR("The neighbor's neighbor "
-                  << neighbors_neighbor_id
-                  << " is part of the subdomain, but we didn't find its "
-                     "overlap ID. This is a bug, so please file an issue.");
-          }();
-          if (neighbors_neighbor_overlap_id.has_value()) {
-            // The neighbor's neighbor is part of the subdomain so we copy the
-            // mortar data over. Once the loop is complete we will also have
-            // received mortar data back. At that point, both neighbors have a
-            // copy of each other's mortar data, which is the subject of the
-            // possible optimizations mentioned above. Note that the data may
-            // differ by orientations.
-            send_mortar_data(
-                neighbors_mortar_data_[*neighbors_neighbor_overlap_id]
-                                      [mortar_id_from_neighbors_neighbor],
-                neighbors_neighbor_overlap_id->second);
-          } else if (not neighbor_data_is_zero) {
-            // The neighbor's neighbor does not overlap with the subdomain, so
-            // we don't copy mortar data and also don't expect to receive any.
-            // Instead, we assume the data on it is zero and manufacture
-            // appropriate remote boundary data.
-            const auto& neighbors_neighbor_mortar_mesh =
-                all_neighbors_neighbor_mortar_meshes.at(overlap_id)
-                    .at(neighbor_mortar_id);
-            auto zero_mortar_data = elliptic::dg::zero_boundary_data_on_mortar<
-                typename System::primal_fields, typename System::primal_fluxes>(
-                neighbors_neighbor_direction,
-                all_neighbors_neighbor_meshes.at(overlap_id)
-                    .at(neighbor_mortar_id),
-                all_neighbors_neighbor_face_normal_magnitudes.at(overlap_id)
-                    .at(neighbor_mortar_id),
-                neighbors_neighbor_mortar_mesh,
-                all_neighbors_neighbor_mortar_sizes.at(overlap_id)
-                    .at(neighbor_mortar_id));
-            // The data is zero, but auxiliary quantities such as the face
-            // normal magnitude may need re-orientation
-            if (not neighbor_orientation.is_aligned()) {
-              zero_mortar_data.orient_on_slice(
-                  neighbors_neighbor_mortar_mesh.extents(),
-                  neighbors_neighbor_direction.dimension(),
-                  neighbor_orientation.inverse_map());
-            }
-            neighbors_mortar_data_.at(overlap_id)
-                .at(neighbor_mortar_id)
-                .remote_insert(temporal_id, std::move(zero_mortar_data));
+          }  // loop over neighbor's mortars
+        }    // loop over neighbors
+      }      // loop over directions
+
+      // 2. Apply the operator on all elements in the subdomain
+      //
+      // Apply on central element
+      db::apply<apply_args_tags>(
+          [this, &result, &operand](const auto&... args) {
+            elliptic::dg::apply_operator<System, linearized>(
+                make_not_null(&result->element_data),
+                make_not_null(&central_primal_fluxes_corrected_),
+                make_not_null(&central_mortar_data_), operand.element_data,
+                central_primal_fluxes_, args...);
+          },
+          box, temporal_id, sources_args, data_is_zero);
+      // Apply on neighbors
+      for (const auto& [direction, neighbors] : central_element.neighbors()) {
+        const auto& orientation = neighbors.orientation();
+        const auto direction_from_neighbor = orientation(direction.opposite());
+        for (const auto& neighbor_id : neighbors) {
+          const LinearSolver::Schwarz::OverlapId<Dim> overlap_id{direction,
+                                                                 neighbor_id};
+          const auto& overlap_extent = all_overlap_extents.at(overlap_id);
+          const auto& neighbor_mesh = all_neighbor_meshes.at(overlap_id);
+
+          if (UNLIKELY(overlap_extent == 0)) {
+            continue;
           }
-        }  // loop over neighbor's mortars
-      }    // loop over neighbors
-    }      // loop over directions
-
-    // 2. Apply the operator on all elements in the subdomain
-    //
-    // Apply on central element
-    db::apply<apply_args_tags>(
-        [this, &result, &operand](const auto&... args) {
-          elliptic::dg::apply_operator<System, linearized>(
-              make_not_null(&result->element_data),
-              make_not_null(&central_mortar_data_), operand.element_data,
-              central_primal_fluxes_, args...);
-        },
-        box, temporal_id, sources_args, data_is_zero);
-    // Apply on neighbors
-    for (const auto& [direction, neighbors] : central_element.neighbors()) {
-      const auto& orientation = neighbors.orientation();
-      const auto direction_from_neighbor = orientation(direction.opposite());
-      for (const auto& neighbor_id : neighbors) {
-        const LinearSolver::Schwarz::OverlapId<Dim> overlap_id{direction,
-                                                               neighbor_id};
-        const auto& overlap_extent = all_overlap_extents.at(overlap_id);
-        const auto& neighbor_mesh = all_neighbor_meshes.at(overlap_id);
 
-        if (UNLIKELY(overlap_extent == 0)) {
-          continue;
-        }
-
-        elliptic::util::apply_at<apply_args_tags_overlap,
-                                 args_tags_from_center>(
-            [this, &overlap_id](const auto&... args) {
-              elliptic::dg::apply_operator<System, linearized>(
-                  make_not_null(&extended_results_[overlap_id]),
-                  make_not_null(&neighbors_mortar_data_.at(overlap_id)),
-                  extended_operand_vars_.at(overlap_id),
-                  neighbors_primal_fluxes_.at(overlap_id), args...);
-            },
-            box, overlap_id, temporal_id,
-            elliptic::util::apply_at<sources_args_tags_overlap,
-                                     args_tags_from_center>(get_items, box,
-                                                            overlap_id),
-            data_is_zero);
-
-        // Restrict the extended operator data back to the subdomain, assuming
-        // we can discard any data outside the overlaps. WARNING: This
-        // assumption may break with changes to the DG operator that affect its
-        // sparsity. For example, multiplying the DG operator with the _full_
-        // inverse mass-matrix ("massless" scheme with no "mass-lumping"
-        // approximation) means that lifted boundary corrections bleed into the
-        // volume.
-        if (UNLIKELY(
-                result->overlap_data[overlap_id].number_of_grid_points() !=
-                operand.overlap_data.at(overlap_id).number_of_grid_points())) {
-          result->overlap_data[overlap_id].initialize(
-              operand.overlap_data.at(overlap_id).number_of_grid_points());
-        }
-        LinearSolver::Schwarz::data_on_overlap(
-            make_not_null(&result->overlap_data[overlap_id]),
-            extended_results_.at(overlap_id), neighbor_mesh.extents(),
-            overlap_extent, direction_from_neighbor);
-      }  // loop over neighbors
-    }    // loop over directions
+          elliptic::util::apply_at<apply_args_tags_overlap,
+                                   args_tags_from_center>(
+              [this, &overlap_id](const auto&... args) {
+                elliptic::dg::apply_operator<System, linearized>(
+                    make_not_null(&extended_results_[overlap_id]),
+                    make_not_null(
+                        &neighbors_primal_fluxes_corrected_[overlap_id]),
+                    make_not_null(&neighbors_mortar_data_.at(overlap_id)),
+                    extended_operand_vars_.at(overlap_id),
+                    neighbors_primal_fluxes_.at(overlap_id), args...);
+              },
+              box, overlap_id, temporal_id,
+              sources_args_on_overlaps.at(overlap_id), data_is_zero);
+
+          // Restrict the extended operator data back to the subdomain, assuming
+          // we can discard any data outside the overlaps. WARNING: This
+          // assumption may break with changes to the DG operator that affect
+          // its sparsity. For example, multiplying the DG operator with the
+          // _full_ inverse mass-matrix ("massless" scheme with no
+          // "mass-lumping" approximation) means that lifted boundary
+          // corrections bleed into the volume.
+          if (UNLIKELY(
+                  result->overlap_data[overlap_id].number_of_grid_points() !=
+                  operand.overlap_data.at(overlap_id)
+                      .number_of_grid_points())) {
+            result->overlap_data[overlap_id].initialize(
+                operand.overlap_data.at(overlap_id).number_of_grid_points());
+          }
+          LinearSolver::Schwarz::data_on_overlap(
+              make_not_null(&result->overlap_data[overlap_id]),
+              extended_results_.at(overlap_id), neighbor_mesh.extents(),
+              overlap_extent, direction_from_neighbor);
+        }  // loop over neighbors
+      }    // loop over directions
+    }  // loop over operands
   }
 
-  // NOLINTNEXTLINE(google-runtime-references)
-  void pup(PUP::er& /*p*/) {}
-
- private:
   // Memory buffers for repeated operator applications
   // NOLINTNEXTLINE(spectre-mutable)
   mutable Variables<typename System::auxiliary_fields>
@@ -708,6 +796,9 @@ struct SubdomainOperator
   // NOLINTNEXTLINE(spectre-mutable)
   mutable Variables<typename System::primal_fluxes> central_primal_fluxes_{};
   // NOLINTNEXTLINE(spectre-mutable)
+  mutable Variables<typename System::primal_fluxes>
+      central_primal_fluxes_corrected_{};
+  // NOLINTNEXTLINE(spectre-mutable)
   mutable Variables<typename System::auxiliary_fluxes>
       central_auxiliary_fluxes_{};
   // NOLINTNEXTLINE(spectre-mutable)
@@ -719,6 +810,10 @@ struct SubdomainOperator
       Dim, Variables<typename System::primal_fluxes>>
       neighbors_primal_fluxes_{};
   // NOLINTNEXTLINE(spectre-mutable)
+  mutable LinearSolver::Schwarz::OverlapMap<
+      Dim, Variables<typename System::primal_fluxes>>
+      neighbors_primal_fluxes_corrected_{};
+  // NOLINTNEXTLINE(spectre-mutable)
   mutable LinearSolver::Schwarz::OverlapMap<
       Dim, Variables<typename System::auxiliary_fluxes>>
       neighbors_auxiliary_fluxes_{};
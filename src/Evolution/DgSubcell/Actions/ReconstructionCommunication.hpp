@@ -24,6 +24,7 @@
 #include "DataStructures/Variables.hpp"
 #include "DataStructures/VariablesTag.hpp"
 #include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionalIdMap.hpp"
 #include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/MaxNumberOfNeighbors.hpp"
@@ -157,7 +158,13 @@ struct SendDataForReconstruction {
              "evolution is using DG without any changes to subcell.");
 
       for (const ElementId<Dim>& neighbor : neighbors_in_direction) {
+        // Reserve space for the whole message so appending the RDMP TCI
+        // data after (re)orienting the ghost data does not reallocate.
         std::vector<double> subcell_data_to_send{};
+        subcell_data_to_send.reserve(
+            all_sliced_data.at(direction).size() +
+            rdmp_tci_data.max_variables_values.size() +
+            rdmp_tci_data.min_variables_values.size());
         if (not orientation.is_aligned()) {
           std::array<size_t, Dim> slice_extents{};
           for (size_t d = 0; d < Dim; ++d) {
@@ -165,11 +172,12 @@ struct SendDataForReconstruction {
           }
           gsl::at(slice_extents, direction.dimension()) = ghost_zone_size;
 
-          subcell_data_to_send =
-              orient_variables(all_sliced_data.at(direction),
-                               Index<Dim>{slice_extents}, orientation);
+          orient_variables(make_not_null(&subcell_data_to_send),
+                           all_sliced_data.at(direction),
+                           Index<Dim>{slice_extents}, orientation);
         } else {
-          subcell_data_to_send = all_sliced_data.at(direction);
+          subcell_data_to_send.assign(all_sliced_data.at(direction).begin(),
+                                      all_sliced_data.at(direction).end());
         }
         subcell_data_to_send.insert(subcell_data_to_send.end(),
                                     rdmp_tci_data.max_variables_values.cbegin(),
@@ -293,11 +301,10 @@ struct ReceiveDataForReconstruction {
                 boost::hash<std::pair<Direction<Dim>, ElementId<Dim>>>>*>
                 neighbor_data_ptr,
             const gsl::not_null<RdmpTciData*> rdmp_tci_data_ptr,
-            const gsl::not_null<std::unordered_map<
-                Key, evolution::dg::MortarData<Dim>, boost::hash<Key>>*>
-                mortar_data,
             const gsl::not_null<
-                std::unordered_map<Key, TimeStepId, boost::hash<Key>>*>
+                DirectionalIdMap<Dim, evolution::dg::MortarData<Dim>>*>
+                mortar_data,
+            const gsl::not_null<DirectionalIdMap<Dim, TimeStepId>*>
                 mortar_next_time_step_id) {
           // Get the next time step id, and also the fluxes data if the neighbor
           // is doing DG.
@@ -4,9 +4,7 @@
 #pragma once
 
 #include <algorithm>
-#include <boost/functional/hash.hpp>
 #include <cstddef>
-#include <unordered_map>
 #include <utility>
 
 #include "DataStructures/DataVector.hpp"
@@ -15,6 +13,7 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionalIdMap.hpp"
 #include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Evolution/DgSubcell/Projection.hpp"
@@ -71,10 +70,7 @@ void correct_package_data(
     const gsl::not_null<Variables<DgPackageFieldTags>*> upper_packaged_data,
     const size_t logical_dimension_to_operate_in, const Element<Dim>& element,
     const Mesh<Dim>& subcell_volume_mesh,
-    const std::unordered_map<
-        std::pair<Direction<Dim>, ElementId<Dim>>,
-        evolution::dg::MortarData<Dim>,
-        boost::hash<std::pair<Direction<Dim>, ElementId<Dim>>>>& mortar_data) {
+    const DirectionalIdMap<Dim, evolution::dg::MortarData<Dim>>& mortar_data) {
   const Direction<Dim> upper_direction{logical_dimension_to_operate_in,
                                        Side::Upper};
   const Direction<Dim> lower_direction{logical_dimension_to_operate_in,
@@ -86,9 +86,18 @@ prepare_neighbor_data(const gsl::not_null<db::DataBox<DbTagsList>*> box) {
 
       gsl::at(slice_extents, direction.dimension()) = ghost_zone_size;
 
+      // Orient directly into a buffer with room for the RDMP TCI data so that
+      // appending it below does not copy the oriented data again.
+      std::vector<double> oriented_data{};
+      oriented_data.reserve(
+          all_neighbor_data_for_reconstruction.at(direction).size() +
+          rdmp_data.max_variables_values.size() +
+          rdmp_data.min_variables_values.size());
+      orient_variables(make_not_null(&oriented_data),
+                       all_neighbor_data_for_reconstruction.at(direction),
+                       Index<volume_dim>{slice_extents}, orientation);
       all_neighbor_data_for_reconstruction.at(direction) =
-          orient_variables(all_neighbor_data_for_reconstruction.at(direction),
-                           Index<volume_dim>{slice_extents}, orientation);
+          std::move(oriented_data);
     }
 
     // Add the RDMP TCI data to what we will be sending.
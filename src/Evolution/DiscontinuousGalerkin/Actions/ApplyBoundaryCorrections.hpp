@@ -16,6 +16,7 @@
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
 #include "Domain/FaceNormal.hpp"
+#include "Domain/Structure/DirectionalIdMap.hpp"
 #include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
@@ -118,11 +119,10 @@ bool receive_boundary_data_global_time_stepping(
              evolution::dg::Tags::MortarNextTemporalId<volume_dim>>(
       box,
       [&received_temporal_id_and_data](
-          const gsl::not_null<std::unordered_map<
-              Key, evolution::dg::MortarData<volume_dim>, boost::hash<Key>>*>
+          const gsl::not_null<DirectionalIdMap<
+              volume_dim, evolution::dg::MortarData<volume_dim>>*>
               mortar_data,
-          const gsl::not_null<
-              std::unordered_map<Key, TimeStepId, boost::hash<Key>>*>
+          const gsl::not_null<DirectionalIdMap<volume_dim, TimeStepId>*>
               mortar_next_time_step_id) {
         for (auto& received_mortar_data :
              received_temporal_id_and_data->second) {
@@ -207,16 +207,13 @@ bool receive_boundary_data_local_time_stepping(
                  evolution::dg::Tags::MortarNextTemporalId<volume_dim>>(
           box,
           [&inbox, &needed_time](
-              const gsl::not_null<
-                  std::unordered_map<Key,
-                                     TimeSteppers::BoundaryHistory<
-                                         evolution::dg::MortarData<volume_dim>,
-                                         evolution::dg::MortarData<volume_dim>,
-                                         typename dt_variables_tag::type>,
-                                     boost::hash<Key>>*>
+              const gsl::not_null<DirectionalIdMap<
+                  volume_dim, TimeSteppers::BoundaryHistory<
+                                  evolution::dg::MortarData<volume_dim>,
+                                  evolution::dg::MortarData<volume_dim>,
+                                  typename dt_variables_tag::type>>*>
                   boundary_data_history,
-              const gsl::not_null<
-                  std::unordered_map<Key, TimeStepId, boost::hash<Key>>*>
+              const gsl::not_null<DirectionalIdMap<volume_dim, TimeStepId>*>
                   mortar_next_time_step_id) {
             // Move received boundary data into boundary history.
             for (auto received_data = inbox.begin();
@@ -17,9 +17,12 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "DataStructures/VariablesTag.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
 #include "Domain/CoordinateMaps/Tags.hpp"
 #include "Domain/InterfaceHelpers.hpp"
 #include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionMap.hpp"
+#include "Domain/Structure/DirectionalIdMap.hpp"
 #include "Domain/Structure/OrientationMapHelpers.hpp"
 #include "Domain/Tags.hpp"
 #include "Domain/TagsTimeDependent.hpp"
@@ -197,6 +200,8 @@ CREATE_GET_TYPE_ALIAS_OR_DEFAULT(dg_step_choosers)
  *   - Tags::Interface<
  *     DirectionsTag, db::add_tag_prefix<Tags::NormalDotFlux, variables_tag>>
  *   - `Tags::Mortars<typename BoundaryScheme::mortar_data_tag, VolumeDim>`
+ *   - `evolution::dg::Tags::LocalGeometricQuantities<VolumeDim>` (only with
+ *     local time stepping and Gauss points)
  *
  * ### Internal Boundary Terms
  *
@@ -570,13 +575,63 @@ void ComputeTimeDerivative<Metavariables>::send_data_for_fluxes(
           db::get<domain::Tags::Mesh<volume_dim>>(*box).quadrature() ==
           make_array<volume_dim>(Spectral::Quadrature::Gauss);
 
-      const Scalar<DataVector> volume_det_inv_jacobian{};
+      // The Jacobian determinants only change if the mesh changes or the mesh
+      // is moving, so we cache them between steps instead of recomputing and
+      // interpolating them to the faces every step. The face normal magnitudes
+      // are cached in the same way in `NormalCovectorAndMagnitude`.
       if (using_gauss_points) {
-        // NOLINTNEXTLINE
-        const_cast<DataVector&>(get(volume_det_inv_jacobian))
-            .set_data_ref(make_not_null(&const_cast<DataVector&>(  // NOLINT
-                get(db::get<domain::Tags::DetInvJacobian<
-                        Frame::ElementLogical, Frame::Inertial>>(*box)))));
+        const auto& volume_mesh = db::get<domain::Tags::Mesh<volume_dim>>(*box);
+        const auto& local_geometric_quantities =
+            db::get<evolution::dg::Tags::LocalGeometricQuantities<volume_dim>>(
+                *box);
+        const bool mesh_is_moving =
+            not db::get<domain::CoordinateMaps::Tags::CoordinateMap<
+                volume_dim, Frame::Grid, Frame::Inertial>>(*box)
+                    .is_identity();
+        if (mesh_is_moving or not local_geometric_quantities.has_value() or
+            std::get<0>(*local_geometric_quantities) != volume_mesh) {
+          db::mutate<evolution::dg::Tags::LocalGeometricQuantities<volume_dim>>(
+              box,
+              [&element, &volume_mesh](
+                  const gsl::not_null<typename evolution::dg::Tags::
+                                          LocalGeometricQuantities<
+                                              volume_dim>::type*>
+                      local_quantities,
+                  const Scalar<DataVector>& volume_det_inv_jacobian) {
+                Scalar<DataVector> volume_det_jacobian{};
+                get(volume_det_jacobian) = 1.0 / get(volume_det_inv_jacobian);
+                DirectionMap<volume_dim, Scalar<DataVector>>
+                    face_det_jacobians{};
+                for (const auto& direction_and_neighbors :
+                     element.neighbors()) {
+                  const auto& direction = direction_and_neighbors.first;
+                  const Matrix identity{};
+                  auto interpolation_matrices =
+                      make_array<Metavariables::volume_dim>(
+                          std::cref(identity));
+                  const std::pair<Matrix, Matrix>& matrices =
+                      Spectral::boundary_interpolation_matrices(
+                          volume_mesh.slice_through(direction.dimension()));
+                  gsl::at(interpolation_matrices, direction.dimension()) =
+                      direction.side() == Side::Upper ? matrices.second
+                                                      : matrices.first;
+                  Scalar<DataVector> face_det_jacobian{
+                      volume_mesh.slice_away(direction.dimension())
+                          .number_of_grid_points()};
+                  apply_matrices(make_not_null(&get(face_det_jacobian)),
+                                 interpolation_matrices,
+                                 get(volume_det_jacobian),
+                                 volume_mesh.extents());
+                  face_det_jacobians.emplace(direction,
+                                             std::move(face_det_jacobian));
+                }
+                *local_quantities =
+                    std::tuple{volume_mesh, volume_det_inv_jacobian,
+                               std::move(face_det_jacobians)};
+              },
+              db::get<domain::Tags::DetInvJacobian<Frame::ElementLogical,
+                                                   Frame::Inertial>>(*box));
+        }
       }
 
       // Add face normal and Jacobian determinants to the local mortar data. We
@@ -588,75 +643,48 @@ void ComputeTimeDerivative<Metavariables>::send_data_for_fluxes(
       // using the `NormalDotNumericalFlux` prefix tag. This is because the
       // returned quantity is more a `dt` quantity than a
       // `NormalDotNormalDotFlux` since it's been lifted to the volume.
-      using Key = std::pair<Direction<volume_dim>, ElementId<volume_dim>>;
       const auto integration_order =
           db::get<::Tags::HistoryEvolvedVariables<>>(*box).integration_order();
       db::mutate<evolution::dg::Tags::MortarData<volume_dim>,
                  evolution::dg::Tags::MortarDataHistory<
                      volume_dim, typename dt_variables_tag::type>>(
           box,
-          [&element, integration_order, &time_step_id, using_gauss_points,
-           &volume_det_inv_jacobian](
-              const gsl::not_null<
-                  std::unordered_map<Key, evolution::dg::MortarData<volume_dim>,
-                                     boost::hash<Key>>*>
+          [&element, integration_order, &time_step_id, using_gauss_points](
+              const gsl::not_null<DirectionalIdMap<
+                  volume_dim, evolution::dg::MortarData<volume_dim>>*>
                   mortar_data,
-              const gsl::not_null<
-                  std::unordered_map<Key,
-                                     TimeSteppers::BoundaryHistory<
-                                         evolution::dg::MortarData<volume_dim>,
-                                         evolution::dg::MortarData<volume_dim>,
-                                         typename dt_variables_tag::type>,
-                                     boost::hash<Key>>*>
+              const gsl::not_null<DirectionalIdMap<
+                  volume_dim, TimeSteppers::BoundaryHistory<
+                                  evolution::dg::MortarData<volume_dim>,
+                                  evolution::dg::MortarData<volume_dim>,
+                                  typename dt_variables_tag::type>>*>
                   boundary_data_history,
-              const Mesh<volume_dim>& volume_mesh,
               const DirectionMap<
                   volume_dim,
                   std::optional<Variables<tmpl::list<
                       evolution::dg::Tags::MagnitudeOfNormal,
                       evolution::dg::Tags::NormalCovector<volume_dim>>>>>&
-                  normal_covector_and_magnitude) {
-            Scalar<DataVector> volume_det_jacobian{};
-            Scalar<DataVector> face_det_jacobian{};
-            if (using_gauss_points) {
-              get(volume_det_jacobian) = 1.0 / get(volume_det_inv_jacobian);
-            }
+                  normal_covector_and_magnitude,
+              const typename evolution::dg::Tags::LocalGeometricQuantities<
+                  volume_dim>::type& local_geometric_quantities) {
             for (const auto& [direction, neighbors_in_direction] :
                  element.neighbors()) {
-              // We can perform projections once for all neighbors in the
-              // direction because we care about the _face_ mesh, not the mortar
-              // mesh.
               ASSERT(
                   normal_covector_and_magnitude.at(direction).has_value(),
                   "The normal covector and magnitude have not been computed.");
               const Scalar<DataVector>& face_normal_magnitude =
                   get<evolution::dg::Tags::MagnitudeOfNormal>(
                       *normal_covector_and_magnitude.at(direction));
-              if (using_gauss_points) {
-                const Matrix identity{};
-                auto interpolation_matrices =
-                    make_array<Metavariables::volume_dim>(std::cref(identity));
-                const std::pair<Matrix, Matrix>& matrices =
-                    Spectral::boundary_interpolation_matrices(
-                        volume_mesh.slice_through(direction.dimension()));
-                gsl::at(interpolation_matrices, direction.dimension()) =
-                    direction.side() == Side::Upper ? matrices.second
-                                                    : matrices.first;
-                if (get(face_det_jacobian).size() !=
-                    get(face_normal_magnitude).size()) {
-                  get(face_det_jacobian) =
-                      DataVector{get(face_normal_magnitude).size()};
-                }
-                apply_matrices(make_not_null(&get(face_det_jacobian)),
-                               interpolation_matrices, get(volume_det_jacobian),
-                               volume_mesh.extents());
-              }
+              ASSERT(not using_gauss_points or
+                         local_geometric_quantities.has_value(),
+                     "The local geometric quantities have not been computed.");
 
               for (const auto& neighbor : neighbors_in_direction) {
                 const std::pair mortar_id{direction, neighbor};
                 if (using_gauss_points) {
                   mortar_data->at(mortar_id).insert_local_geometric_quantities(
-                      volume_det_inv_jacobian, face_det_jacobian,
+                      std::get<1>(*local_geometric_quantities),
+                      std::get<2>(*local_geometric_quantities).at(direction),
                       face_normal_magnitude);
                 } else {
                   mortar_data->at(mortar_id).insert_local_face_normal_magnitude(
@@ -677,8 +705,9 @@ void ComputeTimeDerivative<Metavariables>::send_data_for_fluxes(
               }
             }
           },
-          db::get<domain::Tags::Mesh<volume_dim>>(*box),
           db::get<evolution::dg::Tags::NormalCovectorAndMagnitude<volume_dim>>(
+              *box),
+          db::get<evolution::dg::Tags::LocalGeometricQuantities<volume_dim>>(
               *box));
   }
 }
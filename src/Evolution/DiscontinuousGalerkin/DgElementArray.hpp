@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <charm++.h>
 #include <cstddef>
+#include <tuple>
 #include <unordered_set>
 #include <vector>
 
@@ -21,13 +23,17 @@
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/Tags/ResourceInfo.hpp"
+#include "ParallelAlgorithms/Initialization/InsertInitialElements.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/System/ParallelInfo.hpp"
 #include "Utilities/TMPL.hpp"
+#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
 #include "Utilities/TypeTraits/CreateHasStaticMemberVariable.hpp"
 
 namespace detail {
 CREATE_HAS_STATIC_MEMBER_VARIABLE(use_z_order_distribution)
 CREATE_HAS_STATIC_MEMBER_VARIABLE_V(use_z_order_distribution)
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(distribute_element_creation)
 }  // namespace detail
 
 /*!
@@ -44,6 +50,17 @@ CREATE_HAS_STATIC_MEMBER_VARIABLE_V(use_z_order_distribution)
  * round-robin assignment. In both cases, an unordered set of `size_t`s can be
  * passed to the `allocate_array` function which represents physical processors
  * to avoid placing elements on.
+ *
+ * By default all elements are created on global proc 0, which sends the
+ * initialization items to every element. For large domains this dominates the
+ * startup time, so specify `static constexpr bool distribute_element_creation
+ * = true;` in the `Metavariables` to create the elements in parallel instead.
+ * Then the initialization items are sent to every node once through the
+ * `Parallel::GlobalCache`, and each node computes the element distribution and
+ * creates only the elements placed on its own procs. The `Parallel::Main`
+ * chare waits until all nodes have inserted their elements before it executes
+ * the initialization phase. Distributed creation requires the Morton
+ * space-filling curve distribution.
  */
 template <class Metavariables, class PhaseDepActionList>
 struct DgElementArray {
@@ -54,6 +71,10 @@ struct DgElementArray {
   using phase_dependent_action_list = PhaseDepActionList;
   using array_index = ElementId<volume_dim>;
 
+  static constexpr bool distribute_element_creation =
+      detail::get_distribute_element_creation_or_default_v<Metavariables,
+                                                            false>;
+
   using const_global_cache_tags = tmpl::list<domain::Tags::Domain<volume_dim>>;
 
   using array_allocation_tags =
@@ -99,35 +120,41 @@ void DgElementArray<Metavariables, PhaseDepActionList>::allocate_array(
   if constexpr (detail::has_use_z_order_distribution_v<Metavariables>) {
     use_z_order_distribution = Metavariables::use_z_order_distribution;
   }
+  if constexpr (distribute_element_creation) {
+    if (not use_z_order_distribution) {
+      ERROR(
+          "Distributed element creation requires the Morton space-filling "
+          "curve distribution, so 'use_z_order_distribution' must not be "
+          "false.");
+    }
+    // Main finishes the insertion once all nodes have inserted their elements
+    global_cache.template invoke_on_node<
+        Initialization::InsertInitialElements<volume_dim, DgElementArray>>(
+        std::make_tuple(initialization_items, procs_to_ignore),
+        CkCallback(Parallel::CkIndex_Main<
+                       Metavariables>::distributed_array_allocated(),
+                   local_cache.get_main_proxy().value()));
+    return;
+  }
+  if (use_z_order_distribution) {
+    Initialization::InsertInitialElements<volume_dim, DgElementArray>::apply(
+        local_cache, initialization_items, procs_to_ignore, true);
+    return;
+  }
   const size_t total_number_of_procs =
       static_cast<size_t>(sys::number_of_procs());
-  const size_t num_of_procs_to_use =
-      total_number_of_procs - procs_to_ignore.size();
   size_t which_proc = 0;
-  const domain::BlockZCurveProcDistribution<volume_dim> element_distribution{
-      num_of_procs_to_use, initial_refinement_levels, procs_to_ignore};
   for (const auto& block : domain.blocks()) {
     const auto initial_ref_levs = initial_refinement_levels[block.id()];
     const std::vector<ElementId<volume_dim>> element_ids =
         initial_element_ids(block.id(), initial_ref_levs);
-    if (use_z_order_distribution) {
-      for (const auto& element_id : element_ids) {
-        const size_t target_proc =
-            element_distribution.get_proc_for_element(element_id);
-        dg_element_array(element_id)
-            .insert(global_cache, initialization_items, target_proc);
-      }
-    } else {
-      while (procs_to_ignore.find(which_proc) != procs_to_ignore.end()) {
-        which_proc =
-            which_proc + 1 == total_number_of_procs ? 0 : which_proc + 1;
-      }
-      for (size_t i = 0; i < element_ids.size(); ++i) {
-        dg_element_array(ElementId<volume_dim>(element_ids[i]))
-            .insert(global_cache, initialization_items, which_proc);
-        which_proc =
-            which_proc + 1 == total_number_of_procs ? 0 : which_proc + 1;
-      }
+    while (procs_to_ignore.find(which_proc) != procs_to_ignore.end()) {
+      which_proc = which_proc + 1 == total_number_of_procs ? 0 : which_proc + 1;
+    }
+    for (size_t i = 0; i < element_ids.size(); ++i) {
+      dg_element_array(ElementId<volume_dim>(element_ids[i]))
+          .insert(global_cache, initialization_items, which_proc);
+      which_proc = which_proc + 1 == total_number_of_procs ? 0 : which_proc + 1;
     }
   }
   dg_element_array.doneInserting();
@@ -6,12 +6,13 @@
 #include <array>
 #include <cstddef>
 #include <tuple>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "Domain/Structure/CreateInitialMesh.hpp"
 #include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionMap.hpp"
+#include "Domain/Structure/DirectionalIdMap.hpp"
 #include "Domain/Structure/Element.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarData.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/MortarHelpers.hpp"
@@ -21,26 +22,12 @@
 #include "Utilities/GenerateInstantiations.hpp"
 
 namespace evolution::dg::Initialization::detail {
-namespace {
-template <size_t Dim>
-using Key = std::pair<Direction<Dim>, ElementId<Dim>>;
-template <typename MappedType, size_t Dim>
-using MortarMap =
-    std::unordered_map<Key<Dim>, MappedType, boost::hash<Key<Dim>>>;
-}  // namespace
-
 template <size_t Dim>
 std::tuple<
-    std::unordered_map<std::pair<Direction<Dim>, ElementId<Dim>>,
-                       evolution::dg::MortarData<Dim>,
-                       boost::hash<std::pair<Direction<Dim>, ElementId<Dim>>>>,
-    std::unordered_map<std::pair<Direction<Dim>, ElementId<Dim>>, Mesh<Dim - 1>,
-                       boost::hash<std::pair<Direction<Dim>, ElementId<Dim>>>>,
-    std::unordered_map<std::pair<Direction<Dim>, ElementId<Dim>>,
-                       std::array<Spectral::MortarSize, Dim - 1>,
-                       boost::hash<std::pair<Direction<Dim>, ElementId<Dim>>>>,
-    std::unordered_map<std::pair<Direction<Dim>, ElementId<Dim>>, TimeStepId,
-                       boost::hash<std::pair<Direction<Dim>, ElementId<Dim>>>>,
+    DirectionalIdMap<Dim, evolution::dg::MortarData<Dim>>,
+    DirectionalIdMap<Dim, Mesh<Dim - 1>>,
+    DirectionalIdMap<Dim, std::array<Spectral::MortarSize, Dim - 1>>,
+    DirectionalIdMap<Dim, TimeStepId>,
     DirectionMap<Dim, std::optional<Variables<tmpl::list<
                           evolution::dg::Tags::MagnitudeOfNormal,
                           evolution::dg::Tags::NormalCovector<Dim>>>>>>
@@ -49,10 +36,11 @@ mortars_apply_impl(const std::vector<std::array<size_t, Dim>>& initial_extents,
                    const Element<Dim>& element,
                    const TimeStepId& next_temporal_id,
                    const Mesh<Dim>& volume_mesh) {
-  MortarMap<evolution::dg::MortarData<Dim>, Dim> mortar_data{};
-  MortarMap<Mesh<Dim - 1>, Dim> mortar_meshes{};
-  MortarMap<std::array<Spectral::MortarSize, Dim - 1>, Dim> mortar_sizes{};
-  MortarMap<TimeStepId, Dim> mortar_next_temporal_ids{};
+  DirectionalIdMap<Dim, evolution::dg::MortarData<Dim>> mortar_data{};
+  DirectionalIdMap<Dim, Mesh<Dim - 1>> mortar_meshes{};
+  DirectionalIdMap<Dim, std::array<Spectral::MortarSize, Dim - 1>>
+      mortar_sizes{};
+  DirectionalIdMap<Dim, TimeStepId> mortar_next_temporal_ids{};
   DirectionMap<Dim, std::optional<Variables<
                         tmpl::list<evolution::dg::Tags::MagnitudeOfNormal,
                                    evolution::dg::Tags::NormalCovector<Dim>>>>>
@@ -93,21 +81,11 @@ mortars_apply_impl(const std::vector<std::array<size_t, Dim>>& initial_extents,
 
 #define INSTANTIATION(r, data)                                                 \
   template std::tuple<                                                         \
-      std::unordered_map<                                                      \
-          std::pair<Direction<DIM(data)>, ElementId<DIM(data)>>,               \
-          evolution::dg::MortarData<DIM(data)>,                                \
-          boost::hash<std::pair<Direction<DIM(data)>, ElementId<DIM(data)>>>>, \
-      std::unordered_map<                                                      \
-          std::pair<Direction<DIM(data)>, ElementId<DIM(data)>>,               \
-          Mesh<DIM(data) - 1>,                                                 \
-          boost::hash<std::pair<Direction<DIM(data)>, ElementId<DIM(data)>>>>, \
-      std::unordered_map<                                                      \
-          std::pair<Direction<DIM(data)>, ElementId<DIM(data)>>,               \
-          std::array<Spectral::MortarSize, DIM(data) - 1>,                     \
-          boost::hash<std::pair<Direction<DIM(data)>, ElementId<DIM(data)>>>>, \
-      std::unordered_map<                                                      \
-          std::pair<Direction<DIM(data)>, ElementId<DIM(data)>>, TimeStepId,   \
-          boost::hash<std::pair<Direction<DIM(data)>, ElementId<DIM(data)>>>>, \
+      DirectionalIdMap<DIM(data), evolution::dg::MortarData<DIM(data)>>,       \
+      DirectionalIdMap<DIM(data), Mesh<DIM(data) - 1>>,                        \
+      DirectionalIdMap<DIM(data),                                              \
+                       std::array<Spectral::MortarSize, DIM(data) - 1>>,       \
+      DirectionalIdMap<DIM(data), TimeStepId>,                                 \
       DirectionMap<DIM(data),                                                  \
                    std::optional<Variables<tmpl::list<                         \
                        evolution::dg::Tags::MagnitudeOfNormal,                 \
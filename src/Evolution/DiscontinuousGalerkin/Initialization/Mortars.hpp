@@ -4,11 +4,9 @@
 #pragma once
 
 #include <array>
-#include <boost/functional/hash.hpp>
 #include <cstddef>
 #include <optional>
 #include <tuple>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -17,6 +15,8 @@
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionMap.hpp"
+#include "Domain/Structure/DirectionalIdMap.hpp"
 #include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/Neighbors.hpp"
 #include "Domain/Structure/OrientationMap.hpp"
@@ -47,16 +47,10 @@ namespace evolution::dg::Initialization {
 namespace detail {
 template <size_t Dim>
 std::tuple<
-    std::unordered_map<std::pair<Direction<Dim>, ElementId<Dim>>,
-                       evolution::dg::MortarData<Dim>,
-                       boost::hash<std::pair<Direction<Dim>, ElementId<Dim>>>>,
-    std::unordered_map<std::pair<Direction<Dim>, ElementId<Dim>>, Mesh<Dim - 1>,
-                       boost::hash<std::pair<Direction<Dim>, ElementId<Dim>>>>,
-    std::unordered_map<std::pair<Direction<Dim>, ElementId<Dim>>,
-                       std::array<Spectral::MortarSize, Dim - 1>,
-                       boost::hash<std::pair<Direction<Dim>, ElementId<Dim>>>>,
-    std::unordered_map<std::pair<Direction<Dim>, ElementId<Dim>>, TimeStepId,
-                       boost::hash<std::pair<Direction<Dim>, ElementId<Dim>>>>,
+    DirectionalIdMap<Dim, evolution::dg::MortarData<Dim>>,
+    DirectionalIdMap<Dim, Mesh<Dim - 1>>,
+    DirectionalIdMap<Dim, std::array<Spectral::MortarSize, Dim - 1>>,
+    DirectionalIdMap<Dim, TimeStepId>,
     DirectionMap<Dim, std::optional<Variables<tmpl::list<
                           evolution::dg::Tags::MagnitudeOfNormal,
                           evolution::dg::Tags::NormalCovector<Dim>>>>>>
@@ -83,17 +77,12 @@ mortars_apply_impl(const std::vector<std::array<size_t, Dim>>& initial_extents,
  *   - `Tags::MortarSize<Dim>`
  *   - `Tags::MortarNextTemporalId<Dim>`
  *   - `evolution::dg::Tags::NormalCovectorAndMagnitude<Dim>`
+ *   - `Tags::LocalGeometricQuantities<Dim>`
  * - Removes: nothing
  * - Modifies: nothing
  */
 template <size_t Dim, typename System>
 struct Mortars {
-  using Key = std::pair<Direction<Dim>, ElementId<Dim>>;
-
-  template <typename MappedType>
-  using MortarMap = std::unordered_map<Key, MappedType, boost::hash<Key>>;
-
- public:
   using initialization_tags = tmpl::list<::domain::Tags::InitialExtents<Dim>,
                                          evolution::dg::Tags::Quadrature>;
 
@@ -103,7 +92,8 @@ struct Mortars {
       evolution::dg::Tags::NormalCovectorAndMagnitude<Dim>,
       Tags::MortarDataHistory<
           Dim, typename db::add_tag_prefix<
-                   ::Tags::dt, typename System::variables_tag>::type>>;
+                   ::Tags::dt, typename System::variables_tag>::type>,
+      Tags::LocalGeometricQuantities<Dim>>;
   using compute_tags = tmpl::list<>;
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
@@ -137,7 +127,8 @@ struct Mortars {
         make_not_null(&box), std::move(mortar_data), std::move(mortar_meshes),
         std::move(mortar_sizes), std::move(mortar_next_temporal_ids),
         std::move(normal_covector_quantities),
-        std::move(boundary_data_history));
+        std::move(boundary_data_history),
+        typename Tags::LocalGeometricQuantities<Dim>::type{});
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
 };
@@ -4,13 +4,17 @@
 #pragma once
 
 #include <array>
-#include <boost/functional/hash.hpp>
 #include <cstddef>
-#include <unordered_map>
+#include <optional>
+#include <tuple>
 #include <utility>
 
 #include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionMap.hpp"
+#include "Domain/Structure/DirectionalIdMap.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarData.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
@@ -23,11 +27,13 @@ namespace evolution::dg::Tags {
 /// Data on mortars, indexed by (Direction, ElementId) pairs
 ///
 /// The `Dim` is the volume dimension, not the face dimension.
+///
+/// All mortar tags store their data in a `DirectionalIdMap`, which has room
+/// for the maximum number of neighbors of an element.
 template <size_t Dim>
 struct MortarData : db::SimpleTag {
   using Key = std::pair<Direction<Dim>, ElementId<Dim>>;
-  using type =
-      std::unordered_map<Key, evolution::dg::MortarData<Dim>, boost::hash<Key>>;
+  using type = DirectionalIdMap<Dim, evolution::dg::MortarData<Dim>>;
 };
 
 /// History of the data on mortars, indexed by (Direction, ElementId) pairs, and
@@ -42,12 +48,25 @@ struct MortarData : db::SimpleTag {
 template <size_t Dim, typename CouplingResult>
 struct MortarDataHistory : db::SimpleTag {
   using Key = std::pair<Direction<Dim>, ElementId<Dim>>;
-  using type =
-      std::unordered_map<Key,
-                         TimeSteppers::BoundaryHistory<
-                             ::evolution::dg::MortarData<Dim>,
-                             ::evolution::dg::MortarData<Dim>, CouplingResult>,
-                         boost::hash<Key>>;
+  using type = DirectionalIdMap<
+      Dim, TimeSteppers::BoundaryHistory<::evolution::dg::MortarData<Dim>,
+                                         ::evolution::dg::MortarData<Dim>,
+                                         CouplingResult>>;
+};
+
+/// The local geometric quantities needed by local time stepping with Gauss
+/// points: the volume mesh they were computed on, the determinant of the
+/// volume inverse Jacobian, and the determinant of the volume Jacobian
+/// interpolated to each internal face.
+///
+/// These only change if the mesh changes or the mesh is moving, so they are
+/// cached between time steps instead of being recomputed every step. We use a
+/// `std::optional` to keep track of whether or not the values have been
+/// computed.
+template <size_t Dim>
+struct LocalGeometricQuantities : db::SimpleTag {
+  using type = std::optional<std::tuple<Mesh<Dim>, Scalar<DataVector>,
+                                        DirectionMap<Dim, Scalar<DataVector>>>>;
 };
 
 /// Mesh on the mortars, indexed by (Direction, ElementId) pairs
@@ -56,7 +75,7 @@ struct MortarDataHistory : db::SimpleTag {
 template <size_t Dim>
 struct MortarMesh : db::SimpleTag {
   using Key = std::pair<Direction<Dim>, ElementId<Dim>>;
-  using type = std::unordered_map<Key, Mesh<Dim - 1>, boost::hash<Key>>;
+  using type = DirectionalIdMap<Dim, Mesh<Dim - 1>>;
 };
 
 /// Size of a mortar, relative to the element face.  That is, the part
@@ -66,9 +85,7 @@ struct MortarMesh : db::SimpleTag {
 template <size_t Dim>
 struct MortarSize : db::SimpleTag {
   using Key = std::pair<Direction<Dim>, ElementId<Dim>>;
-  using type =
-      std::unordered_map<Key, std::array<Spectral::MortarSize, Dim - 1>,
-                         boost::hash<Key>>;
+  using type = DirectionalIdMap<Dim, std::array<Spectral::MortarSize, Dim - 1>>;
 };
 
 /// The next temporal id at which to receive data on the specified mortar.
@@ -77,6 +94,6 @@ struct MortarSize : db::SimpleTag {
 template <size_t Dim>
 struct MortarNextTemporalId : db::SimpleTag {
   using Key = std::pair<Direction<Dim>, ElementId<Dim>>;
-  using type = std::unordered_map<Key, TimeStepId, boost::hash<Key>>;
+  using type = DirectionalIdMap<Dim, TimeStepId>;
 };
 }  // namespace evolution::dg::Tags
@@ -126,6 +126,9 @@ struct EvolutionMetavars {
       dg::Formulation::StrongInertial;
   using temporal_id = Tags::TimeStepId;
   static constexpr bool local_time_stepping = true;
+  // Insert the elements from every node in parallel. The input file tests
+  // exercise this startup path.
+  static constexpr bool distribute_element_creation = true;
 
   using analytic_solution_fields = typename system::variables_tag::tags_list;
   using deriv_compute = ::Tags::DerivCompute<
@@ -5,11 +5,14 @@
 
 #include <optional>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "Evolution/Systems/Cce/GaugeTransformBoundaryData.hpp"
+#include "Evolution/Systems/Cce/LinearSolve.hpp"
 #include "Evolution/Systems/Cce/OptionTags.hpp"
+#include "Evolution/Systems/Cce/ParallelFor.hpp"
 #include "Evolution/Systems/Cce/PreSwshDerivatives.hpp"
 #include "Evolution/Systems/Cce/PrecomputeCceDependencies.hpp"
 #include "Evolution/Systems/Cce/SwshDerivatives.hpp"
@@ -31,7 +34,8 @@ namespace Actions {
  * `mutate_all_pre_swsh_derivatives_for_tag<BondiTag>()` and
  * `mutate_all_swsh_derivatives_for_tag<BondiTag>()` utility functions, which
  * determine which quantities are necessary for each of the hypersurface
- * computations.
+ * computations. The spin-weighted derivatives use `Cce::Tags::NumberOfThreads`
+ * threads if that tag is available.
  */
 template <typename BondiTag>
 struct CalculateIntegrandInputsForTag {
@@ -45,7 +49,42 @@ struct CalculateIntegrandInputsForTag {
       const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
       const ParallelComponent* const /*meta*/) {
     mutate_all_pre_swsh_derivatives_for_tag<BondiTag>(make_not_null(&box));
-    mutate_all_swsh_derivatives_for_tag<BondiTag>(make_not_null(&box));
+    mutate_all_swsh_derivatives_for_tag<BondiTag>(make_not_null(&box),
+                                                  number_of_threads(box));
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+
+/*!
+ * \ingroup ActionsGroup
+ * \brief Perform the radial integration of the hypersurface equation for
+ * `BondiTag`, placing the result in `BondiTag`.
+ *
+ * \details Internally this applies
+ * `Cce::RadialIntegrateBondi<Tags::EvolutionGaugeBoundaryValue, BondiTag>`.
+ * The independent linear solves for `Tags::BondiH` are distributed over
+ * `Cce::Tags::NumberOfThreads` threads if that tag is available.
+ */
+template <typename BondiTag>
+struct RadialIntegrateBondiForTag {
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTags>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    if constexpr (std::is_same_v<BondiTag, Tags::BondiH>) {
+      db::mutate_apply<
+          RadialIntegrateBondi<Tags::EvolutionGaugeBoundaryValue, BondiTag>>(
+          make_not_null(&box), number_of_threads(box));
+    } else {
+      db::mutate_apply<
+          RadialIntegrateBondi<Tags::EvolutionGaugeBoundaryValue, BondiTag>>(
+          make_not_null(&box));
+    }
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
 };
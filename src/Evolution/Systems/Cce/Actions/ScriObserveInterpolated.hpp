@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
+#include <functional>
 #include <optional>
 #include <string>
 #include <tuple>
@@ -14,6 +16,7 @@
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/SpinWeighted.hpp"
 #include "Evolution/Systems/Cce/OptionTags.hpp"
+#include "Evolution/Systems/Cce/ParallelFor.hpp"
 #include "Evolution/Systems/Cce/ScriPlusInterpolationManager.hpp"
 #include "Evolution/Systems/Cce/Tags.hpp"
 #include "IO/Observer/ReductionActions.hpp"
@@ -151,25 +154,30 @@ struct ScriObserveInterpolated {
             ComplexDataVector,
             tmpl::front<typename Metavariables::scri_values_to_observe>>>(box)
             .first_time_is_ready_to_interpolate()) {
+      // The interpolations of the different quantities are independent, so
+      // they are distributed over threads, while the transforms and writes
+      // are performed on the thread running the component.
+      std::array<std::pair<double, ComplexDataVector>,
+                 tmpl::size<interpolated_tags<Metavariables>>::value>
+          interpolations{};
+      interpolate_and_pop_first_time(make_not_null(&box),
+                                     make_not_null(&interpolations),
+                                     number_of_threads(box),
+                                     interpolated_tags<Metavariables>{});
+
       // first get the weyl scalars and correct them
       double interpolation_time = 0.0;
-      tmpl::for_each<detail::weyl_correction_list>([&interpolation_time,
-                                                    &corrected_scri_plus_weyl,
-                                                    &box](auto tag_v) {
-        using tag = typename decltype(tag_v)::type;
-        std::pair<double, ComplexDataVector> interpolation;
-        db::mutate<Tags::InterpolationManager<ComplexDataVector, tag>>(
-            make_not_null(&box),
-            [&interpolation](
-                const gsl::not_null<
-                    ScriPlusInterpolationManager<ComplexDataVector, tag>*>
-                    interpolation_manager) {
-              interpolation =
-                  interpolation_manager->interpolate_and_pop_first_time();
-            });
-        interpolation_time = interpolation.first;
-        get(get<tag>(corrected_scri_plus_weyl)).data() = interpolation.second;
-      });
+      tmpl::for_each<detail::weyl_correction_list>(
+          [&interpolation_time, &corrected_scri_plus_weyl,
+           &interpolations](auto tag_v) {
+            using tag = typename decltype(tag_v)::type;
+            auto& interpolation = gsl::at(
+                interpolations,
+                tmpl::index_of<interpolated_tags<Metavariables>, tag>::value);
+            interpolation_time = interpolation.first;
+            get(get<tag>(corrected_scri_plus_weyl)).data() =
+                std::move(interpolation.second);
+          });
 
       detail::correct_weyl_scalars_for_inertial_time(
           make_not_null(&corrected_scri_plus_weyl));
@@ -192,23 +200,16 @@ struct ScriObserveInterpolated {
             }
           });
 
-      // then do the interpolation and output of each of the rest of the tags.
+      // then output each of the rest of the tags.
       tmpl::for_each<
           tmpl::list_difference<typename Metavariables::scri_values_to_observe,
                                 detail::weyl_correction_list>>(
-          [&box, &data_to_write, &file_legend, &observation_l_max, &l_max,
-           &cache, &goldberg_modes](auto tag_v) {
+          [&data_to_write, &file_legend, &observation_l_max, &l_max, &cache,
+           &goldberg_modes, &interpolations](auto tag_v) {
             using tag = typename decltype(tag_v)::type;
-            std::pair<double, ComplexDataVector> interpolation;
-            db::mutate<Tags::InterpolationManager<ComplexDataVector, tag>>(
-                make_not_null(&box),
-                [&interpolation](
-                    const gsl::not_null<
-                        ScriPlusInterpolationManager<ComplexDataVector, tag>*>
-                        interpolation_manager) {
-                  interpolation =
-                      interpolation_manager->interpolate_and_pop_first_time();
-                });
+            const auto& interpolation = gsl::at(
+                interpolations,
+                tmpl::index_of<interpolated_tags<Metavariables>, tag>::value);
             ScriObserveInterpolated::transform_and_write<
                 tag, tag::type::type::spin, ParallelComponent>(
                 interpolation.second, interpolation.first,
@@ -230,6 +231,45 @@ struct ScriObserveInterpolated {
   }
 
  private:
+  // The Weyl scalars are always interpolated because they are needed for the
+  // correction to the inertial time.
+  template <typename Metavariables>
+  using interpolated_tags = tmpl::append<
+      detail::weyl_correction_list,
+      tmpl::list_difference<typename Metavariables::scri_values_to_observe,
+                            detail::weyl_correction_list>>;
+
+  template <typename DbTags, size_t NumberOfTags, typename... InterpolatedTags>
+  static void interpolate_and_pop_first_time(
+      const gsl::not_null<db::DataBox<DbTags>*> box,
+      const gsl::not_null<
+          std::array<std::pair<double, ComplexDataVector>, NumberOfTags>*>
+          interpolations,
+      const size_t number_of_threads,
+      tmpl::list<InterpolatedTags...> /*meta*/) {
+    using interpolation_function =
+        std::function<std::pair<double, ComplexDataVector>()>;
+    db::mutate<
+        Tags::InterpolationManager<ComplexDataVector, InterpolatedTags>...>(
+        box,
+        [&interpolations, &number_of_threads](
+            const gsl::not_null<ScriPlusInterpolationManager<
+                ComplexDataVector, InterpolatedTags>*>... managers) {
+          const std::array<interpolation_function, NumberOfTags>
+              interpolate_each{{[managers]() {
+                return managers->interpolate_and_pop_first_time();
+              }...}};
+          parallel_for(number_of_threads, NumberOfTags,
+                       [&interpolate_each, &interpolations](
+                           const size_t begin, const size_t end) {
+                         for (size_t i = begin; i < end; ++i) {
+                           gsl::at(*interpolations, i) =
+                               gsl::at(interpolate_each, i)();
+                         }
+                       });
+        });
+  }
+
   template <typename Tag, int Spin, typename ParallelComponent,
             typename Metavariables>
   static void transform_and_write(
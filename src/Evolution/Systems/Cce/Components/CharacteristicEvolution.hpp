@@ -95,6 +95,12 @@ struct CceEvolutionLabelTag {};
  *  - `cce_hypersurface_initialization`: a mutator (for use with
  * `::Actions::MutateApply`) that is used to compute the initial hypersurface
  * data from the boundary data.
+ *
+ * The component is a singleton, so the independent parts of each hypersurface
+ * computation (the spin-weighted transforms for each radial shell, the radial
+ * solves for \f$H\f$ at each angular point, and the interpolation of each
+ * quantity to \f$\mathcal I^+\f$) are distributed over
+ * `Cce::Tags::NumberOfThreads` threads owned by the component.
  */
 template <class Metavariables>
 struct CharacteristicEvolution {
@@ -116,6 +122,8 @@ struct CharacteristicEvolution {
       Parallel::get_initialization_tags<initialize_action_list>,
       Parallel::Tags::SingletonInfo<CharacteristicEvolution<Metavariables>>>;
 
+  using const_global_cache_tags = tmpl::list<Tags::NumberOfThreads>;
+
   // the list of actions that occur for each of the hypersurface-integrated
   // Bondi tags
   template <typename BondiTag>
@@ -125,8 +133,7 @@ struct CharacteristicEvolution {
       tmpl::transform<integrand_terms_to_compute_for_bondi_variable<BondiTag>,
                       tmpl::bind<::Actions::MutateApply,
                                  tmpl::bind<ComputeBondiIntegrand, tmpl::_1>>>,
-      ::Actions::MutateApply<
-          RadialIntegrateBondi<Tags::EvolutionGaugeBoundaryValue, BondiTag>>,
+      Actions::RadialIntegrateBondiForTag<BondiTag>,
       // Once we finish the U computation, we need to update all the quantities
       // that depend on the time derivative of the gauge
       tmpl::conditional_t<
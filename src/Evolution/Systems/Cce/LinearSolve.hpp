@@ -97,6 +97,11 @@ void transpose_to_reals_then_imags_radial_stripes(
  * In each case, the boundary value at the world tube for the integration is
  * retrieved from `BoundaryPrefix<Tag>`.
  *
+ * The linear solves for \f$H\f$ at each angular point are independent, so
+ * the `Tags::BondiH` version optionally takes a number of threads (passed as
+ * an additional argument to `db::mutate_apply`) over which the angular points
+ * are distributed.
+ *
  * Additional type aliases `boundary_tags` and `integrand_tags` are provided for
  * template processing of the required input tags necessary for these functions.
  * These type aliases are `tmpl::list`s with the subsets of `argument_tags` from
@@ -190,7 +195,8 @@ struct RadialIntegrateBondi<BoundaryPrefix, Tags::BondiH> {
           linear_factor_of_conjugate,
       const Scalar<SpinWeighted<ComplexDataVector, 2>>& boundary,
       const Scalar<SpinWeighted<ComplexDataVector, 0>>& one_minus_y,
-      size_t l_max, size_t number_of_radial_points);
+      size_t l_max, size_t number_of_radial_points,
+      size_t number_of_threads = 1);
 };
 /// @}
 }  // namespace Cce
@@ -15,6 +15,7 @@
 #include "Evolution/Systems/Cce/InterfaceManagers/GhLocalTimeStepping.hpp"
 #include "Evolution/Systems/Cce/InterfaceManagers/GhLockstep.hpp"
 #include "Evolution/Systems/Cce/WorldtubeDataManager.hpp"
+#include "IO/H5/Helpers.hpp"
 #include "NumericalAlgorithms/Interpolation/SpanInterpolator.hpp"
 #include "Options/Auto.hpp"
 #include "Options/Options.hpp"
@@ -93,6 +94,16 @@ struct NumberOfRadialPoints {
   using group = Cce;
 };
 
+struct NumberOfThreads {
+  using type = size_t;
+  static constexpr Options::String help{
+      "Number of threads used for the independent parts of the hypersurface "
+      "computation on the characteristic evolution component. Set to 1 to "
+      "perform the entire computation on the core running the component."};
+  static type lower_bound() { return 1; }
+  using group = Cce;
+};
+
 struct ExtractionRadius {
   using type = double;
   static constexpr Options::String help{"Extraction radius of the CCE system."};
@@ -141,6 +152,17 @@ struct H5LookaheadTimes {
   using group = Cce;
 };
 
+struct H5PrefetchData {
+  using type = bool;
+  static constexpr Options::String help{
+      "Read the next H5LookaheadTimes times steps from the h5 on a background "
+      "thread while the current ones are used, so the evolution does not wait "
+      "for each read. Doubles the memory used for the cached worldtube data. "
+      "Requires a thread-safe build of HDF5; otherwise the data is read "
+      "synchronously."};
+  using group = Cce;
+};
+
 struct H5Interpolator {
   using type = std::unique_ptr<intrp::SpanInterpolator>;
   static constexpr Options::String help{
@@ -272,7 +294,8 @@ struct H5WorldtubeBoundaryDataManager : db::SimpleTag {
       tmpl::list<OptionTags::LMax, OptionTags::BoundaryDataFilename,
                  OptionTags::H5LookaheadTimes, OptionTags::H5Interpolator,
                  OptionTags::H5IsBondiData, OptionTags::FixSpecNormalization,
-                 OptionTags::StandaloneExtractionRadius>;
+                 OptionTags::StandaloneExtractionRadius,
+                 OptionTags::H5PrefetchData>;
 
   static constexpr bool pass_metavariables = false;
   static type create_from_options(
@@ -280,7 +303,18 @@ struct H5WorldtubeBoundaryDataManager : db::SimpleTag {
       const size_t number_of_lookahead_times,
       const std::unique_ptr<intrp::SpanInterpolator>& interpolator,
       const bool h5_is_bondi_data, const bool fix_spec_normalization,
-      const std::optional<double> extraction_radius) {
+      const std::optional<double> extraction_radius,
+      const bool prefetch_data) {
+    // The background reads run concurrently with all other HDF5 calls on the
+    // node, not just with the ones holding the worldtube data's H5 lock
+    const bool h5_is_threadsafe = h5::library_is_threadsafe();
+    if (prefetch_data and not h5_is_threadsafe) {
+      Parallel::printf(
+          "Warning: Option H5PrefetchData is set to `true`, but the HDF5 "
+          "library is not thread-safe. The worldtube data will be read "
+          "synchronously.\n");
+    }
+    const bool prefetch = prefetch_data and h5_is_threadsafe;
     if (h5_is_bondi_data) {
       if (static_cast<bool>(extraction_radius)) {
         Parallel::printf(
@@ -294,13 +328,14 @@ struct H5WorldtubeBoundaryDataManager : db::SimpleTag {
       return std::make_unique<BondiWorldtubeDataManager>(
           std::make_unique<BondiWorldtubeH5BufferUpdater>(filename,
                                                           extraction_radius),
-          l_max, number_of_lookahead_times, interpolator->get_clone());
+          l_max, number_of_lookahead_times, interpolator->get_clone(),
+          prefetch);
     } else {
       return std::make_unique<MetricWorldtubeDataManager>(
           std::make_unique<MetricWorldtubeH5BufferUpdater>(filename,
                                                            extraction_radius),
           l_max, number_of_lookahead_times, interpolator->get_clone(),
-          fix_spec_normalization);
+          fix_spec_normalization, prefetch);
     }
   }
 };
@@ -324,6 +359,16 @@ struct NumberOfRadialPoints : db::SimpleTag,
   }
 };
 
+struct NumberOfThreads : db::SimpleTag {
+  using type = size_t;
+  using option_tags = tmpl::list<OptionTags::NumberOfThreads>;
+
+  static constexpr bool pass_metavariables = false;
+  static size_t create_from_options(const size_t number_of_threads) {
+    return number_of_threads;
+  }
+};
+
 struct ObservationLMax : db::SimpleTag {
   using type = size_t;
   using option_tags = tmpl::list<OptionTags::ObservationLMax>;
@@ -0,0 +1,57 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/Systems/Cce/ParallelFor.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace Cce {
+
+void parallel_for(const size_t number_of_threads, const size_t number_of_items,
+                  const std::function<void(size_t, size_t)>& apply_to_range) {
+  const size_t number_of_blocks =
+      std::min(std::max(number_of_threads, size_t{1}), number_of_items);
+  if (number_of_blocks <= 1) {
+    apply_to_range(0, number_of_items);
+    return;
+  }
+
+  // The first `number_of_items % number_of_blocks` blocks get one extra item.
+  const auto block_begin = [&number_of_items,
+                            &number_of_blocks](const size_t block) {
+    return block * (number_of_items / number_of_blocks) +
+           std::min(block, number_of_items % number_of_blocks);
+  };
+
+  std::vector<std::exception_ptr> exceptions(number_of_blocks);
+  const auto apply_to_block = [&apply_to_range, &block_begin,
+                               &exceptions](const size_t block) {
+    try {
+      apply_to_range(block_begin(block), block_begin(block + 1));
+    } catch (...) {
+      exceptions[block] = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> threads{};
+  threads.reserve(number_of_blocks - 1);
+  for (size_t block = 1; block < number_of_blocks; ++block) {
+    threads.emplace_back(apply_to_block, block);
+  }
+  apply_to_block(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (const auto& exception : exceptions) {
+    if (exception != nullptr) {
+      std::rethrow_exception(exception);
+    }
+  }
+}
+}  // namespace Cce
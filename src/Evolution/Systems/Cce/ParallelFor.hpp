@@ -0,0 +1,51 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Evolution/Systems/Cce/OptionTags.hpp"
+
+namespace Cce {
+
+/*!
+ * \brief Split the range `[0, number_of_items)` into contiguous blocks and
+ * call `apply_to_range(begin, end)` on each block, using up to
+ * `number_of_threads` threads.
+ *
+ * \details The CCE evolution is performed by a singleton, so the independent
+ * parts of the hypersurface computation (e.g. the transforms for each radial
+ * shell or the radial solves for each angular point) are distributed over
+ * threads owned by the singleton rather than over chares. The calling thread
+ * processes the first block and waits for the remaining blocks to complete,
+ * so `apply_to_range` must only write to data that is disjoint between
+ * blocks. Any exception thrown while processing a block is rethrown on the
+ * calling thread once all blocks have finished.
+ *
+ * With `number_of_threads` equal to one (the default for the CCE options)
+ * `apply_to_range` is called once for the full range and no threads are
+ * created.
+ *
+ * \note The additional threads are not managed by Charm++, so the run should
+ * leave enough cores free on the node for them to be useful.
+ */
+void parallel_for(size_t number_of_threads, size_t number_of_items,
+                  const std::function<void(size_t, size_t)>& apply_to_range);
+
+/// The number of threads that the CCE computations on the component owning
+/// `box` may use, which is `Cce::Tags::NumberOfThreads` if it is available
+/// and one otherwise.
+template <typename DbTags>
+size_t number_of_threads(const db::DataBox<DbTags>& box) {
+  if constexpr (db::tag_is_retrievable_v<Tags::NumberOfThreads,
+                                         db::DataBox<DbTags>>) {
+    return db::get<Tags::NumberOfThreads>(box);
+  } else {
+    (void)box;
+    return 1;
+  }
+}
+}  // namespace Cce
@@ -4,6 +4,8 @@
 #include "Evolution/Systems/Cce/ReducedWorldtubeModeRecorder.hpp"
 
 #include <cstddef>
+#include <string>
+#include <vector>
 
 #include "DataStructures/ComplexModalVector.hpp"
 #include "IO/H5/Dat.hpp"
@@ -13,9 +15,9 @@
 
 namespace Cce {
 
-void ReducedWorldtubeModeRecorder::append_worldtube_mode_data(
-    const std::string& dataset_path, const double time,
-    const ComplexModalVector& modes, const size_t l_max, const bool is_real) {
+namespace {
+std::vector<std::string> worldtube_mode_data_legend(const size_t l_max,
+                                                    const bool is_real) {
   std::vector<std::string> legend;
   const size_t output_size = square(l_max + 1);
   legend.reserve(is_real ? output_size + 1 : 2 * output_size + 1);
@@ -30,8 +32,37 @@ void ReducedWorldtubeModeRecorder::append_worldtube_mode_data(
       }
     }
   }
-  auto& output_mode_dataset =
-      output_file_.try_insert<h5::Dat>(dataset_path, legend, 0);
+  return legend;
+}
+}  // namespace
+
+void ReducedWorldtubeModeRecorder::append_worldtube_mode_data(
+    const std::string& dataset_path, const double time,
+    const ComplexModalVector& modes, const size_t l_max, const bool is_real) {
+  auto& output_mode_dataset = output_file_.try_insert<h5::Dat>(
+      dataset_path, worldtube_mode_data_legend(l_max, is_real), 0);
+  output_mode_dataset.append(
+      worldtube_mode_data_row(time, modes, l_max, is_real));
+  output_file_.close_current_object();
+}
+
+void ReducedWorldtubeModeRecorder::append_worldtube_mode_data(
+    const std::string& dataset_path,
+    const std::vector<std::vector<double>>& rows, const size_t l_max,
+    const bool is_real) {
+  if (rows.empty()) {
+    return;
+  }
+  auto& output_mode_dataset = output_file_.try_insert<h5::Dat>(
+      dataset_path, worldtube_mode_data_legend(l_max, is_real), 0);
+  output_mode_dataset.append(rows);
+  output_file_.close_current_object();
+}
+
+std::vector<double> ReducedWorldtubeModeRecorder::worldtube_mode_data_row(
+    const double time, const ComplexModalVector& modes, const size_t l_max,
+    const bool is_real) {
+  const size_t output_size = square(l_max + 1);
   std::vector<double> data_to_write;
   if (is_real) {
     data_to_write.resize(output_size + 1);
@@ -73,7 +104,6 @@ void ReducedWorldtubeModeRecorder::append_worldtube_mode_data(
       }
     }
   }
-  output_mode_dataset.append(data_to_write);
-  output_file_.close_current_object();
+  return data_to_write;
 }
 }  // namespace Cce
@@ -6,6 +6,7 @@
 #include <cmath>
 #include <cstddef>
 #include <string>
+#include <vector>
 
 #include "Evolution/Systems/Cce/Tags.hpp"
 #include "IO/H5/File.hpp"
@@ -93,6 +94,23 @@ struct ReducedWorldtubeModeRecorder {
                                   const ComplexModalVector& modes, size_t l_max,
                                   bool is_real = false);
 
+  /// append to `dataset_path` several rows at once, each of which has been
+  /// produced by `worldtube_mode_data_row()` with the same `l_max` and
+  /// `is_real`.
+  ///
+  /// Writing the rows in larger chunks reduces the number of HDF5 operations
+  /// when many times are recorded.
+  void append_worldtube_mode_data(const std::string& dataset_path,
+                                  const std::vector<std::vector<double>>& rows,
+                                  size_t l_max, bool is_real = false);
+
+  /// The row that `append_worldtube_mode_data()` appends for the `time` and
+  /// `modes`, which may be assembled separately from the writes, e.g. on a
+  /// different thread.
+  static std::vector<double> worldtube_mode_data_row(
+      double time, const ComplexModalVector& modes, size_t l_max,
+      bool is_real = false);
+
  private:
   h5::H5File<h5::AccessType::ReadWrite> output_file_;
 };
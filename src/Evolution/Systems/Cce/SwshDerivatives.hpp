@@ -5,14 +5,18 @@
 
 #include <cmath>
 #include <cstddef>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 
 #include "DataStructures/ComplexDataVector.hpp"
 #include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/SpinWeighted.hpp"
 #include "DataStructures/Tags.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Evolution/Systems/Cce/IntegrandInputSteps.hpp"
+#include "Evolution/Systems/Cce/ParallelFor.hpp"
 #include "Evolution/Systems/Cce/Tags.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
@@ -593,6 +597,87 @@ void apply_swsh_jacobian_helper(
   db::mutate_apply<ApplySwshJacobianInplace<DerivativeTag>>(
       box, OnDemandInputsForSwshJacobian<OnDemandTags>{}(*box)...);
 }
+
+// Non-owning views of the radial shells `[begin, end)` of volume data stored as
+// `number_of_radial_points` contiguous shells. The same layout is used for the
+// nodal data and for the libsharp modes.
+template <typename ValueType, int Spin>
+Scalar<SpinWeighted<ValueType, Spin>> radial_shell_view(
+    const gsl::not_null<Scalar<SpinWeighted<ValueType, Spin>>*> volume_data,
+    const size_t begin, const size_t end,
+    const size_t number_of_radial_points) {
+  const size_t shell_size = get(*volume_data).size() / number_of_radial_points;
+  Scalar<SpinWeighted<ValueType, Spin>> view{};
+  get(view).set_data_ref(get(*volume_data).data().data() + begin * shell_size,
+                         (end - begin) * shell_size);
+  return view;
+}
+
+template <typename ValueType, int Spin>
+Scalar<SpinWeighted<ValueType, Spin>> radial_shell_view(
+    const Scalar<SpinWeighted<ValueType, Spin>>& volume_data,
+    const size_t begin, const size_t end,
+    const size_t number_of_radial_points) {
+  const size_t shell_size = get(volume_data).size() / number_of_radial_points;
+  Scalar<SpinWeighted<ValueType, Spin>> view{};
+  make_const_view(make_not_null(&std::as_const(get(view))), get(volume_data),
+                  begin * shell_size, (end - begin) * shell_size);
+  return view;
+}
+
+template <typename Mutator, typename DataBoxTagList, typename... ReturnTags,
+          typename... ArgumentTags>
+void mutate_angular_derivatives_over_radial_shells_impl(
+    const gsl::not_null<db::DataBox<DataBoxTagList>*> box,
+    const size_t number_of_threads, tmpl::list<ReturnTags...> /*meta*/,
+    tmpl::list<ArgumentTags...> /*meta*/) {
+  const size_t l_max = db::get<Spectral::Swsh::Tags::LMaxBase>(*box);
+  const size_t number_of_radial_points =
+      db::get<Spectral::Swsh::Tags::NumberOfRadialPointsBase>(*box);
+  db::mutate_apply<tmpl::list<ReturnTags...>, tmpl::list<ArgumentTags...>>(
+      [&l_max, &number_of_radial_points, &number_of_threads](
+          const gsl::not_null<typename ReturnTags::type*>... volume_results,
+          const typename ArgumentTags::type&... volume_arguments) {
+        parallel_for(
+            number_of_threads, number_of_radial_points,
+            [&](const size_t begin, const size_t end) {
+              auto result_views = std::make_tuple(radial_shell_view(
+                  volume_results, begin, end, number_of_radial_points)...);
+              std::apply(
+                  [&](auto&... results) {
+                    Mutator::apply(
+                        make_not_null(&results)...,
+                        radial_shell_view(volume_arguments, begin, end,
+                                          number_of_radial_points)...,
+                        l_max, end - begin);
+                  },
+                  result_views);
+            });
+      },
+      box);
+}
+
+// Applies the `Spectral::Swsh::AngularDerivatives` mutator separately to
+// blocks of radial shells, distributing the blocks over `number_of_threads`
+// threads. The transforms of different shells are independent, so the result
+// is identical to applying the mutator to the full volume.
+template <typename DerivativeTagList, typename DataBoxTagList>
+void mutate_angular_derivatives_over_radial_shells(
+    const gsl::not_null<db::DataBox<DataBoxTagList>*> box,
+    const size_t number_of_threads) {
+  using mutator = Spectral::Swsh::AngularDerivatives<DerivativeTagList>;
+  if (number_of_threads <= 1) {
+    db::mutate_apply<mutator>(box);
+    return;
+  }
+  using argument_tags = tmpl::list_difference<
+      typename mutator::argument_tags,
+      tmpl::list<Spectral::Swsh::Tags::LMaxBase,
+                 Spectral::Swsh::Tags::NumberOfRadialPointsBase>>;
+  mutate_angular_derivatives_over_radial_shells_impl<mutator>(
+      box, number_of_threads, typename mutator::return_tags{},
+      argument_tags{});
+}
 }  // namespace detail
 
 /*!
@@ -611,17 +696,23 @@ void apply_swsh_jacobian_helper(
  * `Cce::single_swsh_derivative_tags_to_compute_for<BondiValueTag>` and
  * `Cce::second_swsh_derivative_tags_to_compute_for<BondiValueTag>` to their
  * correct values for the current values of the remaining (input) tags.
+ *
+ * The spin-weighted transforms for each radial shell are independent, so the
+ * shells are distributed over `number_of_threads` threads (see
+ * `Cce::parallel_for()`).
  */
 template <typename BondiValueTag, typename DataBoxTagList>
 void mutate_all_swsh_derivatives_for_tag(
-    const gsl::not_null<db::DataBox<DataBoxTagList>*> box) {
+    const gsl::not_null<db::DataBox<DataBoxTagList>*> box,
+    const size_t number_of_threads = 1) {
   // The collection of spin-weighted derivatives cannot be applied as individual
   // compute items, because it is better to aggregate similar spins and dispatch
   // to libsharp in groups. So, we supply a bulk mutate operation which takes in
   // multiple Variables from the presumed DataBox, and alters their values as
   // necessary.
-  db::mutate_apply<Spectral::Swsh::AngularDerivatives<
-      single_swsh_derivative_tags_to_compute_for_t<BondiValueTag>>>(box);
+  detail::mutate_angular_derivatives_over_radial_shells<
+      single_swsh_derivative_tags_to_compute_for_t<BondiValueTag>>(
+      box, number_of_threads);
   tmpl::for_each<single_swsh_derivative_tags_to_compute_for_t<BondiValueTag>>(
       [&box](auto derivative_tag_v) {
         using derivative_tag = typename decltype(derivative_tag_v)::type;
@@ -630,8 +721,9 @@ void mutate_all_swsh_derivatives_for_tag(
                      derivative_tag>::on_demand_argument_tags{});
       });
 
-  db::mutate_apply<Spectral::Swsh::AngularDerivatives<
-      second_swsh_derivative_tags_to_compute_for_t<BondiValueTag>>>(box);
+  detail::mutate_angular_derivatives_over_radial_shells<
+      second_swsh_derivative_tags_to_compute_for_t<BondiValueTag>>(
+      box, number_of_threads);
   tmpl::for_each<second_swsh_derivative_tags_to_compute_for_t<BondiValueTag>>(
       [&box](auto derivative_tag_v) {
         using derivative_tag = typename decltype(derivative_tag_v)::type;
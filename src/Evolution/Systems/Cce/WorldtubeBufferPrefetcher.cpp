@@ -0,0 +1,117 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/Systems/Cce/WorldtubeBufferPrefetcher.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <pup.h>
+#include <utility>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/Cce/WorldtubeBufferUpdater.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Cce {
+namespace {
+double seconds_since(const std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start)
+      .count();
+}
+}  // namespace
+
+template <typename BufferTags>
+void WorldtubeBufferPrefetcher<BufferTags>::update_buffers_for_time(
+    const gsl::not_null<Variables<BufferTags>*> buffers,
+    const gsl::not_null<size_t*> time_span_start,
+    const gsl::not_null<size_t*> time_span_end, const double time,
+    const size_t computation_l_max, const size_t interpolator_length,
+    const size_t buffer_depth,
+    const gsl::not_null<WorldtubeBufferUpdater<BufferTags>*> buffer_updater,
+    const gsl::not_null<Parallel::NodeLock*> hdf5_lock) {
+  const DataVector& time_buffer = buffer_updater->get_time_buffer();
+  if (prefetch_ and
+      not detail::time_span_needs_update(time, *time_span_end,
+                                         interpolator_length, time_buffer)) {
+    return;
+  }
+  const auto wait_start = std::chrono::steady_clock::now();
+  if (prefetched_window_.valid()) {
+    // rethrows any exception from the background read
+    Window window = prefetched_window_.get();
+    if (not detail::time_span_needs_update(time, window.time_span_end,
+                                           interpolator_length, time_buffer)) {
+      *buffers = std::move(window.buffers);
+      *time_span_start = window.time_span_start;
+      *time_span_end = window.time_span_end;
+    }
+  }
+  // Without prefetching, the buffer updater determines whether it needs to
+  // read new data.
+  if (not prefetch_ or
+      detail::time_span_needs_update(time, *time_span_end, interpolator_length,
+                                     time_buffer)) {
+    hdf5_lock->lock();
+    buffer_updater->update_buffers_for_time(
+        buffers, time_span_start, time_span_end, time, computation_l_max,
+        interpolator_length, buffer_depth);
+    hdf5_lock->unlock();
+  }
+  io_wait_time_ += seconds_since(wait_start);
+
+  if (prefetch_ and *time_span_end < time_buffer.size()) {
+    // the earliest time that the current window cannot be used for
+    start_prefetch(buffers->number_of_grid_points(),
+                   time_buffer[*time_span_end - interpolator_length],
+                   computation_l_max, interpolator_length, buffer_depth,
+                   *buffer_updater, hdf5_lock);
+  }
+}
+
+template <typename BufferTags>
+void WorldtubeBufferPrefetcher<BufferTags>::start_prefetch(
+    const size_t number_of_grid_points, const double next_update_time,
+    const size_t computation_l_max, const size_t interpolator_length,
+    const size_t buffer_depth,
+    const WorldtubeBufferUpdater<BufferTags>& buffer_updater,
+    const gsl::not_null<Parallel::NodeLock*> hdf5_lock) {
+  if (prefetch_updater_ == nullptr) {
+    prefetch_updater_ = buffer_updater.get_clone();
+  }
+  prefetched_window_ = std::async(
+      std::launch::async,
+      [updater = prefetch_updater_, hdf5_lock, next_update_time,
+       number_of_grid_points, computation_l_max, interpolator_length,
+       buffer_depth]() {
+        // The empty time span forces the updater to read the full window
+        // around `next_update_time`.
+        Window window{Variables<BufferTags>{number_of_grid_points}, 0, 0};
+        hdf5_lock->lock();
+        updater->update_buffers_for_time(
+            make_not_null(&window.buffers),
+            make_not_null(&window.time_span_start),
+            make_not_null(&window.time_span_end), next_update_time,
+            computation_l_max, interpolator_length, buffer_depth);
+        hdf5_lock->unlock();
+        return window;
+      });
+}
+
+template <typename BufferTags>
+void WorldtubeBufferPrefetcher<BufferTags>::pup(PUP::er& p) {
+  p | prefetch_;
+  p | io_wait_time_;
+  if (p.isUnpacking()) {
+    prefetch_updater_ = nullptr;
+    prefetched_window_ = std::future<Window>{};
+  }
+}
+
+template class WorldtubeBufferPrefetcher<cce_metric_input_tags>;
+template class WorldtubeBufferPrefetcher<cce_bondi_input_tags>;
+}  // namespace Cce
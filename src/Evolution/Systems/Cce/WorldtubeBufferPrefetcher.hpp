@@ -0,0 +1,101 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <future>
+#include <memory>
+
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/Cce/WorldtubeBufferUpdater.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace Cce {
+
+/*!
+ * \brief Performs the buffer updates for the `WorldtubeDataManager`s,
+ * optionally reading the next window of worldtube data on a background thread
+ * while the current window is used for interpolation.
+ *
+ * \details Without prefetching, each buffer update reads the new window of
+ * worldtube data from the `WorldtubeBufferUpdater` synchronously, holding the
+ * `hdf5_lock`. With prefetching, each time the buffers are updated the next
+ * window is immediately requested from a separate copy of the buffer updater on
+ * a background thread, starting at the first time that will not be covered by
+ * the current window. When the current window is exhausted, the prefetched
+ * window is swapped in, so the evolution only waits if the read has not yet
+ * finished. If the prefetched window does not cover the requested time (e.g.
+ * because the requested time jumped ahead by more than the buffer depth), the
+ * window is read synchronously as without prefetching.
+ *
+ * The prefetched window has the same size as the current window, so the memory
+ * used for the buffers is doubled. The background reads hold the `hdf5_lock`,
+ * but other HDF5 calls on the node (e.g. from the observers) don't, so
+ * prefetching from HDF5 files requires a thread-safe build of HDF5. The
+ * `Cce::Tags::H5WorldtubeBoundaryDataManager` falls back to synchronous reads
+ * if `h5::library_is_threadsafe()` is false.
+ *
+ * The total wall-clock time that the calling thread has spent waiting for
+ * worldtube data, either reading it or waiting for a prefetched read to
+ * complete, is accumulated and can be retrieved from `io_wait_time()`.
+ */
+template <typename BufferTags>
+class WorldtubeBufferPrefetcher {
+ public:
+  WorldtubeBufferPrefetcher() = default;
+
+  explicit WorldtubeBufferPrefetcher(const bool prefetch)
+      : prefetch_{prefetch} {}
+
+  /// Update the `buffers`, `time_span_start`, and `time_span_end` so that the
+  /// buffers can be used to interpolate to `time`, following the same
+  /// conventions as `WorldtubeBufferUpdater::update_buffers_for_time()`.
+  void update_buffers_for_time(
+      gsl::not_null<Variables<BufferTags>*> buffers,
+      gsl::not_null<size_t*> time_span_start,
+      gsl::not_null<size_t*> time_span_end, double time,
+      size_t computation_l_max, size_t interpolator_length,
+      size_t buffer_depth,
+      gsl::not_null<WorldtubeBufferUpdater<BufferTags>*> buffer_updater,
+      gsl::not_null<Parallel::NodeLock*> hdf5_lock);
+
+  bool prefetch() const { return prefetch_; }
+
+  /// The total time in seconds that `update_buffers_for_time()` has spent
+  /// waiting for worldtube data.
+  double io_wait_time() const { return io_wait_time_; }
+
+  /// Serialization for Charm++. Any prefetched data is discarded.
+  void pup(PUP::er& p);  // NOLINT
+
+ private:
+  struct Window {
+    Variables<BufferTags> buffers;
+    size_t time_span_start = 0;
+    size_t time_span_end = 0;
+  };
+
+  void start_prefetch(size_t number_of_grid_points, double next_update_time,
+                      size_t computation_l_max, size_t interpolator_length,
+                      size_t buffer_depth,
+                      const WorldtubeBufferUpdater<BufferTags>& buffer_updater,
+                      gsl::not_null<Parallel::NodeLock*> hdf5_lock);
+
+  bool prefetch_ = false;
+  double io_wait_time_ = 0.0;
+  // The copy of the buffer updater used by the background reads, so that the
+  // reads do not depend on the lifetime of the caller's buffer updater.
+  std::shared_ptr<const WorldtubeBufferUpdater<BufferTags>> prefetch_updater_;
+  // Destroying a future obtained from `std::async` waits for the read to
+  // complete.
+  std::future<Window> prefetched_window_;
+};
+}  // namespace Cce
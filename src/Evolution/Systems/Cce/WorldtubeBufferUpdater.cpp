@@ -68,6 +68,16 @@ std::pair<size_t, size_t> create_span_for_time_value(
 
   return std::make_pair(span_start, span_end);
 }
+
+bool time_span_needs_update(const double time, const size_t time_span_end,
+                            const size_t interpolator_length,
+                            const DataVector& time_buffer) {
+  if (time_span_end >= time_buffer.size()) {
+    return false;
+  }
+  return time_span_end <= interpolator_length or
+         time_buffer[time_span_end - interpolator_length] <= time;
+}
 }  // namespace detail
 
 MetricWorldtubeH5BufferUpdater::MetricWorldtubeH5BufferUpdater(
@@ -140,8 +150,8 @@ double MetricWorldtubeH5BufferUpdater::update_buffers_for_time(
   if (*time_span_end >= time_buffer_.size()) {
     return std::numeric_limits<double>::quiet_NaN();
   }
-  if (*time_span_end > interpolator_length and
-      time_buffer_[*time_span_end - interpolator_length] > time) {
+  if (not detail::time_span_needs_update(time, *time_span_end,
+                                         interpolator_length, time_buffer_)) {
     // the next time an update will be required
     return time_buffer_[*time_span_end - interpolator_length + 1];
   }
@@ -330,8 +340,8 @@ double BondiWorldtubeH5BufferUpdater::update_buffers_for_time(
   if (*time_span_end >= time_buffer_.size()) {
     return std::numeric_limits<double>::quiet_NaN();
   }
-  if (*time_span_end > interpolator_length and
-      time_buffer_[*time_span_end - interpolator_length] > time) {
+  if (not detail::time_span_needs_update(time, *time_span_end,
+                                         interpolator_length, time_buffer_)) {
     // the next time an update will be required
     return time_buffer_[*time_span_end - interpolator_length + 1];
   }
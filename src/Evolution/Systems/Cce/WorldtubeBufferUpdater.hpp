@@ -82,6 +82,14 @@ std::string dataset_name_for_component(std::string base_name,
 std::pair<size_t, size_t> create_span_for_time_value(
     double time, size_t pad, size_t interpolator_length, size_t lower_bound,
     size_t upper_bound, const DataVector& time_buffer);
+
+// returns `true` if a buffer holding the rows of `time_buffer` up to
+// `time_span_end` must be updated to interpolate to `time` with an interpolator
+// that requires `interpolator_length` points on each side, and `false` if the
+// buffer is sufficient or already extends to the end of the available data.
+bool time_span_needs_update(double time, size_t time_span_end,
+                            size_t interpolator_length,
+                            const DataVector& time_buffer);
 }  // namespace detail
 
 /// the full set of tensors to be extracted from the worldtube h5 file
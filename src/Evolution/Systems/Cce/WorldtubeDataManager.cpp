@@ -29,14 +29,15 @@ MetricWorldtubeDataManager::MetricWorldtubeDataManager(
         buffer_updater,
     const size_t l_max, const size_t buffer_depth,
     std::unique_ptr<intrp::SpanInterpolator> interpolator,
-    const bool fix_spec_normalization)
+    const bool fix_spec_normalization, const bool prefetch_buffers)
     : buffer_updater_{std::move(buffer_updater)},
       l_max_{l_max},
       fix_spec_normalization_{fix_spec_normalization},
       interpolated_coefficients_{
           Spectral::Swsh::size_of_libsharp_coefficient_vector(l_max)},
       buffer_depth_{buffer_depth},
-      interpolator_{std::move(interpolator)} {
+      interpolator_{std::move(interpolator)},
+      buffer_prefetcher_{prefetch_buffers} {
   if (UNLIKELY(
           buffer_updater_->get_time_buffer().size() <
           2 * interpolator_->required_number_of_points_before_and_after())) {
@@ -76,13 +77,11 @@ bool MetricWorldtubeDataManager::populate_hypersurface_boundary_data(
   if (buffer_updater_->time_is_outside_range(time)) {
     return false;
   }
-  hdf5_lock->lock();
-  buffer_updater_->update_buffers_for_time(
+  buffer_prefetcher_.update_buffers_for_time(
       make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
       make_not_null(&time_span_end_), time, l_max_,
       interpolator_->required_number_of_points_before_and_after(),
-      buffer_depth_);
-  hdf5_lock->unlock();
+      buffer_depth_, make_not_null(buffer_updater_.get()), hdf5_lock);
   const auto interpolation_time_span = detail::create_span_for_time_value(
       time, 0, interpolator_->required_number_of_points_before_and_after(),
       time_span_start_, time_span_end_, buffer_updater_->get_time_buffer());
@@ -236,7 +235,8 @@ std::unique_ptr<WorldtubeDataManager> MetricWorldtubeDataManager::get_clone()
     const {
   return std::make_unique<MetricWorldtubeDataManager>(
       buffer_updater_->get_clone(), l_max_, buffer_depth_,
-      interpolator_->get_clone(), fix_spec_normalization_);
+      interpolator_->get_clone(), fix_spec_normalization_,
+      buffer_prefetcher_.prefetch());
 }
 
 std::pair<size_t, size_t> MetricWorldtubeDataManager::get_time_span() const {
@@ -251,6 +251,7 @@ void MetricWorldtubeDataManager::pup(PUP::er& p) {
   p | buffer_depth_;
   p | interpolator_;
   p | fix_spec_normalization_;
+  p | buffer_prefetcher_;
   if (p.isUnpacking()) {
     time_span_start_ = 0;
     time_span_end_ = 0;
@@ -268,13 +269,15 @@ BondiWorldtubeDataManager::BondiWorldtubeDataManager(
     std::unique_ptr<WorldtubeBufferUpdater<cce_bondi_input_tags>>
         buffer_updater,
     const size_t l_max, const size_t buffer_depth,
-    std::unique_ptr<intrp::SpanInterpolator> interpolator)
+    std::unique_ptr<intrp::SpanInterpolator> interpolator,
+    const bool prefetch_buffers)
     : buffer_updater_{std::move(buffer_updater)},
       l_max_{l_max},
       interpolated_coefficients_{
           Spectral::Swsh::size_of_libsharp_coefficient_vector(l_max)},
       buffer_depth_{buffer_depth},
-      interpolator_{std::move(interpolator)} {
+      interpolator_{std::move(interpolator)},
+      buffer_prefetcher_{prefetch_buffers} {
   if (UNLIKELY(
           buffer_updater_->get_time_buffer().size() <
           2 * interpolator_->required_number_of_points_before_and_after())) {
@@ -312,13 +315,11 @@ bool BondiWorldtubeDataManager::populate_hypersurface_boundary_data(
   if (buffer_updater_->time_is_outside_range(time)) {
     return false;
   }
-  hdf5_lock->lock();
-  buffer_updater_->update_buffers_for_time(
+  buffer_prefetcher_.update_buffers_for_time(
       make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
       make_not_null(&time_span_end_), time, l_max_,
       interpolator_->required_number_of_points_before_and_after(),
-      buffer_depth_);
-  hdf5_lock->unlock();
+      buffer_depth_, make_not_null(buffer_updater_.get()), hdf5_lock);
   auto interpolation_time_span = detail::create_span_for_time_value(
       time, 0, interpolator_->required_number_of_points_before_and_after(),
       time_span_start_, time_span_end_, buffer_updater_->get_time_buffer());
@@ -420,7 +421,7 @@ std::unique_ptr<WorldtubeDataManager> BondiWorldtubeDataManager::get_clone()
     const {
   return std::make_unique<BondiWorldtubeDataManager>(
       buffer_updater_->get_clone(), l_max_, buffer_depth_,
-      interpolator_->get_clone());
+      interpolator_->get_clone(), buffer_prefetcher_.prefetch());
 }
 
 std::pair<size_t, size_t> BondiWorldtubeDataManager::get_time_span() const {
@@ -434,6 +435,7 @@ void BondiWorldtubeDataManager::pup(PUP::er& p) {
   p | l_max_;
   p | buffer_depth_;
   p | interpolator_;
+  p | buffer_prefetcher_;
   if (p.isUnpacking()) {
     time_span_start_ = 0;
     time_span_end_ = 0;
@@ -11,6 +11,7 @@
 #include "DataStructures/DataBox/Tag.hpp"
 #include "Evolution/Systems/Cce/BoundaryData.hpp"
 #include "Evolution/Systems/Cce/Tags.hpp"
+#include "Evolution/Systems/Cce/WorldtubeBufferPrefetcher.hpp"
 #include "Evolution/Systems/Cce/WorldtubeBufferUpdater.hpp"
 #include "NumericalAlgorithms/Interpolation/SpanInterpolator.hpp"
 #include "Parallel/CharmPupable.hpp"
@@ -47,6 +48,9 @@ class BondiWorldtubeDataManager;
  *   `std::pair` of indices that represent the start and end point of the
  *   underlying data source. This is primarily used for monitoring the frequency
  *   and size of the buffer updates.
+ * - `WorldtubeDataManager::get_io_wait_time()`: The override should return the
+ *   total time in seconds that has been spent waiting for the underlying data
+ *   source during calls to `populate_hypersurface_boundary_data()`.
  */
 class WorldtubeDataManager : public PUP::able {
  public:
@@ -66,6 +70,8 @@ class WorldtubeDataManager : public PUP::able {
   virtual size_t get_l_max() const = 0;
 
   virtual std::pair<size_t, size_t> get_time_span() const = 0;
+
+  virtual double get_io_wait_time() const = 0;
 };
 
 /*!
@@ -77,6 +83,8 @@ class WorldtubeDataManager : public PUP::able {
  * the `Interpolator` and the `buffer_depth` also passed to the constructor. A
  * longer depth will ensure that the buffer updater is called less frequently,
  * which is useful for slow updaters (e.g. those that perform file access).
+ * If `prefetch_buffers` is `true`, the next buffer is read on a background
+ * thread while the current one is in use (see `WorldtubeBufferPrefetcher`).
  * The main functionality is provided by the
  * `WorldtubeDataManager::populate_hypersurface_boundary_data()` member
  * function that handles buffer updating and boundary computation.
@@ -91,7 +99,7 @@ class MetricWorldtubeDataManager : public WorldtubeDataManager {
           buffer_updater,
       size_t l_max, size_t buffer_depth,
       std::unique_ptr<intrp::SpanInterpolator> interpolator,
-      bool fix_spec_normalization);
+      bool fix_spec_normalization, bool prefetch_buffers = false);
 
   WRAPPED_PUPable_decl_template(MetricWorldtubeDataManager);  // NOLINT
 
@@ -130,6 +138,12 @@ class MetricWorldtubeDataManager : public WorldtubeDataManager {
   /// diagnostics
   std::pair<size_t, size_t> get_time_span() const override;
 
+  /// retrieves the total time spent waiting for the `buffer_updater_` for
+  /// diagnostics
+  double get_io_wait_time() const override {
+    return buffer_prefetcher_.io_wait_time();
+  }
+
   /// Serialization for Charm++.
   void pup(PUP::er& p) override;  // NOLINT
 
@@ -155,6 +169,9 @@ class MetricWorldtubeDataManager : public WorldtubeDataManager {
   size_t buffer_depth_ = 0;
 
   std::unique_ptr<intrp::SpanInterpolator> interpolator_;
+
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable WorldtubeBufferPrefetcher<cce_metric_input_tags> buffer_prefetcher_;
 };
 
 /*!
@@ -166,6 +183,8 @@ class MetricWorldtubeDataManager : public WorldtubeDataManager {
  * the `Interpolator` and the `buffer_depth` also passed to the constructor. A
  * longer depth will ensure that the buffer updater is called less frequently,
  * which is useful for slow updaters (e.g. those that perform file access).
+ * If `prefetch_buffers` is `true`, the next buffer is read on a background
+ * thread while the current one is in use (see `WorldtubeBufferPrefetcher`).
  * The main functionality is provided by the
  * `WorldtubeDataManager::populate_hypersurface_boundary_data()` member
  * function that handles buffer updating and boundary computation. This version
@@ -183,7 +202,8 @@ class BondiWorldtubeDataManager : public WorldtubeDataManager {
       std::unique_ptr<WorldtubeBufferUpdater<cce_bondi_input_tags>>
           buffer_updater,
       size_t l_max, size_t buffer_depth,
-      std::unique_ptr<intrp::SpanInterpolator> interpolator);
+      std::unique_ptr<intrp::SpanInterpolator> interpolator,
+      bool prefetch_buffers = false);
 
   WRAPPED_PUPable_decl_template(BondiWorldtubeDataManager);  // NOLINT
 
@@ -221,6 +241,12 @@ class BondiWorldtubeDataManager : public WorldtubeDataManager {
   /// diagnostics
   std::pair<size_t, size_t> get_time_span() const override;
 
+  /// retrieves the total time spent waiting for the `buffer_updater_` for
+  /// diagnostics
+  double get_io_wait_time() const override {
+    return buffer_prefetcher_.io_wait_time();
+  }
+
   /// Serialization for Charm++.
   void pup(PUP::er& p) override;  // NOLINT
 
@@ -244,5 +270,8 @@ class BondiWorldtubeDataManager : public WorldtubeDataManager {
   size_t buffer_depth_ = 0;
 
   std::unique_ptr<intrp::SpanInterpolator> interpolator_;
+
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable WorldtubeBufferPrefetcher<cce_bondi_input_tags> buffer_prefetcher_;
 };
 }  // namespace Cce
@@ -8,9 +8,12 @@
 #include <cmath>
 #include <cstddef>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tags/TempTensor.hpp"
+#include "DataStructures/TempBuffer.hpp"
 #include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
@@ -18,7 +21,9 @@
 #include "PointwiseFunctions/GeneralRelativity/IndexManipulation.hpp"
 #include "PointwiseFunctions/Hydro/Tags.hpp"
 #include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/ErrorHandling/Exceptions.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/MakeString.hpp"
 #include "Utilities/TMPL.hpp"
 
 // IWYU pragma: no_forward_declare Tensor
@@ -39,6 +44,39 @@ double minerbo_closure_function(const double zeta) {
 double minerbo_closure_deriv(const double zeta) {
   return 0.4 * zeta * (2.0 - zeta + 4.0 * square(zeta));
 }
+
+// Temporaries of the batched closure computation. The names follow the
+// decomposition of J and H_a described in compute_closure_impl_pointwise.
+using VDotMomentum = ::Tags::TempScalar<0>;
+using JZero = ::Tags::TempScalar<1>;
+using JThin = ::Tags::TempScalar<2>;
+using JThick = ::Tags::TempScalar<3>;
+using HZeroT = ::Tags::TempScalar<4>;
+using HZeroV = ::Tags::TempScalar<5>;
+using HZeroF = ::Tags::TempScalar<6>;
+using HThinT = ::Tags::TempScalar<7>;
+using HThinF = ::Tags::TempScalar<8>;
+using HThickT = ::Tags::TempScalar<9>;
+using HThickV = ::Tags::TempScalar<10>;
+using HThickF = ::Tags::TempScalar<11>;
+using HSqrZero = ::Tags::TempScalar<12>;
+using HSqrThin = ::Tags::TempScalar<13>;
+using HSqrThick = ::Tags::TempScalar<14>;
+using HSqrThinThin = ::Tags::TempScalar<15>;
+using HSqrThickThick = ::Tags::TempScalar<16>;
+using HSqrThinThick = ::Tags::TempScalar<17>;
+using DThin = ::Tags::TempScalar<18>;
+using DThinDeriv = ::Tags::TempScalar<19>;
+using EFluid = ::Tags::TempScalar<20>;
+using Residual = ::Tags::TempScalar<21>;
+using ResidualDeriv = ::Tags::TempScalar<22>;
+using ResidualAtLowerBound = ::Tags::TempScalar<23>;
+using LowerBound = ::Tags::TempScalar<24>;
+using UpperBound = ::Tags::TempScalar<25>;
+using ThickVelocityFactor = ::Tags::TempScalar<26>;
+using ThinPressureFactor = ::Tags::TempScalar<27>;
+using ThickPressureFactor = ::Tags::TempScalar<28>;
+using ThickMomentumUp = ::Tags::TempI<29, 3>;
 }  // namespace
 
 namespace RadiationTransport::M1Grey::detail {
@@ -59,6 +97,273 @@ void compute_closure_impl(
     const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric) {
   // Small number used to avoid divisions by zero
   static constexpr double avoid_divisions_by_zero = 1.e-150;
+  // Below small_velocity, we use the v=0 closure
+  static constexpr double small_velocity = 1.e-15;
+  // Dimension of spatial tensors
+  constexpr size_t spatial_dim = 3;
+  // Relative accuracy of the closure factor, and tolerance on the residual
+  // at the edges of the allowed domain of the closure factor
+  constexpr double root_find_tolerance = 1.e-6;
+  constexpr size_t max_iterations = 50;
+  const size_t number_of_points = get(energy_density).size();
+  TempBuffer<tmpl::list<
+      hydro::Tags::LorentzFactorSquared<DataVector>, MomentumSquared,
+      MomentumUp, hydro::Tags::SpatialVelocityOneForm<DataVector, 3>,
+      hydro::Tags::SpatialVelocitySquared<DataVector>, VDotMomentum, JZero,
+      JThin, JThick, HZeroT, HZeroV, HZeroF, HThinT, HThinF, HThickT, HThickV,
+      HThickF, HSqrZero, HSqrThin, HSqrThick, HSqrThinThin, HSqrThickThick,
+      HSqrThinThick, DThin, DThinDeriv, EFluid, Residual, ResidualDeriv,
+      ResidualAtLowerBound, LowerBound, UpperBound, ThickVelocityFactor,
+      ThinPressureFactor, ThickPressureFactor, ThickMomentumUp>>
+      buffer(number_of_points);
+
+  // Fluid quantities and contractions with the inertial moments
+  const DataVector& e = get(energy_density);
+  const DataVector& w = get(fluid_lorentz_factor);
+  DataVector& w_sqr =
+      get(get<hydro::Tags::LorentzFactorSquared<DataVector>>(buffer));
+  w_sqr = square(w);
+  DataVector& v_sqr =
+      get(get<hydro::Tags::SpatialVelocitySquared<DataVector>>(buffer));
+  v_sqr = 1. - 1. / w_sqr;
+  auto& s_M = get<MomentumUp>(buffer);
+  raise_or_lower_index(make_not_null(&s_M), momentum_density,
+                       inv_spatial_metric);
+  auto& s_sqr_scalar = get<MomentumSquared>(buffer);
+  dot_product(make_not_null(&s_sqr_scalar), s_M, momentum_density);
+  DataVector& s_sqr = get(s_sqr_scalar);
+  for (double& s_sqr_pt : s_sqr) {
+    s_sqr_pt = std::max(s_sqr_pt, avoid_divisions_by_zero);
+  }
+  auto& v_m = get<hydro::Tags::SpatialVelocityOneForm<DataVector, 3>>(buffer);
+  raise_or_lower_index(make_not_null(&v_m), fluid_velocity, spatial_metric);
+  auto& v_dot_f_scalar = get<VDotMomentum>(buffer);
+  dot_product(make_not_null(&v_dot_f_scalar), fluid_velocity,
+              momentum_density);
+  const DataVector& v_dot_f = get(v_dot_f_scalar);
+
+  // Decomposition of the fluid-frame energy density and momentum density,
+  // see compute_closure_impl_pointwise for details
+  DataVector& j_0 = get(get<JZero>(buffer));
+  DataVector& j_thin = get(get<JThin>(buffer));
+  DataVector& j_thick = get(get<JThick>(buffer));
+  j_0 = w_sqr * (e - 2. * v_dot_f);
+  j_thin = w_sqr * e * square(v_dot_f) / s_sqr;
+  j_thick = (w_sqr - 1.) / (1. + 2. * w_sqr) *
+            (4. * w_sqr * v_dot_f + e * (3. - 2. * w_sqr));
+  DataVector& h_0_t = get(get<HZeroT>(buffer));
+  DataVector& h_0_v = get(get<HZeroV>(buffer));
+  DataVector& h_0_f = get(get<HZeroF>(buffer));
+  DataVector& h_thin_t = get(get<HThinT>(buffer));
+  const DataVector& h_thin_v = h_thin_t;
+  DataVector& h_thin_f = get(get<HThinF>(buffer));
+  DataVector& h_thick_t = get(get<HThickT>(buffer));
+  DataVector& h_thick_v = get(get<HThickV>(buffer));
+  DataVector& h_thick_f = get(get<HThickF>(buffer));
+  h_0_t = w * (j_0 + v_dot_f - e);
+  h_0_v = w * j_0;
+  h_0_f = -w;
+  h_thin_t = w * j_thin;
+  h_thin_f = w * e * v_dot_f / s_sqr;
+  h_thick_t = w * j_thick;
+  h_thick_v = h_thick_t + w / (2. * w_sqr + 1.) *
+                              ((3. - 2. * w_sqr) * e +
+                               (2. * w_sqr - 1.) * v_dot_f);
+  h_thick_f = w * v_sqr;
+  DataVector& h_sqr_0 = get(get<HSqrZero>(buffer));
+  DataVector& h_sqr_thin = get(get<HSqrThin>(buffer));
+  DataVector& h_sqr_thick = get(get<HSqrThick>(buffer));
+  DataVector& h_sqr_thin_thin = get(get<HSqrThinThin>(buffer));
+  DataVector& h_sqr_thick_thick = get(get<HSqrThickThick>(buffer));
+  DataVector& h_sqr_thin_thick = get(get<HSqrThinThick>(buffer));
+  h_sqr_0 = -square(h_0_t) + square(h_0_v) * v_sqr + square(h_0_f) * s_sqr +
+            2. * h_0_v * h_0_f * v_dot_f;
+  h_sqr_thin =
+      2. * (h_0_v * h_thin_v * v_sqr + h_0_f * h_thin_f * s_sqr +
+            h_0_v * h_thin_f * v_dot_f + h_0_f * h_thin_v * v_dot_f -
+            h_0_t * h_thin_t);
+  h_sqr_thick =
+      2. * (h_0_v * h_thick_v * v_sqr + h_0_f * h_thick_f * s_sqr +
+            h_0_v * h_thick_f * v_dot_f + h_0_f * h_thick_v * v_dot_f -
+            h_0_t * h_thick_t);
+  h_sqr_thin_thick =
+      2. * (h_thin_v * h_thick_v * v_sqr + h_thin_f * h_thick_f * s_sqr +
+            h_thin_v * h_thick_f * v_dot_f + h_thin_f * h_thick_v * v_dot_f -
+            h_thin_t * h_thick_t);
+  h_sqr_thick_thick = square(h_thick_v) * v_sqr + square(h_thick_f) * s_sqr +
+                      2. * h_thick_v * h_thick_f * v_dot_f -
+                      square(h_thick_t);
+  h_sqr_thin_thin = square(h_thin_v) * v_sqr + square(h_thin_f) * s_sqr +
+                    2. * h_thin_v * h_thin_f * v_dot_f - square(h_thin_t);
+
+  // Residual (zeta^2 J^2 - H^a H_a) / E^2 and its derivative with respect to
+  // zeta, at all points. With the Minerbo closure,
+  // d_thin = 1.5 chi - 0.5 and d_thick = 1 - d_thin.
+  DataVector& zeta = get(*closure_factor);
+  DataVector& d_thin = get(get<DThin>(buffer));
+  DataVector& d_thin_deriv = get(get<DThinDeriv>(buffer));
+  DataVector& e_fluid = get(get<EFluid>(buffer));
+  DataVector& residual = get(get<Residual>(buffer));
+  DataVector& residual_deriv = get(get<ResidualDeriv>(buffer));
+  const auto compute_residual = [&]() {
+    d_thin = 1.5 * (1. / 3. + square(zeta) * (0.4 - 2. / 15. * zeta +
+                                              0.4 * square(zeta))) -
+             0.5;
+    d_thin_deriv = 0.6 * zeta * (2. - zeta + 4. * square(zeta));
+    e_fluid = j_0 + j_thin * d_thin + j_thick * (1. - d_thin);
+    residual = (square(e_fluid * zeta) -
+                (h_sqr_0 + h_sqr_thick * (1. - d_thin) + h_sqr_thin * d_thin +
+                 h_sqr_thin_thin * square(d_thin) +
+                 h_sqr_thick_thick * square(1. - d_thin) +
+                 h_sqr_thin_thick * d_thin * (1. - d_thin))) /
+               square(e);
+    // d_thick_deriv = -d_thin_deriv
+    residual_deriv =
+        (2. * e_fluid * (j_thin - j_thick) * d_thin_deriv * square(zeta) +
+         2. * square(e_fluid) * zeta -
+         d_thin_deriv *
+             (h_sqr_thin + h_sqr_thin_thick * (1. - d_thin) +
+              2. * h_sqr_thin_thin * d_thin -
+              (h_sqr_thick + h_sqr_thin_thick * d_thin +
+               2. * h_sqr_thick_thick * (1. - d_thin)))) /
+        square(e);
+  };
+
+  // Residuals at the edges of the allowed domain of zeta: d_thin = 0 at
+  // zeta = 0 and d_thin = 1 at zeta = 1.
+  DataVector& residual_at_lower_bound = get(get<ResidualAtLowerBound>(buffer));
+  residual_at_lower_bound =
+      -(h_sqr_0 + h_sqr_thick + h_sqr_thick_thick) / square(e);
+  residual = (square(j_0 + j_thin) - (h_sqr_0 + h_sqr_thin + h_sqr_thin_thin)) /
+             square(e);
+
+  // Points that need root finding, with their initial guess. The previous
+  // value of the closure factor is used as the guess if it is in (0, 1), and
+  // the value for zero velocity otherwise.
+  DataVector& lower_bound = get(get<LowerBound>(buffer));
+  DataVector& upper_bound = get(get<UpperBound>(buffer));
+  std::vector<size_t> unconverged_points{};
+  unconverged_points.reserve(number_of_points);
+  for (size_t s = 0; s < number_of_points; ++s) {
+    if (v_sqr[s] < small_velocity) {
+      zeta[s] = sqrt(s_sqr[s]) / e[s];
+    } else if (fabs(residual_at_lower_bound[s]) < root_find_tolerance) {
+      zeta[s] = 0.;
+    } else if (fabs(residual[s]) < root_find_tolerance) {
+      zeta[s] = 1.;
+    } else {
+      lower_bound[s] = 0.;
+      upper_bound[s] = 1.;
+      if (not(zeta[s] > avoid_divisions_by_zero and zeta[s] < 1.)) {
+        zeta[s] = std::min(sqrt(s_sqr[s]) / e[s], 1.);
+      }
+      unconverged_points.push_back(s);
+    }
+  }
+
+  // Newton-Raphson iterations on all points at once. Converged points are
+  // dropped from unconverged_points and no longer updated. The bracket
+  // [lower_bound, upper_bound] of the root is narrowed at each iteration,
+  // and steps leaving it are replaced by bisection.
+  for (size_t iteration = 0; not unconverged_points.empty(); ++iteration) {
+    if (iteration == max_iterations) {
+      const size_t s = unconverged_points.front();
+      throw convergence_error(
+          MakeString{} << "M1 closure reached max iterations of "
+                       << max_iterations << " without converging at "
+                       << unconverged_points.size()
+                       << " points. Best result at the first of them is: "
+                       << zeta[s] << " with residual " << residual[s]);
+    }
+    compute_residual();
+    size_t number_of_unconverged_points = 0;
+    for (const size_t s : unconverged_points) {
+      if (residual[s] == 0.) {
+        continue;
+      }
+      if ((residual[s] > 0.) == (residual_at_lower_bound[s] > 0.)) {
+        lower_bound[s] = zeta[s];
+      } else {
+        upper_bound[s] = zeta[s];
+      }
+      double new_zeta = zeta[s] - residual[s] / residual_deriv[s];
+      // Also catches a vanishing derivative
+      if (not(new_zeta > lower_bound[s] and new_zeta < upper_bound[s])) {
+        new_zeta = 0.5 * (lower_bound[s] + upper_bound[s]);
+      }
+      const double step = new_zeta - zeta[s];
+      zeta[s] = new_zeta;
+      if (fabs(step) >
+          root_find_tolerance * std::max(fabs(new_zeta), root_find_tolerance)) {
+        unconverged_points[number_of_unconverged_points] = s;
+        ++number_of_unconverged_points;
+      }
+    }
+    unconverged_points.resize(number_of_unconverged_points);
+  }
+
+  // Assemble output quantities. For the points with negligible fluid velocity
+  // these reduce to the v=0 closure.
+  d_thin = 1.5 * (1. / 3. + square(zeta) * (0.4 - 2. / 15. * zeta +
+                                            0.4 * square(zeta))) -
+           0.5;
+  get(*comoving_energy_density) =
+      j_0 + j_thin * d_thin + j_thick * (1. - d_thin);
+  get(*comoving_momentum_density_normal) =
+      h_0_t + h_thin_t * d_thin + h_thick_t * (1. - d_thin);
+  // Coefficients of v_a and F_a in H_a, reusing the residual buffers
+  DataVector& h_v = residual;
+  DataVector& h_f = residual_deriv;
+  h_v = h_0_v + h_thin_v * d_thin + h_thick_v * (1. - d_thin);
+  h_f = h_0_f + h_thin_f * d_thin + h_thick_f * (1. - d_thin);
+  for (size_t i = 0; i < spatial_dim; i++) {
+    comoving_momentum_density_spatial->get(i) =
+        -h_v * v_m.get(i) - h_f * momentum_density.get(i);
+  }
+  // Optically thin and thick parts of the pressure tensor
+  DataVector& thin_factor = get(get<ThinPressureFactor>(buffer));
+  thin_factor = d_thin * e / s_sqr;
+  DataVector& thick_factor = get(get<ThickPressureFactor>(buffer));
+  thick_factor = (1. - d_thin) / (2. * w_sqr + 1.) *
+                 ((2. * w_sqr - 1.) * e - 2. * w_sqr * v_dot_f);
+  DataVector& thick_velocity_factor = get(get<ThickVelocityFactor>(buffer));
+  thick_velocity_factor = w / (2. * w_sqr + 1.) *
+                          ((4. * w_sqr + 1.) * v_dot_f - 4. * w_sqr * e);
+  auto& h_M = get<ThickMomentumUp>(buffer);
+  for (size_t i = 0; i < spatial_dim; i++) {
+    // Includes the factors d_thick * W of the pressure tensor
+    h_M.get(i) = (1. - d_thin) * (s_M.get(i) + w * thick_velocity_factor *
+                                                   fluid_velocity.get(i));
+  }
+  for (size_t i = 0; i < spatial_dim; i++) {
+    for (size_t j = i; j < spatial_dim; j++) {
+      pressure_tensor->get(i, j) =
+          thin_factor * momentum_density.get(i) * momentum_density.get(j) +
+          thick_factor * (4. * w_sqr * fluid_velocity.get(i) *
+                              fluid_velocity.get(j) +
+                          inv_spatial_metric.get(i, j)) +
+          h_M.get(i) * fluid_velocity.get(j) +
+          h_M.get(j) * fluid_velocity.get(i);
+    }
+  }
+}
+
+void compute_closure_impl_pointwise(
+    const gsl::not_null<Scalar<DataVector>*> closure_factor,
+    const gsl::not_null<tnsr::II<DataVector, 3, Frame::Inertial>*>
+        pressure_tensor,
+    const gsl::not_null<Scalar<DataVector>*> comoving_energy_density,
+    const gsl::not_null<Scalar<DataVector>*> comoving_momentum_density_normal,
+    const gsl::not_null<tnsr::i<DataVector, 3, Frame::Inertial>*>
+        comoving_momentum_density_spatial,
+    const Scalar<DataVector>& energy_density,
+    const tnsr::i<DataVector, 3, Frame::Inertial>& momentum_density,
+    const tnsr::I<DataVector, 3, Frame::Inertial>& fluid_velocity,
+    const Scalar<DataVector>& fluid_lorentz_factor,
+    const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
+    const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric) {
+  // Small number used to avoid divisions by zero
+  static constexpr double avoid_divisions_by_zero = 1.e-150;
   // Below small_velocity, we use the v=0 closure,
   // and we do not differentiate between fluid/inertial frames
   static constexpr double small_velocity = 1.e-15;
@@ -226,7 +531,7 @@ void compute_closure_impl(
             (square(e_fluid * local_zeta) - h_sqr) / square(e_pt),
             (2. * e_fluid * de_fluid_dzeta * square(local_zeta) +
              2. * square(e_fluid) * local_zeta - d_thin_dzeta * dh_sqr_dd_thin -
-             d_thin_dzeta * dh_sqr_dd_thick) /
+             d_thick_dzeta * dh_sqr_dd_thick) /
                 square(e_pt));
       };
       const double& zeta = get(*closure_factor)[s];
@@ -257,15 +562,15 @@ void compute_closure_impl(
       get(*comoving_momentum_density_normal)[s] =
           h_0_t + h_thin_t * d_thin + h_thick_t * d_thick;
       for (size_t i = 0; i < spatial_dim; i++) {
-        comoving_momentum_density_spatial->get(i) =
+        comoving_momentum_density_spatial->get(i)[s] =
             -(h_0_v + h_thin_v * d_thin + h_thick_v * d_thick) * v_m.get(i)[s] -
             (h_0_f + h_thin_f * d_thin + h_thick_f * d_thick) *
                 momentum_density.get(i)[s];
         for (size_t j = i; j < spatial_dim; j++) {
           // Optically thin part of pressure tensor
-          pressure_tensor->get(i, j) = d_thin * e_pt *
-                                       momentum_density.get(i)[s] *
-                                       momentum_density.get(j)[s] / s_sqr_pt;
+          pressure_tensor->get(i, j)[s] = d_thin * e_pt *
+                                          momentum_density.get(i)[s] *
+                                          momentum_density.get(j)[s] / s_sqr_pt;
         }
       }
       // Optically thick limit
@@ -280,7 +585,7 @@ void compute_closure_impl(
           ((2. * w_sqr_pt - 1.) * e_pt - 2. * w_sqr_pt * v_dot_f_pt);
       for (size_t i = 0; i < spatial_dim; i++) {
         for (size_t j = i; j < spatial_dim; j++) {
-          pressure_tensor->get(i, j) +=
+          pressure_tensor->get(i, j)[s] +=
               d_thick * (J_over_3 * (4. * w_sqr_pt * fluid_velocity.get(i)[s] *
                                          fluid_velocity.get(j)[s] +
                                      inv_spatial_metric.get(i, j)[s]) +
@@ -38,6 +38,22 @@ void compute_closure_impl(
     const Scalar<DataVector>& fluid_lorentz_factor,
     const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
     const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric);
+
+// The same closure computed point by point, with a scalar root find at each
+// point. Kept for comparisons with the batched solve in tests and benchmarks.
+void compute_closure_impl_pointwise(
+    gsl::not_null<Scalar<DataVector>*> closure_factor,
+    gsl::not_null<tnsr::II<DataVector, 3, Frame::Inertial>*> pressure_tensor,
+    gsl::not_null<Scalar<DataVector>*> comoving_energy_density,
+    gsl::not_null<Scalar<DataVector>*> comoving_momentum_density_normal,
+    gsl::not_null<tnsr::i<DataVector, 3, Frame::Inertial>*>
+        comoving_momentum_density_spatial,
+    const Scalar<DataVector>& energy_density,
+    const tnsr::i<DataVector, 3, Frame::Inertial>& momentum_density,
+    const tnsr::I<DataVector, 3, Frame::Inertial>& fluid_velocity,
+    const Scalar<DataVector>& fluid_lorentz_factor,
+    const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
+    const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric);
 }  // namespace detail
 
 template <typename NeutrinoSpeciesList>
@@ -101,9 +117,19 @@ struct ComputeM1Closure;
  * for a given \f$\xi\f$ only requires recomputing \f$d_{\rm thin,thick}\f$
  * and their derivatives with respect to \f$\xi\f$.
  * We perform the root-finding using a Newton-Raphson algorithm, with the
- * accuracy set by the variable root_find_number_of_digits (6 significant digits
+ * accuracy set by the variable root_find_tolerance (6 significant digits
  * at the moment).
  *
+ * The root-finding is batched over all grid points: each Newton-Raphson
+ * iteration evaluates the residual and its derivative at all points with
+ * whole-`DataVector` operations, and then updates the closure factor only at
+ * the points that have not yet converged. At each point the iterate is kept
+ * inside a bracket of the root, falling back to bisection whenever a Newton
+ * step would leave the bracket. The pressure tensor and the comoving moments
+ * are then assembled with whole-`DataVector` operations. When the fluid
+ * velocity is negligible (\f$v^2 < 10^{-15}\f$) the closure factor is set to
+ * its zero-velocity value \f$\xi = \sqrt{S^aS_a}/E\f$ without root-finding.
+ *
  * The function returns the closure factors \f$\xi\f$ (to be used as initial
  * guess for this function at the next step), the pressure tensor \f$P_{ij}\f$,
  * and the neutrino moments in the frame comoving with the fluid.
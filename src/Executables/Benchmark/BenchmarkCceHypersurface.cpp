@@ -0,0 +1,80 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <complex>
+#include <cstddef>
+
+#include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/SpinWeighted.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Evolution/Systems/Cce/LinearSolve.hpp"
+#include "Evolution/Systems/Cce/Tags.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "NumericalAlgorithms/Spectral/SwshCollocation.hpp"
+#include "Utilities/Gsl.hpp"
+
+// Measures the scaling with the number of threads of the radial integration of
+// the CCE hypersurface equation for `BondiH`, which is the most expensive of
+// the radial integrations because it requires a linear solve at each angular
+// collocation point.  The benchmark argument is the number of threads.
+
+namespace {
+constexpr size_t l_max = 24;
+constexpr size_t number_of_radial_points = 15;
+
+// clang-tidy: don't pass be non-const reference
+void bench_radial_integrate_bondi_h(benchmark::State& state) {  // NOLINT
+  const size_t number_of_threads = static_cast<size_t>(state.range(0));
+  const size_t number_of_angular_points =
+      Spectral::Swsh::number_of_swsh_collocation_points(l_max);
+  const size_t number_of_grid_points =
+      number_of_angular_points * number_of_radial_points;
+
+  // The integrands and factors are typical of a weak-field evolution, with
+  // the linear factor close to one.
+  const Scalar<SpinWeighted<ComplexDataVector, 2>> pole_of_integrand{
+      number_of_grid_points, std::complex<double>{1.0e-3, 2.0e-3}};
+  const Scalar<SpinWeighted<ComplexDataVector, 2>> regular_integrand{
+      number_of_grid_points, std::complex<double>{2.0e-3, -1.0e-3}};
+  const Scalar<SpinWeighted<ComplexDataVector, 0>> linear_factor{
+      number_of_grid_points, std::complex<double>{1.0, 1.0e-2}};
+  const Scalar<SpinWeighted<ComplexDataVector, 4>> linear_factor_of_conjugate{
+      number_of_grid_points, std::complex<double>{1.0e-2, 0.0}};
+  const Scalar<SpinWeighted<ComplexDataVector, 2>> boundary{
+      number_of_angular_points, std::complex<double>{1.0e-2, 0.0}};
+
+  Scalar<SpinWeighted<ComplexDataVector, 0>> one_minus_y{
+      number_of_grid_points};
+  const DataVector one_minus_y_collocation =
+      1.0 - Spectral::collocation_points<Spectral::Basis::Legendre,
+                                         Spectral::Quadrature::GaussLobatto>(
+                number_of_radial_points);
+  for (size_t i = 0; i < number_of_radial_points; ++i) {
+    ComplexDataVector angular_view{
+        get(one_minus_y).data().data() + number_of_angular_points * i,
+        number_of_angular_points};
+    angular_view = one_minus_y_collocation[i];
+  }
+
+  Scalar<SpinWeighted<ComplexDataVector, 2>> bondi_h{number_of_grid_points};
+  for (auto _ : state) {
+    Cce::RadialIntegrateBondi<Cce::Tags::BoundaryValue, Cce::Tags::BondiH>::
+        apply(make_not_null(&bondi_h), pole_of_integrand, regular_integrand,
+              linear_factor, linear_factor_of_conjugate, boundary, one_minus_y,
+              l_max, number_of_radial_points, number_of_threads);
+    benchmark::DoNotOptimize(get(bondi_h).data().data());
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(bench_radial_integrate_bondi_h)  // NOLINT
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->UseRealTime();
+}  // namespace
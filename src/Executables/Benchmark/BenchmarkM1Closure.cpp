@@ -0,0 +1,128 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <cmath>
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
+#include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
+#include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Evolution/Systems/RadiationTransport/M1Grey/M1Closure.hpp"
+#include "Utilities/Gsl.hpp"
+
+// Compares the batched computation of the M1 closure with the point-by-point
+// computation on a 10^3 grid.  The benchmark argument is the ratio of the
+// magnitude of the momentum density to the energy density in percent, which
+// goes from the optically thick (0) to the optically thin (100) regime.  The
+// fluid velocity is large enough that the closure factor is found by
+// root-finding at every point.
+
+namespace {
+constexpr size_t number_of_points = 1000;
+
+struct ClosureData {
+  explicit ClosureData(const double flux_fraction)
+      : energy_density(number_of_points),
+        momentum_density(number_of_points),
+        fluid_velocity(number_of_points),
+        fluid_lorentz_factor(number_of_points),
+        spatial_metric(number_of_points),
+        closure_factor(number_of_points, 0.),
+        pressure_tensor(number_of_points),
+        comoving_energy_density(number_of_points),
+        comoving_momentum_density_normal(number_of_points),
+        comoving_momentum_density_spatial(number_of_points) {
+    for (size_t m = 0; m < 3; m++) {
+      spatial_metric.get(m, m) = 1. + 0.1 * m * m;
+      for (size_t n = m + 1; n < 3; n++) {
+        spatial_metric.get(m, n) = 0.1 * (m + n);
+      }
+    }
+    inv_spatial_metric = determinant_and_inverse(spatial_metric).second;
+    // Vary the direction of the momentum density and of the fluid velocity,
+    // and the energy density, over the grid.
+    for (size_t s = 0; s < number_of_points; ++s) {
+      const double phase = 0.01 * static_cast<double>(s);
+      get(energy_density)[s] = 1. + 0.5 * sin(phase);
+      for (size_t m = 0; m < 3; m++) {
+        momentum_density.get(m)[s] = cos(phase + 2. * m);
+        fluid_velocity.get(m)[s] = 0.2 * sin(2. * phase + m);
+      }
+    }
+    const auto momentum_magnitude =
+        magnitude(momentum_density, inv_spatial_metric);
+    for (size_t m = 0; m < 3; m++) {
+      momentum_density.get(m) *=
+          flux_fraction * get(energy_density) / get(momentum_magnitude);
+    }
+    get(fluid_lorentz_factor) =
+        1. / sqrt(1. - get(dot_product(fluid_velocity, fluid_velocity,
+                                       spatial_metric)));
+  }
+
+  Scalar<DataVector> energy_density;
+  tnsr::i<DataVector, 3, Frame::Inertial> momentum_density;
+  tnsr::I<DataVector, 3, Frame::Inertial> fluid_velocity;
+  Scalar<DataVector> fluid_lorentz_factor;
+  tnsr::ii<DataVector, 3, Frame::Inertial> spatial_metric;
+  tnsr::II<DataVector, 3, Frame::Inertial> inv_spatial_metric;
+  Scalar<DataVector> closure_factor;
+  tnsr::II<DataVector, 3, Frame::Inertial> pressure_tensor;
+  Scalar<DataVector> comoving_energy_density;
+  Scalar<DataVector> comoving_momentum_density_normal;
+  tnsr::i<DataVector, 3, Frame::Inertial> comoving_momentum_density_spatial;
+};
+
+template <typename ComputeClosure>
+void run_closure(benchmark::State& state,  // NOLINT
+                 const ComputeClosure& compute_closure) {
+  ClosureData data(0.01 * static_cast<double>(state.range(0)));
+  for (auto _ : state) {
+    // Start every iteration from the same initial guess, rather than from
+    // the converged closure factor of the previous iteration.
+    get(data.closure_factor) = 0.;
+    compute_closure(make_not_null(&data.closure_factor),
+                    make_not_null(&data.pressure_tensor),
+                    make_not_null(&data.comoving_energy_density),
+                    make_not_null(&data.comoving_momentum_density_normal),
+                    make_not_null(&data.comoving_momentum_density_spatial),
+                    data.energy_density, data.momentum_density,
+                    data.fluid_velocity, data.fluid_lorentz_factor,
+                    data.spatial_metric, data.inv_spatial_metric);
+    benchmark::DoNotOptimize(data.pressure_tensor);
+  }
+  state.counters["PointsPerSecond"] =
+      benchmark::Counter(static_cast<double>(number_of_points),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// clang-tidy: don't pass be non-const reference
+void bench_m1_closure_batched(benchmark::State& state) {  // NOLINT
+  run_closure(state, RadiationTransport::M1Grey::detail::compute_closure_impl);
+}
+BENCHMARK(bench_m1_closure_batched)  // NOLINT
+    ->Arg(0)
+    ->Arg(10)
+    ->Arg(50)
+    ->Arg(90)
+    ->Arg(99);
+
+// clang-tidy: don't pass be non-const reference
+void bench_m1_closure_pointwise(benchmark::State& state) {  // NOLINT
+  run_closure(
+      state,
+      RadiationTransport::M1Grey::detail::compute_closure_impl_pointwise);
+}
+BENCHMARK(bench_m1_closure_pointwise)  // NOLINT
+    ->Arg(0)
+    ->Arg(10)
+    ->Arg(50)
+    ->Arg(90)
+    ->Arg(99);
+}  // namespace
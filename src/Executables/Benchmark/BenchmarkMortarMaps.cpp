@@ -0,0 +1,116 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <boost/functional/hash.hpp>
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionalIdMap.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/MaxNumberOfNeighbors.hpp"
+
+// Compares the storage of the mortar data of a 3D element in a
+// `DirectionalIdMap` with storage in a `std::unordered_map`, for the access
+// patterns of the boundary correction: looking up the data on each mortar of
+// the element, and iterating over all mortars. The benchmark argument is the
+// number of neighbors in each direction, so the element has between 6 and
+// `maximum_number_of_neighbors(3)` mortars.
+
+namespace {
+constexpr size_t dim = 3;
+constexpr size_t number_of_face_points = 25;
+using Key = std::pair<Direction<dim>, ElementId<dim>>;
+
+std::vector<Key> mortar_ids(const size_t neighbors_per_direction) {
+  std::vector<Key> result{};
+  for (const auto& direction : Direction<dim>::all_directions()) {
+    for (size_t i = 0; i < neighbors_per_direction; ++i) {
+      result.emplace_back(direction, ElementId<dim>{result.size()});
+    }
+  }
+  return result;
+}
+
+template <typename Map>
+Map make_mortar_data(const std::vector<Key>& keys) {
+  Map result{};
+  for (size_t i = 0; i < keys.size(); ++i) {
+    result.emplace(keys[i], DataVector(number_of_face_points,
+                                       static_cast<double>(i)));
+  }
+  return result;
+}
+
+template <typename Map>
+void run_lookup(benchmark::State& state) {  // NOLINT
+  const auto keys = mortar_ids(static_cast<size_t>(state.range(0)));
+  const auto mortar_data = make_mortar_data<Map>(keys);
+  for (auto _ : state) {
+    double sum = 0.0;
+    for (const auto& key : keys) {
+      sum += mortar_data.at(key)[0];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.counters["MortarsPerSecond"] =
+      benchmark::Counter(static_cast<double>(keys.size()),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+template <typename Map>
+void run_iteration(benchmark::State& state) {  // NOLINT
+  const auto keys = mortar_ids(static_cast<size_t>(state.range(0)));
+  const auto mortar_data = make_mortar_data<Map>(keys);
+  for (auto _ : state) {
+    double sum = 0.0;
+    for (const auto& [mortar_id, data] : mortar_data) {
+      sum += data[mortar_id.second.block_id() % number_of_face_points];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.counters["MortarsPerSecond"] =
+      benchmark::Counter(static_cast<double>(keys.size()),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+using FixedMap = DirectionalIdMap<dim, DataVector>;
+using UnorderedMap = std::unordered_map<Key, DataVector, boost::hash<Key>>;
+constexpr long max_neighbors_per_direction =
+    static_cast<long>(maximum_number_of_neighbors(dim) / (2 * dim));
+
+// clang-tidy: don't pass be non-const reference
+void bench_mortar_lookup_fixed(benchmark::State& state) {  // NOLINT
+  run_lookup<FixedMap>(state);
+}
+BENCHMARK(bench_mortar_lookup_fixed)  // NOLINT
+    ->DenseRange(1, max_neighbors_per_direction);
+
+// clang-tidy: don't pass be non-const reference
+void bench_mortar_lookup_unordered(benchmark::State& state) {  // NOLINT
+  run_lookup<UnorderedMap>(state);
+}
+BENCHMARK(bench_mortar_lookup_unordered)  // NOLINT
+    ->DenseRange(1, max_neighbors_per_direction);
+
+// clang-tidy: don't pass be non-const reference
+void bench_mortar_iteration_fixed(benchmark::State& state) {  // NOLINT
+  run_iteration<FixedMap>(state);
+}
+BENCHMARK(bench_mortar_iteration_fixed)  // NOLINT
+    ->DenseRange(1, max_neighbors_per_direction);
+
+// clang-tidy: don't pass be non-const reference
+void bench_mortar_iteration_unordered(benchmark::State& state) {  // NOLINT
+  run_iteration<UnorderedMap>(state);
+}
+BENCHMARK(bench_mortar_iteration_unordered)  // NOLINT
+    ->DenseRange(1, max_neighbors_per_direction);
+}  // namespace
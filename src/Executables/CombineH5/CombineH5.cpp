@@ -4,6 +4,7 @@
 #include <boost/program_options.hpp>
 #include <cstddef>
 #include <iterator>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -47,8 +48,40 @@ size_t get_number_of_elements(const std::vector<std::string>& input_filenames,
   return total_elements;
 }
 
+// Concatenates the datasets of the input files for each observation id
+// without decoding them. All input files stay open and the output subfile is
+// opened once, and at most `max_buffer_size` points of a dataset are held in
+// memory at a time.
+void concatenate_h5(const std::vector<std::string>& file_names,
+                    const std::vector<size_t>& observation_ids,
+                    const std::string& subfile_name, const std::string& output,
+                    const size_t max_buffer_size) {
+  std::vector<std::unique_ptr<h5::H5File<h5::AccessType::ReadOnly>>>
+      input_files{};
+  std::vector<const h5::VolumeData*> input_volume_files{};
+  input_files.reserve(file_names.size());
+  input_volume_files.reserve(file_names.size());
+  for (const auto& file_name : file_names) {
+    input_files.push_back(
+        std::make_unique<h5::H5File<h5::AccessType::ReadOnly>>(file_name,
+                                                                false));
+    input_volume_files.push_back(
+        &input_files.back()->get<h5::VolumeData>("/" + subfile_name));
+  }
+
+  h5::H5File<h5::AccessType::ReadWrite> new_file(output + "0.h5", true);
+  auto& new_volume_file =
+      new_file.try_insert<h5::VolumeData>("/" + subfile_name + ".vol");
+  for (const auto& obs_id : observation_ids) {
+    new_volume_file.write_concatenated_volume_data(obs_id, input_volume_files,
+                                                   max_buffer_size);
+  }
+  new_file.close_current_object();
+}
+
 void combine_h5(const std::string& file_prefix, const std::string& subfile_name,
-                const std::string& output) {
+                const std::string& output, const bool concatenate,
+                const size_t max_buffer_size) {
   // Parses for and stores all input files to be looped over
   const std::vector<std::string>& file_names =
       file_system::glob(file_prefix + "*.h5");
@@ -68,6 +101,16 @@ void combine_h5(const std::string& file_prefix, const std::string& subfile_name,
         "executable or were corrupted.");
   }
 
+  // Obtains list of observation ids to loop over
+  const std::vector<size_t> observation_ids =
+      get_observation_ids(file_prefix, subfile_name);
+
+  if (concatenate) {
+    concatenate_h5(file_names, observation_ids, subfile_name, output,
+                   max_buffer_size);
+    return;
+  }
+
   // Braces to specify scope for H5 file
   {
     // Instantiates the output file and the .vol subfile to be filled with the
@@ -77,10 +120,6 @@ void combine_h5(const std::string& file_prefix, const std::string& subfile_name,
     new_file.close_current_object();
   }  // End of scope for H5 file
 
-  // Obtains list of observation ids to loop over
-  const std::vector<size_t> observation_ids =
-      get_observation_ids(file_prefix, subfile_name);
-
   // Loops over observation ids to write volume data by observation id
   for (const auto& obs_id : observation_ids) {
     // Pre-calculates size of vector to store element data and allocates
@@ -138,7 +177,14 @@ int main(int argc, char** argv) {
       "subfile name shared for each volume file in each H5 file (omit file "
       "extension)")("output",
                     boost::program_options::value<std::string>()->required(),
-                    "combined output filename (omit file extension)");
+                    "combined output filename (omit file extension)")(
+      "concatenate",
+      "concatenate the datasets of the files without decoding them, which is "
+      "much faster than decoding and re-encoding the data of every element")(
+      "max_buffer_size",
+      boost::program_options::value<size_t>()->default_value(1'048'576),
+      "maximum number of points of a dataset held in memory at a time with "
+      "--concatenate");
 
   boost::program_options::variables_map vars;
 
@@ -157,5 +203,6 @@ int main(int argc, char** argv) {
 
   combine_h5(vars["file_prefix"].as<std::string>(),
              vars["subfile_name"].as<std::string>(),
-             vars["output"].as<std::string>());
+             vars["output"].as<std::string>(), vars.count("concatenate") != 0u,
+             vars["max_buffer_size"].as<size_t>());
 }
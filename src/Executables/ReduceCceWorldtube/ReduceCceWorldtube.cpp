@@ -1,9 +1,21 @@
 // Distributed under the MIT License.
 // See LICENSE.txt for details.
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <boost/program_options.hpp>
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/ComplexModalVector.hpp"
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -18,7 +30,9 @@
 #include "Evolution/Systems/Cce/WorldtubeBufferUpdater.hpp"
 #include "NumericalAlgorithms/Spectral/SwshCoefficients.hpp"
 #include "NumericalAlgorithms/Spectral/SwshCollocation.hpp"
+#include "NumericalAlgorithms/Spectral/SwshTransform.hpp"
 #include "Parallel/Printf.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -147,132 +161,346 @@ void slice_buffers_to_libsharp_modes(
   }
 }
 
+namespace {
+using reduced_boundary_tags =
+    tmpl::list<Cce::Tags::BoundaryValue<Cce::Tags::BondiBeta>,
+               Cce::Tags::BoundaryValue<Cce::Tags::BondiU>,
+               Cce::Tags::BoundaryValue<Cce::Tags::BondiQ>,
+               Cce::Tags::BoundaryValue<Cce::Tags::BondiW>,
+               Cce::Tags::BoundaryValue<Cce::Tags::BondiJ>,
+               Cce::Tags::BoundaryValue<Cce::Tags::Dr<Cce::Tags::BondiJ>>,
+               Cce::Tags::BoundaryValue<Cce::Tags::Du<Cce::Tags::BondiJ>>,
+               Cce::Tags::BoundaryValue<Cce::Tags::BondiR>,
+               Cce::Tags::BoundaryValue<Cce::Tags::Du<Cce::Tags::BondiR>>>;
+
+using BoundaryDataVariables =
+    Variables<Cce::Tags::characteristic_worldtube_boundary_tags<
+        Cce::Tags::BoundaryValue>>;
+
+// The libsharp coefficients of the input worldtube data at a single time,
+// produced by the reader stage.
+struct TimestepCoefficients {
+  size_t index;
+  double time;
+  Variables<Cce::cce_metric_input_tags> coefficients;
+};
+
+// The output rows for each of the `reduced_boundary_tags` at a single time,
+// produced by the transform workers.
+struct ReducedTimestep {
+  size_t index;
+  std::array<std::vector<double>, tmpl::size<reduced_boundary_tags>::value>
+      rows;
+};
+
+// A queue passing work between the stages of the reduction pipeline. `pop()`
+// blocks until an entry is available, and returns an empty optional once the
+// queue has been closed and emptied.
+template <typename T>
+class WorkQueue {
+ public:
+  void push(T entry) {
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      entries_.push_back(std::move(entry));
+    }
+    condition_.notify_one();
+  }
+
+  std::optional<T> pop() {
+    std::unique_lock<std::mutex> lock{mutex_};
+    condition_.wait(lock, [this]() { return closed_ or not entries_.empty(); });
+    if (entries_.empty()) {
+      return std::nullopt;
+    }
+    T entry = std::move(entries_.front());
+    entries_.pop_front();
+    return entry;
+  }
+
+  void close() {
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      closed_ = true;
+    }
+    condition_.notify_all();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<T> entries_;
+  bool closed_ = false;
+};
+
+// Limits the number of timesteps that have been read but not yet passed to the
+// writer, which bounds the memory used by the pipeline regardless of the
+// relative speeds of the stages.
+class InFlightLimit {
+ public:
+  explicit InFlightLimit(const size_t limit) : available_{limit} {}
+
+  void acquire() {
+    std::unique_lock<std::mutex> lock{mutex_};
+    condition_.wait(lock, [this]() { return available_ > 0; });
+    --available_;
+  }
+
+  void release() {
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      ++available_;
+    }
+    condition_.notify_one();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  size_t available_;
+};
+
+// Compute the boundary data from the input coefficients and transform the
+// `reduced_boundary_tags` to the goldberg modes that are written to the output
+// file. All of the buffers are owned by the calling worker.
+void reduce_timestep(
+    const gsl::not_null<ReducedTimestep*> reduced,
+    const gsl::not_null<BoundaryDataVariables*> boundary_data_variables,
+    const gsl::not_null<ComplexModalVector*> output_goldberg_mode_buffer,
+    const gsl::not_null<ComplexModalVector*> output_libsharp_mode_buffer,
+    const TimestepCoefficients& timestep, const double extraction_radius,
+    const bool apply_spec_normalization_fix, const size_t l_max,
+    const size_t computation_l_max) {
+  const auto& coefficients_set = timestep.coefficients;
+  if (apply_spec_normalization_fix) {
+    Cce::create_bondi_boundary_data_from_unnormalized_spec_modes(
+        boundary_data_variables,
+        get<Cce::Tags::detail::SpatialMetric>(coefficients_set),
+        get<Tags::dt<Cce::Tags::detail::SpatialMetric>>(coefficients_set),
+        get<Cce::Tags::detail::Dr<Cce::Tags::detail::SpatialMetric>>(
+            coefficients_set),
+        get<Cce::Tags::detail::Shift>(coefficients_set),
+        get<Tags::dt<Cce::Tags::detail::Shift>>(coefficients_set),
+        get<Cce::Tags::detail::Dr<Cce::Tags::detail::Shift>>(coefficients_set),
+        get<Cce::Tags::detail::Lapse>(coefficients_set),
+        get<Tags::dt<Cce::Tags::detail::Lapse>>(coefficients_set),
+        get<Cce::Tags::detail::Dr<Cce::Tags::detail::Lapse>>(coefficients_set),
+        extraction_radius, computation_l_max);
+  } else {
+    Cce::create_bondi_boundary_data(
+        boundary_data_variables,
+        get<Cce::Tags::detail::SpatialMetric>(coefficients_set),
+        get<Tags::dt<Cce::Tags::detail::SpatialMetric>>(coefficients_set),
+        get<Cce::Tags::detail::Dr<Cce::Tags::detail::SpatialMetric>>(
+            coefficients_set),
+        get<Cce::Tags::detail::Shift>(coefficients_set),
+        get<Tags::dt<Cce::Tags::detail::Shift>>(coefficients_set),
+        get<Cce::Tags::detail::Dr<Cce::Tags::detail::Shift>>(coefficients_set),
+        get<Cce::Tags::detail::Lapse>(coefficients_set),
+        get<Tags::dt<Cce::Tags::detail::Lapse>>(coefficients_set),
+        get<Cce::Tags::detail::Dr<Cce::Tags::detail::Lapse>>(coefficients_set),
+        extraction_radius, computation_l_max);
+  }
+  reduced->index = timestep.index;
+  // loop over the tags that we want to dump.
+  tmpl::for_each<reduced_boundary_tags>([&reduced, &boundary_data_variables,
+                                         &output_goldberg_mode_buffer,
+                                         &output_libsharp_mode_buffer, &l_max,
+                                         &computation_l_max,
+                                         &timestep](auto tag_v) {
+    using tag = typename decltype(tag_v)::type;
+    SpinWeighted<ComplexModalVector, tag::type::type::spin>
+        spin_weighted_libsharp_view;
+    spin_weighted_libsharp_view.set_data_ref(
+        output_libsharp_mode_buffer->data(),
+        output_libsharp_mode_buffer->size());
+    Spectral::Swsh::swsh_transform(
+        computation_l_max, 1, make_not_null(&spin_weighted_libsharp_view),
+        get(get<tag>(*boundary_data_variables)));
+    SpinWeighted<ComplexModalVector, tag::type::type::spin>
+        spin_weighted_goldberg_view;
+    spin_weighted_goldberg_view.set_data_ref(
+        output_goldberg_mode_buffer->data(),
+        output_goldberg_mode_buffer->size());
+    Spectral::Swsh::libsharp_to_goldberg_modes(
+        make_not_null(&spin_weighted_goldberg_view),
+        spin_weighted_libsharp_view, computation_l_max);
+
+    // The goldberg format type is in strictly increasing l modes, so to
+    // reduce to a smaller l_max, we can just take the first (l_max + 1)^2
+    // values.
+    ComplexModalVector reduced_goldberg_view{
+        output_goldberg_mode_buffer->data(), square(l_max + 1)};
+    gsl::at(reduced->rows, tmpl::index_of<reduced_boundary_tags, tag>::value) =
+        Cce::ReducedWorldtubeModeRecorder::worldtube_mode_data_row(
+            timestep.time, reduced_goldberg_view, l_max,
+            tag::type::type::spin == 0);
+  });
+}
+
+double seconds_since(const std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start)
+      .count();
+}
+}  // namespace
+
 // read in the data from a (previously standard) SpEC worldtube file
 // `input_file`, perform the boundary computation, and dump the (considerably
 // smaller) dataset associated with the spin-weighted scalars to `output_file`.
+//
+// The reduction is performed by a pipeline: a reader thread loads the input
+// file and slices each time into a set of libsharp coefficients,
+// `number_of_threads` workers compute the boundary data and the transforms for
+// independent times, and the calling thread reorders the results and writes
+// them to the output in chunks of `write_chunk_size` rows.
 void perform_cce_worldtube_reduction(
     const std::string& input_file, const std::string& output_file,
     const size_t buffer_depth, const size_t l_max_factor,
+    const size_t number_of_threads, const size_t write_chunk_size,
     const bool fix_spec_normalization = false) {
   Cce::MetricWorldtubeH5BufferUpdater buffer_updater{input_file};
   const size_t l_max = buffer_updater.get_l_max();
   // Perform the boundary computation to scalars at twice the input l_max to be
   // absolutely certain that there are no problems associated with aliasing.
   const size_t computation_l_max = l_max_factor * l_max;
+  const double extraction_radius = buffer_updater.get_extraction_radius();
+  const bool apply_spec_normalization_fix =
+      not buffer_updater.has_version_history() and fix_spec_normalization;
+  const size_t number_of_workers = std::max(number_of_threads, size_t{1});
+  const size_t chunk_size = std::max(write_chunk_size, size_t{1});
 
   // we're not interpolating, this is just a reasonable number of rows to ingest
   // at a time.
   const size_t size_of_buffer = square(l_max + 1) * (buffer_depth);
   const DataVector& time_buffer = buffer_updater.get_time_buffer();
+  const size_t number_of_times = time_buffer.size();
 
-  Variables<Cce::cce_metric_input_tags> coefficients_buffers{size_of_buffer};
-  Variables<Cce::cce_metric_input_tags> coefficients_set{
-      Spectral::Swsh::size_of_libsharp_coefficient_vector(computation_l_max)};
-
-  Variables<Cce::Tags::characteristic_worldtube_boundary_tags<
-      Cce::Tags::BoundaryValue>>
-      boundary_data_variables{
-          Spectral::Swsh::number_of_swsh_collocation_points(computation_l_max)};
-
-  using reduced_boundary_tags =
-      tmpl::list<Cce::Tags::BoundaryValue<Cce::Tags::BondiBeta>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::BondiU>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::BondiQ>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::BondiW>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::BondiJ>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::Dr<Cce::Tags::BondiJ>>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::Du<Cce::Tags::BondiJ>>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::BondiR>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::Du<Cce::Tags::BondiR>>>;
-
-  size_t time_span_start = 0;
-  size_t time_span_end = 0;
-  Cce::ReducedWorldtubeModeRecorder recorder{output_file};
+  // The transform metadata (including the libsharp geometry and coefficient
+  // information) is generated lazily, so we generate it before starting the
+  // workers, which then only read it.
+  Spectral::Swsh::cached_coefficients_metadata(computation_l_max);
+  Spectral::Swsh::cached_collocation_metadata<
+      Spectral::Swsh::ComplexRepresentation::Interleaved>(computation_l_max);
 
-  ComplexModalVector output_goldberg_mode_buffer{square(computation_l_max + 1)};
-  ComplexModalVector output_libsharp_mode_buffer{
-      Spectral::Swsh::size_of_libsharp_coefficient_vector(computation_l_max)};
-
-  for (size_t i = 0; i < time_buffer.size(); ++i) {
-    const double time = time_buffer[i];
-    Parallel::printf("reducing data at time : %f / %f \r", time,
-                     time_buffer[time_buffer.size() - 1]);
-    buffer_updater.update_buffers_for_time(
-        make_not_null(&coefficients_buffers), make_not_null(&time_span_start),
-        make_not_null(&time_span_end), time, l_max, 0, buffer_depth);
-
-    slice_buffers_to_libsharp_modes(
-        make_not_null(&coefficients_set), coefficients_buffers,
-        time_span_end - time_span_start, i - time_span_start, l_max,
-        computation_l_max);
-
-    if (not buffer_updater.has_version_history() and fix_spec_normalization) {
-      Cce::create_bondi_boundary_data_from_unnormalized_spec_modes(
-          make_not_null(&boundary_data_variables),
-          get<Cce::Tags::detail::SpatialMetric>(coefficients_set),
-          get<Tags::dt<Cce::Tags::detail::SpatialMetric>>(coefficients_set),
-          get<Cce::Tags::detail::Dr<Cce::Tags::detail::SpatialMetric>>(
-              coefficients_set),
-          get<Cce::Tags::detail::Shift>(coefficients_set),
-          get<Tags::dt<Cce::Tags::detail::Shift>>(coefficients_set),
-          get<Cce::Tags::detail::Dr<Cce::Tags::detail::Shift>>(
-              coefficients_set),
-          get<Cce::Tags::detail::Lapse>(coefficients_set),
-          get<Tags::dt<Cce::Tags::detail::Lapse>>(coefficients_set),
-          get<Cce::Tags::detail::Dr<Cce::Tags::detail::Lapse>>(
-              coefficients_set),
-          buffer_updater.get_extraction_radius(), computation_l_max);
-    } else {
-      Cce::create_bondi_boundary_data(
-          make_not_null(&boundary_data_variables),
-          get<Cce::Tags::detail::SpatialMetric>(coefficients_set),
-          get<Tags::dt<Cce::Tags::detail::SpatialMetric>>(coefficients_set),
-          get<Cce::Tags::detail::Dr<Cce::Tags::detail::SpatialMetric>>(
-              coefficients_set),
-          get<Cce::Tags::detail::Shift>(coefficients_set),
-          get<Tags::dt<Cce::Tags::detail::Shift>>(coefficients_set),
-          get<Cce::Tags::detail::Dr<Cce::Tags::detail::Shift>>(
-              coefficients_set),
-          get<Cce::Tags::detail::Lapse>(coefficients_set),
-          get<Tags::dt<Cce::Tags::detail::Lapse>>(coefficients_set),
-          get<Cce::Tags::detail::Dr<Cce::Tags::detail::Lapse>>(
-              coefficients_set),
-          buffer_updater.get_extraction_radius(), computation_l_max);
+  WorkQueue<TimestepCoefficients> timestep_queue{};
+  WorkQueue<ReducedTimestep> reduced_queue{};
+  InFlightLimit in_flight{2 * number_of_workers + chunk_size};
+
+  const auto start_time = std::chrono::steady_clock::now();
+  std::thread reader{[&buffer_updater, &time_buffer, &timestep_queue,
+                      &in_flight, &size_of_buffer, &number_of_times, &l_max,
+                      &computation_l_max, &buffer_depth]() {
+    Variables<Cce::cce_metric_input_tags> coefficients_buffers{size_of_buffer};
+    size_t time_span_start = 0;
+    size_t time_span_end = 0;
+    for (size_t i = 0; i < number_of_times; ++i) {
+      in_flight.acquire();
+      buffer_updater.update_buffers_for_time(
+          make_not_null(&coefficients_buffers),
+          make_not_null(&time_span_start), make_not_null(&time_span_end),
+          time_buffer[i], l_max, 0, buffer_depth);
+      TimestepCoefficients timestep{
+          i, time_buffer[i],
+          Variables<Cce::cce_metric_input_tags>{
+              Spectral::Swsh::size_of_libsharp_coefficient_vector(
+                  computation_l_max)}};
+      slice_buffers_to_libsharp_modes(make_not_null(&timestep.coefficients),
+                                      coefficients_buffers,
+                                      time_span_end - time_span_start,
+                                      i - time_span_start, l_max,
+                                      computation_l_max);
+      timestep_queue.push(std::move(timestep));
     }
-    // loop over the tags that we want to dump.
-    tmpl::for_each<reduced_boundary_tags>(
-        [&recorder, &boundary_data_variables, &output_goldberg_mode_buffer,
-         &output_libsharp_mode_buffer, &l_max, &computation_l_max,
-         &time](auto tag_v) {
-          using tag = typename decltype(tag_v)::type;
-          SpinWeighted<ComplexModalVector, tag::type::type::spin>
-              spin_weighted_libsharp_view;
-          spin_weighted_libsharp_view.set_data_ref(
-              output_libsharp_mode_buffer.data(),
-              output_libsharp_mode_buffer.size());
-          Spectral::Swsh::swsh_transform(
-              computation_l_max, 1, make_not_null(&spin_weighted_libsharp_view),
-              get(get<tag>(boundary_data_variables)));
-          SpinWeighted<ComplexModalVector, tag::type::type::spin>
-              spin_weighted_goldberg_view;
-          spin_weighted_goldberg_view.set_data_ref(
-              output_goldberg_mode_buffer.data(),
-              output_goldberg_mode_buffer.size());
-          Spectral::Swsh::libsharp_to_goldberg_modes(
-              make_not_null(&spin_weighted_goldberg_view),
-              spin_weighted_libsharp_view, computation_l_max);
-
-          // The goldberg format type is in strictly increasing l modes, so to
-          // reduce to a smaller l_max, we can just take the first (l_max + 1)^2
-          // values.
-          ComplexModalVector reduced_goldberg_view{
-              output_goldberg_mode_buffer.data(), square(l_max + 1)};
-          recorder.append_worldtube_mode_data(
-              "/" + Cce::dataset_label_for_tag<tag>(), time,
-              reduced_goldberg_view, l_max, tag::type::type::spin == 0);
-        });
+    timestep_queue.close();
+  }};
+
+  std::atomic<size_t> running_workers{number_of_workers};
+  const auto work = [&timestep_queue, &reduced_queue, &running_workers,
+                     &extraction_radius, &apply_spec_normalization_fix, &l_max,
+                     &computation_l_max]() {
+    BoundaryDataVariables boundary_data_variables{
+        Spectral::Swsh::number_of_swsh_collocation_points(computation_l_max)};
+    ComplexModalVector output_goldberg_mode_buffer{
+        square(computation_l_max + 1)};
+    ComplexModalVector output_libsharp_mode_buffer{
+        Spectral::Swsh::size_of_libsharp_coefficient_vector(
+            computation_l_max)};
+    while (auto timestep = timestep_queue.pop()) {
+      ReducedTimestep reduced{};
+      reduce_timestep(make_not_null(&reduced),
+                      make_not_null(&boundary_data_variables),
+                      make_not_null(&output_goldberg_mode_buffer),
+                      make_not_null(&output_libsharp_mode_buffer), *timestep,
+                      extraction_radius, apply_spec_normalization_fix, l_max,
+                      computation_l_max);
+      reduced_queue.push(std::move(reduced));
+    }
+    if (--running_workers == 0) {
+      reduced_queue.close();
+    }
+  };
+  std::vector<std::thread> workers{};
+  workers.reserve(number_of_workers);
+  for (size_t i = 0; i < number_of_workers; ++i) {
+    workers.emplace_back(work);
+  }
+
+  // The workers may finish the times out of order, so the results are held
+  // until all earlier times have been written.
+  Cce::ReducedWorldtubeModeRecorder recorder{output_file};
+  std::map<size_t, ReducedTimestep> pending_timesteps{};
+  std::array<std::vector<std::vector<double>>,
+             tmpl::size<reduced_boundary_tags>::value>
+      chunk{};
+  const auto write_chunk = [&recorder, &chunk, &l_max]() {
+    tmpl::for_each<reduced_boundary_tags>([&recorder, &chunk,
+                                           &l_max](auto tag_v) {
+      using tag = typename decltype(tag_v)::type;
+      auto& rows =
+          gsl::at(chunk, tmpl::index_of<reduced_boundary_tags, tag>::value);
+      recorder.append_worldtube_mode_data(
+          "/" + Cce::dataset_label_for_tag<tag>(), rows, l_max,
+          tag::type::type::spin == 0);
+      rows.clear();
+    });
+  };
+  size_t next_index = 0;
+  while (auto reduced = reduced_queue.pop()) {
+    pending_timesteps.emplace(reduced->index, std::move(*reduced));
+    while (not pending_timesteps.empty() and
+           pending_timesteps.begin()->first == next_index) {
+      auto& rows = pending_timesteps.begin()->second.rows;
+      for (size_t tag_index = 0; tag_index < rows.size(); ++tag_index) {
+        gsl::at(chunk, tag_index)
+            .push_back(std::move(gsl::at(rows, tag_index)));
+      }
+      pending_timesteps.erase(pending_timesteps.begin());
+      ++next_index;
+      in_flight.release();
+      if (next_index % chunk_size == 0) {
+        write_chunk();
+      }
+    }
+    if (next_index > 0) {
+      Parallel::printf(
+          "reducing data at time : %f / %f (%.1f timesteps/s) \r",
+          time_buffer[next_index - 1], time_buffer[number_of_times - 1],
+          static_cast<double>(next_index) / seconds_since(start_time));
+    }
+  }
+  write_chunk();
+
+  reader.join();
+  for (auto& worker : workers) {
+    worker.join();
   }
-  Parallel::printf("\n");
+  const double elapsed_time = seconds_since(start_time);
+  Parallel::printf(
+      "\nReduced %zu timesteps in %f s (%.1f timesteps/s) using %zu transform "
+      "threads\n",
+      number_of_times, elapsed_time,
+      static_cast<double>(number_of_times) / elapsed_time, number_of_workers);
 }
 
 /*
@@ -299,7 +527,14 @@ int main(int argc, char** argv) {
       "routines. Higher values mean fewer, larger loads from file into RAM.")(
       "lmax_factor", boost::program_options::value<size_t>()->default_value(2),
       "the boundary computations will be performed at a resolution that is "
-      "lmax_factor times the input file lmax to avoid aliasing");
+      "lmax_factor times the input file lmax to avoid aliasing")(
+      "threads", boost::program_options::value<size_t>()->default_value(1),
+      "number of threads performing the boundary computations and transforms. "
+      "Reading the input file and writing the output file are each performed "
+      "on an additional thread.")(
+      "write_chunk_size",
+      boost::program_options::value<size_t>()->default_value(200),
+      "number of time steps to write to the output file at once.");
 
   boost::program_options::variables_map vars;
 
@@ -320,5 +555,7 @@ int main(int argc, char** argv) {
                                   vars["output_file"].as<std::string>(),
                                   vars["buffer_depth"].as<size_t>(),
                                   vars["lmax_factor"].as<size_t>(),
+                                  vars["threads"].as<size_t>(),
+                                  vars["write_chunk_size"].as<size_t>(),
                                   vars.count("fix_spec_normalization") != 0u);
 }
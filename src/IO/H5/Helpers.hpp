@@ -25,6 +25,13 @@ namespace h5 {
  */
 bool types_equal(hid_t dtype1, hid_t dtype2);
 
+/*!
+ * \ingroup HDF5Group
+ * \brief Check if the HDF5 library was built with thread safety, so that it
+ * can be called concurrently from several threads.
+ */
+bool library_is_threadsafe();
+
 /*!
  * \ingroup HDF5Group
  * \brief Write a std::vector named `name` to the group `group_id`
@@ -184,6 +191,19 @@ Index<Dim> read_extents(hid_t group_id,
 
 namespace h5 {
 namespace detail {
+/*!
+ * \ingroup HDF5Group
+ * \brief Create a dataset named `name` in the group `group_id` with the
+ * `extents`, holding elements of the HDF5 type `type_id` that have
+ * `type_size` bytes
+ *
+ * The dataset is chunked and compressed like the datasets written by
+ * `h5::write_data`, so it can be filled piece by piece with hyperslab writes.
+ * The caller must close the returned dataset.
+ */
+hid_t create_dataset(hid_t group_id, const std::string& name, hid_t type_id,
+                     size_t type_size, const std::vector<size_t>& extents);
+
 /*!
  * \ingroup HDF5Group
  * \brief Create a dataset that can be extended/appended to
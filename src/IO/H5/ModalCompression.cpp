@@ -0,0 +1,215 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/H5/ModalCompression.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <pup.h>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "DataStructures/ModalVector.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/Numeric.hpp"
+
+namespace h5 {
+namespace {
+// Calls `f(offset, index, box_offset)` for every mode in the block of lowest
+// modes with `box_extents` on a grid with `extents`, where `offset` is the
+// offset of the mode in the data on the full grid, `index` is the
+// multi-dimensional index of the mode and `box_offset` is the offset of the
+// mode in the data on the block. Modes are traversed with the first dimension
+// varying fastest.
+template <typename F>
+void for_each_mode_in_box(const std::vector<size_t>& box_extents,
+                          const std::vector<size_t>& extents, const F& f) {
+  const size_t dim = extents.size();
+  const size_t box_size =
+      alg::accumulate(box_extents, 1_st, std::multiplies<>{});
+  std::vector<size_t> index(dim, 0);
+  for (size_t box_offset = 0; box_offset < box_size; ++box_offset) {
+    size_t offset = 0;
+    size_t stride = 1;
+    for (size_t d = 0; d < dim; ++d) {
+      offset += index[d] * stride;
+      stride *= extents[d];
+    }
+    f(offset, index, box_offset);
+    for (size_t d = 0; d < dim; ++d) {
+      if (++index[d] < box_extents[d]) {
+        break;
+      }
+      index[d] = 0;
+    }
+  }
+}
+
+template <size_t Dim>
+DataVector modal_to_nodal(
+    const ModalVector& modal_coefficients, const std::vector<size_t>& extents,
+    const std::vector<Spectral::Basis>& bases,
+    const std::vector<Spectral::Quadrature>& quadratures) {
+  std::array<Matrix, Dim> matrices{};
+  std::array<size_t, Dim> index_extents{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(matrices, d) = Spectral::modal_to_nodal_matrix(
+        Mesh<1>{extents[d], bases[d], quadratures[d]});
+    gsl::at(index_extents, d) = extents[d];
+  }
+  DataVector result(modal_coefficients.size());
+  apply_matrices(make_not_null(&result), matrices, modal_coefficients,
+                 Index<Dim>{index_extents});
+  return result;
+}
+}  // namespace
+
+ModalCompression::ModalCompression(const double absolute_tolerance_in,
+                                   const double relative_tolerance_in)
+    : absolute_tolerance(absolute_tolerance_in),
+      relative_tolerance(relative_tolerance_in) {}
+
+double ModalCompression::error_bound(const double max_abs_value) const {
+  return absolute_tolerance + relative_tolerance * max_abs_value;
+}
+
+void ModalCompression::pup(PUP::er& p) {
+  p | absolute_tolerance;
+  p | relative_tolerance;
+}
+
+bool operator==(const ModalCompression& lhs, const ModalCompression& rhs) {
+  return lhs.absolute_tolerance == rhs.absolute_tolerance and
+         lhs.relative_tolerance == rhs.relative_tolerance;
+}
+
+bool operator!=(const ModalCompression& lhs, const ModalCompression& rhs) {
+  return not(lhs == rhs);
+}
+
+bool is_modally_compressible(const std::vector<Spectral::Basis>& bases) {
+  return alg::all_of(bases, [](const Spectral::Basis basis) {
+    return basis == Spectral::Basis::Legendre or
+           basis == Spectral::Basis::Chebyshev;
+  });
+}
+
+std::pair<std::vector<size_t>, DataVector> truncate_modes(
+    const ModalVector& modal_coefficients, const std::vector<size_t>& extents,
+    const double error_bound, const double relative_roundoff) {
+  ASSERT(modal_coefficients.size() ==
+             alg::accumulate(extents, 1_st, std::multiplies<>{}),
+         "The number of modal coefficients ("
+             << modal_coefficients.size() << ") does not match the extents");
+  const size_t dim = extents.size();
+  std::vector<size_t> retained_extents = extents;
+  const double total_power = alg::accumulate(
+      modal_coefficients, 0.0,
+      [](const double power, const double coefficient) {
+        return power + std::abs(coefficient);
+      });
+  double dropped_power = 0.0;
+  while (true) {
+    // Find the slab of highest modes with the least power
+    std::vector<double> slab_power(dim, 0.0);
+    for_each_mode_in_box(
+        retained_extents, extents,
+        [&modal_coefficients, &retained_extents, &slab_power, dim](
+            const size_t offset, const std::vector<size_t>& index,
+            const size_t /*box_offset*/) {
+          for (size_t d = 0; d < dim; ++d) {
+            if (index[d] + 1 == retained_extents[d]) {
+              slab_power[d] += std::abs(modal_coefficients[offset]);
+            }
+          }
+        });
+    size_t dim_to_truncate = dim;
+    double least_power = std::numeric_limits<double>::max();
+    for (size_t d = 0; d < dim; ++d) {
+      if (retained_extents[d] > 1 and slab_power[d] < least_power) {
+        dim_to_truncate = d;
+        least_power = slab_power[d];
+      }
+    }
+    if (dim_to_truncate == dim or
+        dropped_power + least_power +
+                relative_roundoff *
+                    (total_power - dropped_power - least_power) >
+            error_bound) {
+      break;
+    }
+    dropped_power += least_power;
+    --retained_extents[dim_to_truncate];
+  }
+
+  DataVector retained_modes(
+      alg::accumulate(retained_extents, 1_st, std::multiplies<>{}));
+  for_each_mode_in_box(
+      retained_extents, extents,
+      [&modal_coefficients, &retained_modes](
+          const size_t offset, const std::vector<size_t>& /*index*/,
+          const size_t box_offset) {
+        retained_modes[box_offset] = modal_coefficients[offset];
+      });
+  return {std::move(retained_extents), std::move(retained_modes)};
+}
+
+DataVector nodal_data_from_truncated_modes(
+    const DataVector& retained_modes,
+    const std::vector<size_t>& retained_extents,
+    const std::vector<size_t>& extents,
+    const std::vector<Spectral::Basis>& bases,
+    const std::vector<Spectral::Quadrature>& quadratures) {
+  ASSERT(retained_extents.size() == extents.size() and
+             bases.size() == extents.size() and
+             quadratures.size() == extents.size(),
+         "The retained extents, extents, bases, and quadratures must all have "
+         "the dimension of the grid.");
+  ASSERT(retained_modes.size() ==
+             alg::accumulate(retained_extents, 1_st, std::multiplies<>{}),
+         "The number of retained modes (" << retained_modes.size()
+                                          << ") does not match the extents");
+  if (not is_modally_compressible(bases)) {
+    ASSERT(retained_extents == extents,
+           "Data on grids that are not modally compressible must be stored "
+           "with the full extents.");
+    return retained_modes;
+  }
+  ModalVector modal_coefficients(
+      alg::accumulate(extents, 1_st, std::multiplies<>{}), 0.0);
+  for_each_mode_in_box(
+      retained_extents, extents,
+      [&modal_coefficients, &retained_modes](
+          const size_t offset, const std::vector<size_t>& /*index*/,
+          const size_t box_offset) {
+        modal_coefficients[offset] = retained_modes[box_offset];
+      });
+  switch (extents.size()) {
+    case 1:
+      return modal_to_nodal<1>(modal_coefficients, extents, bases,
+                               quadratures);
+    case 2:
+      return modal_to_nodal<2>(modal_coefficients, extents, bases,
+                               quadratures);
+    case 3:
+      return modal_to_nodal<3>(modal_coefficients, extents, bases,
+                               quadratures);
+    default:
+      ERROR("Can only reconstruct data from modal coefficients in 1, 2, or 3 "
+            "dimensions, not " << extents.size());
+  }
+}
+}  // namespace h5
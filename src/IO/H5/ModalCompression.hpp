@@ -0,0 +1,126 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Options/Options.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+class ModalVector;
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace h5 {
+/*!
+ * \ingroup HDF5Group
+ * \brief Error bound for writing volume data as truncated modal coefficients.
+ *
+ * The modal coefficients of a tensor component on an element are truncated as
+ * long as the pointwise error this introduces is below
+ * \f$\epsilon_\mathrm{abs} + \epsilon_\mathrm{rel} \max|u|\f$, where the
+ * maximum is taken over the nodal values \f$u\f$ of the tensor component on
+ * the element. See `h5::truncate_modes` for details. When the coefficients are
+ * written in single precision, their rounding error counts towards the bound.
+ * Tolerances that are smaller than the single-precision rounding error of the
+ * data can't be met, so no modes are truncated in that case.
+ */
+struct ModalCompression {
+  struct AbsoluteTolerance {
+    using type = double;
+    static constexpr Options::String help = {
+        "Absolute bound on the pointwise error introduced by truncating modal "
+        "coefficients."};
+    static type lower_bound() { return 0.0; }
+  };
+  struct RelativeTolerance {
+    using type = double;
+    static constexpr Options::String help = {
+        "Bound on the pointwise error introduced by truncating modal "
+        "coefficients, relative to the largest magnitude of the data on the "
+        "element."};
+    static type lower_bound() { return 0.0; }
+  };
+  using options = tmpl::list<AbsoluteTolerance, RelativeTolerance>;
+  static constexpr Options::String help = {
+      "Write truncated modal coefficients instead of nodal values, keeping "
+      "the pointwise error below AbsoluteTolerance + RelativeTolerance * "
+      "max|data| on each element."};
+
+  ModalCompression() = default;
+  ModalCompression(double absolute_tolerance_in,
+                   double relative_tolerance_in);
+
+  /// The bound on the pointwise error for data with largest magnitude
+  /// `max_abs_value`
+  double error_bound(double max_abs_value) const;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+  double absolute_tolerance{0.0};
+  double relative_tolerance{0.0};
+};
+
+bool operator==(const ModalCompression& lhs, const ModalCompression& rhs);
+bool operator!=(const ModalCompression& lhs, const ModalCompression& rhs);
+
+/// \ingroup HDF5Group
+/// Whether data on a grid with the `bases` can be written as truncated modal
+/// coefficients, i.e. all bases are `Spectral::Basis::Legendre` or
+/// `Spectral::Basis::Chebyshev`. On all other grids the modal representation
+/// written to disk is the nodal data itself.
+bool is_modally_compressible(const std::vector<Spectral::Basis>& bases);
+
+/*!
+ * \ingroup HDF5Group
+ * \brief Truncate the `modal_coefficients` on a grid with `extents` to the
+ * smallest block of lowest modes that represents the data to within the
+ * `error_bound`.
+ *
+ * The highest modes are dropped one slab at a time, always in the dimension
+ * where the slab holds the least power, until dropping another slab would
+ * exceed the `error_bound`. Since the Legendre and Chebyshev basis functions
+ * are bounded by one in magnitude, the sum of the magnitudes of the dropped
+ * coefficients bounds the pointwise error of the truncated data.
+ *
+ * If the retained coefficients are rounded when they are written, e.g. to
+ * single precision, pass the `relative_roundoff` of each retained coefficient.
+ * The rounding then adds at most `relative_roundoff` times the sum of the
+ * magnitudes of the retained coefficients to the pointwise error, and this
+ * contribution is included when checking the `error_bound`. If the rounding
+ * error of the full set of coefficients already exceeds the `error_bound`, no
+ * modes are dropped.
+ *
+ * Returns the extents of the retained block of modes and the retained modal
+ * coefficients. Use `h5::nodal_data_from_truncated_modes` to reconstruct the
+ * nodal data.
+ */
+std::pair<std::vector<size_t>, DataVector> truncate_modes(
+    const ModalVector& modal_coefficients, const std::vector<size_t>& extents,
+    double error_bound, double relative_roundoff = 0.0);
+
+/*!
+ * \ingroup HDF5Group
+ * \brief Reconstruct the nodal data on a grid from the `retained_modes`
+ * computed by `h5::truncate_modes`.
+ *
+ * On grids that are not modally compressible (see
+ * `h5::is_modally_compressible`) the `retained_modes` are the nodal data and
+ * are returned unchanged.
+ */
+DataVector nodal_data_from_truncated_modes(
+    const DataVector& retained_modes,
+    const std::vector<size_t>& retained_extents,
+    const std::vector<size_t>& extents,
+    const std::vector<Spectral::Basis>& bases,
+    const std::vector<Spectral::Quadrature>& quadratures);
+}  // namespace h5
@@ -3,7 +3,9 @@
 
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <cstddef>
 #include <string>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/TensorData.hpp"
@@ -27,8 +29,16 @@ void bind_h5vol(py::module& m) {  // NOLINT
            py::arg("observation_id"))
       .def("list_tensor_components", &h5::VolumeData::list_tensor_components,
            py::arg("observation_id"))
-      .def("get_tensor_component", &h5::VolumeData::get_tensor_component,
+      .def("get_tensor_component",
+           py::overload_cast<size_t, const std::string&>(
+               &h5::VolumeData::get_tensor_component, py::const_),
            py::arg("observation_id"), py::arg("tensor_component"))
+      .def("get_tensor_component",
+           py::overload_cast<size_t, const std::string&,
+                             const std::vector<std::string>&>(
+               &h5::VolumeData::get_tensor_component, py::const_),
+           py::arg("observation_id"), py::arg("tensor_component"),
+           py::arg("grid_names"))
       .def("get_extents", &h5::VolumeData::get_extents,
            py::arg("observation_id"))
       .def("get_quadratures", &h5::VolumeData::get_quadratures,
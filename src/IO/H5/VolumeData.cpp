@@ -4,23 +4,32 @@
 #include "IO/H5/VolumeData.hpp"
 
 #include <algorithm>
+#include <array>
 #include <boost/algorithm/string.hpp>
 #include <boost/iterator/transform_iterator.hpp>
 #include <hdf5.h>
+#include <cstdint>
 #include <memory>
+#include <numeric>
+#include <optional>
 #include <ostream>
 #include <string>
+#include <utility>
+#include <variant>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/TensorData.hpp"
 #include "IO/Connectivity.hpp"
 #include "IO/H5/AccessType.hpp"
+#include "IO/H5/CheckH5.hpp"
 #include "IO/H5/Header.hpp"
 #include "IO/H5/Helpers.hpp"
+#include "IO/H5/ModalCompression.hpp"
 #include "IO/H5/SpectralIo.hpp"
 #include "IO/H5/Type.hpp"
 #include "IO/H5/Version.hpp"
+#include "IO/H5/Wrappers.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
@@ -34,24 +43,265 @@
 
 namespace h5 {
 namespace {
-// Append the element extents and connectevity to the total extents and
-// connectivity
-void append_element_extents_and_connectivity(
-    const gsl::not_null<std::vector<size_t>*> total_extents,
+// Name of the group in an observation that holds the extents of the retained
+// modes of the tensor components written as truncated modal coefficients
+const std::string modal_extents_group_name = "modal_extents";
+
+// Whether the tensor component is written as truncated modal coefficients
+bool is_modal_component(const hid_t observation_group_id,
+                        const std::string& tensor_component) {
+  return contains_dataset_or_group(observation_group_id, "",
+                                   modal_extents_group_name) and
+         contains_dataset_or_group(observation_group_id,
+                                   modal_extents_group_name, tensor_component);
+}
+
+// Read the points [offset, offset + length) of the one-dimensional dataset into
+// `data`, starting at `memory_offset`
+template <typename VectorType>
+void read_points(const gsl::not_null<VectorType*> data,
+                 const hid_t dataset_id, const hid_t dataspace_id,
+                 const size_t offset, const size_t length,
+                 const size_t memory_offset) {
+  ASSERT(memory_offset + length <= data->size(),
+         "The buffer of size " << data->size()
+                               << " is too small to hold the points ["
+                               << memory_offset << ", "
+                               << memory_offset + length << ").");
+  const std::array<hsize_t, 1> start{{offset}};
+  const std::array<hsize_t, 1> count{{length}};
+  CHECK_H5(H5Sselect_hyperslab(dataspace_id, H5S_SELECT_SET, start.data(),
+                               nullptr, count.data(), nullptr),
+           "Failed to select the points [" << offset << ", " << offset + length
+                                           << ")");
+  const hid_t memspace_id = H5Screate_simple(1, count.data(), nullptr);
+  CHECK_H5(memspace_id, "Failed to create memory space");
+  CHECK_H5(H5Dread(dataset_id, h5_type<typename VectorType::value_type>(),
+                   memspace_id, dataspace_id, h5p_default(),
+                   data->data() + memory_offset),
+           "Failed to read the points [" << offset << ", " << offset + length
+                                         << ")");
+  CHECK_H5(H5Sclose(memspace_id), "Failed to close memory space");
+}
+
+// Names of the datasets in an observation that describe the topology of the
+// grids. Observations with the same topology share these datasets.
+const std::array<std::string, 6> topology_dataset_names{
+    {"total_extents", "grid_names", "quadratures", "bases", "connectivity",
+     "pole_connectivity"}};
+
+// Hash of the topology of the grids. The hash is stored in the file, so it
+// must not depend on the platform or the run (64-bit FNV-1a).
+size_t hash_topology(const std::vector<char>& grid_names,
+                     const std::vector<size_t>& total_extents,
+                     const std::vector<int>& bases,
+                     const std::vector<int>& quadratures) {
+  uint64_t hash = 14695981039346656037ULL;
+  const auto combine = [&hash](const uint64_t value) {
+    hash ^= value;
+    hash *= 1099511628211ULL;
+  };
+  for (const char c : grid_names) {
+    combine(static_cast<unsigned char>(c));
+  }
+  for (const size_t extent : total_extents) {
+    combine(extent);
+  }
+  for (const int basis : bases) {
+    combine(static_cast<uint64_t>(basis));
+  }
+  for (const int quadrature : quadratures) {
+    combine(static_cast<uint64_t>(quadrature));
+  }
+  return static_cast<size_t>(hash);
+}
+
+// The observation group that holds the topology datasets written most recently
+// to the volume data group, if its topology is the one described by the
+// arguments
+std::optional<std::string> find_topology_record(
+    const hid_t volume_data_group_id, const size_t topology_hash,
+    const std::vector<char>& grid_names,
+    const std::vector<size_t>& total_extents, const std::vector<int>& bases,
+    const std::vector<int>& quadratures) {
+  if (not contains_attribute(volume_data_group_id, "", "topology_hash") or
+      read_value_attribute<size_t>(volume_data_group_id, "topology_hash") !=
+          topology_hash) {
+    return std::nullopt;
+  }
+  const std::string record_path =
+      "ObservationId" + std::to_string(read_value_attribute<size_t>(
+                            volume_data_group_id, "topology_observation_id"));
+  if (not contains_dataset_or_group(volume_data_group_id, "", record_path)) {
+    return std::nullopt;
+  }
+  // Compare the topology itself to guard against hash collisions
+  detail::OpenGroup record_group(volume_data_group_id, record_path,
+                                 AccessType::ReadOnly);
+  if (read_data<1, std::vector<size_t>>(record_group.id(), "total_extents") !=
+          total_extents or
+      read_data<1, std::vector<char>>(record_group.id(), "grid_names") !=
+          grid_names or
+      read_data<1, std::vector<int>>(record_group.id(), "bases") != bases or
+      read_data<1, std::vector<int>>(record_group.id(), "quadratures") !=
+          quadratures) {
+    return std::nullopt;
+  }
+  return record_path;
+}
+
+// Write the value to the attribute, replacing the attribute if it exists
+template <typename T>
+void overwrite_attribute(const hid_t location_id, const std::string& name,
+                         const T& value) {
+  if (contains_attribute(location_id, "", name)) {
+    CHECK_H5(H5Adelete(location_id, name.c_str()),
+             "Failed to delete attribute '" << name << "'");
+  }
+  write_to_attribute(location_id, name, value);
+}
+
+// Write the Quadrature and Basis dictionaries, which are needed to decode the
+// quadratures and bases of the grids
+void write_dictionaries(const detail::OpenGroup& observation_group) {
+  const auto io_quadratures = h5_detail::allowed_quadratures();
+  std::vector<std::string> quadrature_dict(io_quadratures.size());
+  alg::transform(io_quadratures, quadrature_dict.begin(),
+                 get_output<Spectral::Quadrature>);
+  h5_detail::write_dictionary("Quadrature dictionary", quadrature_dict,
+                              observation_group);
+  const auto io_bases = h5_detail::allowed_bases();
+  std::vector<std::string> basis_dict(io_bases.size());
+  alg::transform(io_bases, basis_dict.begin(), get_output<Spectral::Basis>);
+  h5_detail::write_dictionary("Basis dictionary", basis_dict,
+                              observation_group);
+}
+
+// Link the topology datasets of the last observation with the same topology
+// into the observation group at `path`. Returns false if the topology differs
+// from that of the last observation, in which case nothing is linked.
+bool link_topology(const hid_t volume_data_group_id,
+                   const hid_t observation_group_id, const std::string& path,
+                   const size_t topology_hash,
+                   const std::vector<char>& grid_names,
+                   const std::vector<size_t>& total_extents,
+                   const std::vector<int>& bases,
+                   const std::vector<int>& quadratures) {
+  const std::optional<std::string> topology_record =
+      find_topology_record(volume_data_group_id, topology_hash, grid_names,
+                           total_extents, bases, quadratures);
+  if (not topology_record.has_value()) {
+    return false;
+  }
+  const detail::OpenGroup record_group(volume_data_group_id, *topology_record,
+                                       AccessType::ReadOnly);
+  for (const std::string& dataset_name : topology_dataset_names) {
+    if (contains_dataset_or_group(record_group.id(), "", dataset_name)) {
+      CHECK_H5(H5Lcreate_hard(record_group.id(), dataset_name.c_str(),
+                              observation_group_id, dataset_name.c_str(),
+                              h5p_default(), h5p_default()),
+               "Failed to link dataset '" << dataset_name << "' from '"
+                                          << *topology_record << "' to '"
+                                          << path << "'");
+    }
+  }
+  h5::write_to_attribute(observation_group_id, "topology_observation_id",
+                         read_value_attribute<size_t>(
+                             volume_data_group_id, "topology_observation_id"));
+  return true;
+}
+
+// Record the observation as the one holding the topology datasets
+void record_topology(const hid_t volume_data_group_id,
+                     const hid_t observation_group_id,
+                     const size_t observation_id, const size_t topology_hash) {
+  h5::write_to_attribute(observation_group_id, "topology_observation_id",
+                         observation_id);
+  overwrite_attribute(volume_data_group_id, "topology_hash", topology_hash);
+  overwrite_attribute(volume_data_group_id, "topology_observation_id",
+                      observation_id);
+}
+
+// Write the points [offset, offset + data.size()) of the one-dimensional
+// dataset from `data`
+template <typename T>
+void write_points(const hid_t dataset_id, const hid_t dataspace_id,
+                  const std::vector<T>& data, const size_t offset) {
+  const std::array<hsize_t, 1> start{{offset}};
+  const std::array<hsize_t, 1> count{{data.size()}};
+  CHECK_H5(H5Sselect_hyperslab(dataspace_id, H5S_SELECT_SET, start.data(),
+                               nullptr, count.data(), nullptr),
+           "Failed to select the points [" << offset << ", "
+                                           << offset + data.size() << ")");
+  const hid_t memspace_id = H5Screate_simple(1, count.data(), nullptr);
+  CHECK_H5(memspace_id, "Failed to create memory space");
+  CHECK_H5(H5Dwrite(dataset_id, h5_type<T>(), memspace_id, dataspace_id,
+                    h5p_default(), data.data()),
+           "Failed to write the points [" << offset << ", "
+                                          << offset + data.size() << ")");
+  CHECK_H5(H5Sclose(memspace_id), "Failed to close memory space");
+}
+
+// The number of points in the dataset
+size_t number_of_points(const hid_t group_id, const std::string& dataset_name) {
+  const hid_t dataset_id = h5::open_dataset(group_id, dataset_name);
+  const hid_t dataspace_id = h5::open_dataspace(dataset_id);
+  const hssize_t size = H5Sget_simple_extent_npoints(dataspace_id);
+  CHECK_H5(size, "Failed to get the size of dataset '" << dataset_name << "'");
+  h5::close_dataspace(dataspace_id);
+  h5::close_dataset(dataset_id);
+  return static_cast<size_t>(size);
+}
+
+// Concatenate the one-dimensional datasets named `dataset_name` in the
+// `source_group_ids` into a new dataset with the same name in the destination
+// group, copying at most `max_buffer_size` points at a time. Before the points
+// of the source `i` are written, `transform(i, buffer)` can modify them.
+template <typename T, typename Transform>
+void concatenate_datasets(const hid_t destination_group_id,
+                          const std::vector<hid_t>& source_group_ids,
+                          const std::string& dataset_name,
+                          const size_t max_buffer_size,
+                          const Transform& transform) {
+  std::vector<size_t> source_sizes(source_group_ids.size());
+  for (size_t i = 0; i < source_group_ids.size(); ++i) {
+    source_sizes[i] = number_of_points(source_group_ids[i], dataset_name);
+  }
+  const hid_t dataset_id = detail::create_dataset(
+      destination_group_id, dataset_name, h5_type<T>(), sizeof(T),
+      {alg::accumulate(source_sizes, 0_st)});
+  const hid_t dataspace_id = h5::open_dataspace(dataset_id);
+  std::vector<T> buffer{};
+  size_t destination_offset = 0;
+  for (size_t i = 0; i < source_group_ids.size(); ++i) {
+    const hid_t source_dataset_id =
+        h5::open_dataset(source_group_ids[i], dataset_name);
+    const hid_t source_dataspace_id = h5::open_dataspace(source_dataset_id);
+    for (size_t offset = 0; offset < source_sizes[i];
+         offset += max_buffer_size) {
+      buffer.resize(std::min(max_buffer_size, source_sizes[i] - offset));
+      read_points(make_not_null(&buffer), source_dataset_id,
+                  source_dataspace_id, offset, buffer.size(), 0);
+      transform(i, make_not_null(&buffer));
+      write_points(dataset_id, dataspace_id, buffer, destination_offset);
+      destination_offset += buffer.size();
+    }
+    h5::close_dataspace(source_dataspace_id);
+    h5::close_dataset(source_dataset_id);
+  }
+  h5::close_dataspace(dataspace_id);
+  h5::close_dataset(dataset_id);
+}
+
+// Append the element connectevity to the total connectivity
+void append_element_connectivity(
     const gsl::not_null<std::vector<int>*> total_connectivity,
     const gsl::not_null<std::vector<int>*> pole_connectivity,
     const gsl::not_null<int*> total_points_so_far, const size_t dim,
     const ElementVolumeData& element) {
-  // Process the element extents
   const auto& extents = element.extents;
   ASSERT(alg::none_of(extents, [](const size_t extent) { return extent == 1; }),
          "We cannot generate connectivity for any single grid point elements.");
-  if (extents.size() != dim) {
-    ERROR("Trying to write data of dimensionality"
-          << extents.size() << "but the VolumeData file has dimensionality"
-          << dim << ".");
-  }
-  total_extents->insert(total_extents->end(), extents.begin(), extents.end());
   // Find the number of points in the local connectivity
   const int element_num_points =
       alg::accumulate(extents, 1, std::multiplies<>{});
@@ -232,16 +482,32 @@ void VolumeData::write_volume_data(
   }
   const auto dim =
       h5::read_value_attribute<size_t>(volume_data_group_.id(), "dimension");
-  // Extract Tensor Data one component at a time
+  // Collect the topology of the grids
   std::vector<size_t> total_extents;
   std::string grid_names;
-  std::vector<int> total_connectivity;
-  std::vector<int> pole_connectivity{};
   std::vector<int> quadratures;
   std::vector<int> bases;
-  // Keep a running count of the number of points so far to use as a global
-  // index for the connectivity
-  int total_points_so_far = 0;
+  for (const auto& element : elements) {
+    if (element.extents.size() != dim) {
+      ERROR("Trying to write data of dimensionality"
+            << element.extents.size()
+            << "but the VolumeData file has dimensionality" << dim << ".");
+    }
+    total_extents.insert(total_extents.end(), element.extents.begin(),
+                         element.extents.end());
+    grid_names += element.element_name + h5::VolumeData::separator();
+    // append element basis
+    alg::transform(element.basis, std::back_inserter(bases),
+                   [](const Spectral::Basis t) { return static_cast<int>(t); });
+    // append element quadraature
+    alg::transform(
+        element.quadrature, std::back_inserter(quadratures),
+        [](const Spectral::Quadrature t) { return static_cast<int>(t); });
+  }
+  grid_names.pop_back();
+  const std::vector<char> grid_names_as_chars(grid_names.begin(),
+                                              grid_names.end());
+  // Extract Tensor Data one component at a time
   // Loop over tensor components
   for (size_t i = 0; i < component_names.size(); i++) {
     std::string component_name = component_names[i];
@@ -254,30 +520,30 @@ void VolumeData::write_volume_data(
             << "ObservationId" << std::to_string(observation_id) << "'");
     }
 
+    // Components written as truncated modal coefficients also store the
+    // extents of the retained modes of every element
+    const bool is_modal =
+        not elements.front().tensor_components[i].modal_extents.empty();
+    std::vector<size_t> total_modal_extents{};
+
     const auto fill_and_write_contiguous_tensor_data =
-        [&bases, &component_name, &dim, &elements, &grid_names, i,
-         &observation_group, &quadratures, &total_connectivity,
-         &pole_connectivity, &total_extents,
-         &total_points_so_far](const auto contiguous_tensor_data_ptr) {
+        [&component_name, &dim, &elements, i, is_modal, &observation_group,
+         &total_modal_extents](const auto contiguous_tensor_data_ptr) {
           for (const auto& element : elements) {
-            if (UNLIKELY(i == 0)) {
-              // True if first tensor component being accessed
-              grid_names += element.element_name + h5::VolumeData::separator();
-              // append element basis
-              alg::transform(
-                  element.basis, std::back_inserter(bases),
-                  [](const Spectral::Basis t) { return static_cast<int>(t); });
-              // append element quadraature
-              alg::transform(element.quadrature,
-                             std::back_inserter(quadratures),
-                             [](const Spectral::Quadrature t) {
-                               return static_cast<int>(t);
-                             });
-
-              append_element_extents_and_connectivity(
-                  &total_extents, &total_connectivity, &pole_connectivity,
-                  &total_points_so_far, dim, element);
+            const auto& modal_extents =
+                element.tensor_components[i].modal_extents;
+            if (is_modal != (modal_extents.size() == dim)) {
+              using ::operator<<;  // STL streams
+              ERROR("The tensor component '"
+                    << component_name
+                    << "' must be written either as modal coefficients on all "
+                       "elements or as nodal values on all elements, but "
+                       "found modal extents "
+                    << modal_extents << " on element " << element.element_name);
             }
+            total_modal_extents.insert(total_modal_extents.end(),
+                                       modal_extents.begin(),
+                                       modal_extents.end());
             using type_from_variant = tmpl::conditional_t<
                 std::is_same_v<
                     std::decay_t<decltype(*contiguous_tensor_data_ptr)>,
@@ -292,6 +558,13 @@ void VolumeData::write_volume_data(
           }  // for each element
           h5::write_data(observation_group.id(), *contiguous_tensor_data_ptr,
                          {contiguous_tensor_data_ptr->size()}, component_name);
+          if (is_modal) {
+            detail::OpenGroup modal_extents_group(observation_group.id(),
+                                                  modal_extents_group_name,
+                                                  AccessType::ReadWrite);
+            h5::write_data(modal_extents_group.id(), total_modal_extents,
+                           {total_modal_extents.size()}, component_name);
+          }
         };
 
     if (elements[0].tensor_components[i].data.index() == 0) {
@@ -308,7 +581,30 @@ void VolumeData::write_volume_data(
             << ") in std::variant of tensor component.");
     }
   }  // for each component
-  grid_names.pop_back();
+
+  write_dictionaries(observation_group);
+
+  // The grids usually don't change between observations, so instead of
+  // writing the topology datasets again we link them to the datasets of the
+  // last observation that has the same topology. Readers see the same
+  // datasets in every observation group.
+  const size_t topology_hash = hash_topology(grid_names_as_chars, total_extents,
+                                             bases, quadratures);
+  if (link_topology(volume_data_group_.id(), observation_group.id(), path,
+                    topology_hash, grid_names_as_chars, total_extents, bases,
+                    quadratures)) {
+    return;
+  }
+
+  std::vector<int> total_connectivity;
+  std::vector<int> pole_connectivity{};
+  // Keep a running count of the number of points so far to use as a global
+  // index for the connectivity
+  int total_points_so_far = 0;
+  for (const auto& element : elements) {
+    append_element_connectivity(&total_connectivity, &pole_connectivity,
+                                &total_points_so_far, dim, element);
+  }
 
   // Write the grid extents contiguously, the first `dim` belong to the
   // First grid, the second `dim` belong to the second grid, and so on,
@@ -317,24 +613,11 @@ void VolumeData::write_volume_data(
                  "total_extents");
   // Write the names of the grids as vector of chars with individual names
   // separated by `separator()`
-  std::vector<char> grid_names_as_chars(grid_names.begin(), grid_names.end());
   h5::write_data(observation_group.id(), grid_names_as_chars,
                  {grid_names_as_chars.size()}, "grid_names");
-  // Write the coded quadrature, along with the dictionary
-  const auto io_quadratures = h5_detail::allowed_quadratures();
-  std::vector<std::string> quadrature_dict(io_quadratures.size());
-  alg::transform(io_quadratures, quadrature_dict.begin(),
-                 get_output<Spectral::Quadrature>);
-  h5_detail::write_dictionary("Quadrature dictionary", quadrature_dict,
-                              observation_group);
+  // Write the coded quadrature and basis
   h5::write_data(observation_group.id(), quadratures, {quadratures.size()},
                  "quadratures");
-  // Write the coded basis, along with the dictionary
-  const auto io_bases = h5_detail::allowed_bases();
-  std::vector<std::string> basis_dict(io_bases.size());
-  alg::transform(io_bases, basis_dict.begin(), get_output<Spectral::Basis>);
-  h5_detail::write_dictionary("Basis dictionary", basis_dict,
-                              observation_group);
   h5::write_data(observation_group.id(), bases, {bases.size()}, "bases");
   // Write the Connectivity
   h5::write_data(observation_group.id(), total_connectivity,
@@ -348,6 +631,217 @@ void VolumeData::write_volume_data(
     h5::write_data(observation_group.id(), pole_connectivity,
                    {pole_connectivity.size()}, "pole_connectivity");
   }
+
+  record_topology(volume_data_group_.id(), observation_group.id(),
+                  observation_id, topology_hash);
+}
+
+void VolumeData::write_concatenated_volume_data(
+    const size_t observation_id,
+    const std::vector<const VolumeData*>& volume_files,
+    const size_t max_buffer_size) {
+  ASSERT(not volume_files.empty(),
+         "Need at least one volume file to concatenate.");
+  ASSERT(max_buffer_size > 0, "Must copy at least one point at a time.");
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  const VolumeData& first_file = *volume_files.front();
+  const double observation_value =
+      first_file.get_observation_value(observation_id);
+  const size_t dim = first_file.get_dimension();
+  std::vector<std::string> component_names =
+      first_file.list_tensor_components(observation_id);
+  alg::sort(component_names);
+
+  std::vector<detail::OpenGroup> source_groups{};
+  std::vector<hid_t> source_group_ids{};
+  source_groups.reserve(volume_files.size());
+  source_group_ids.reserve(volume_files.size());
+  for (const VolumeData* volume_file : volume_files) {
+    ASSERT(volume_file != nullptr, "The volume files must not be nullptr.");
+    if (volume_file->get_observation_value(observation_id) !=
+        observation_value) {
+      ERROR_NO_TRACE("ObservationId "
+                     << observation_id << " has observation value "
+                     << volume_file->get_observation_value(observation_id)
+                     << " in '" << volume_file->subfile_path()
+                     << "' but observation value " << observation_value
+                     << " in '" << first_file.subfile_path() << "'.");
+    }
+    if (volume_file->get_dimension() != dim) {
+      ERROR_NO_TRACE("Cannot concatenate the volume data in '"
+                     << volume_file->subfile_path() << "' of dimension "
+                     << volume_file->get_dimension() << " with data in '"
+                     << first_file.subfile_path() << "' of dimension " << dim
+                     << ".");
+    }
+    auto file_component_names =
+        volume_file->list_tensor_components(observation_id);
+    alg::sort(file_component_names);
+    if (file_component_names != component_names) {
+      using ::operator<<;
+      ERROR_NO_TRACE("The volume data in '"
+                     << volume_file->subfile_path()
+                     << "' holds the tensor components "
+                     << file_component_names << " at ObservationId "
+                     << observation_id << " but the volume data in '"
+                     << first_file.subfile_path() << "' holds "
+                     << component_names << ".");
+    }
+    source_groups.emplace_back(volume_file->volume_data_group_.id(), path,
+                               AccessType::ReadOnly);
+    source_group_ids.push_back(source_groups.back().id());
+  }
+
+  detail::OpenGroup observation_group(volume_data_group_.id(), path,
+                                      AccessType::ReadWrite);
+  if (contains_attribute(observation_group.id(), "", "observation_value")) {
+    ERROR_NO_TRACE("Trying to write ObservationId "
+                   << std::to_string(observation_id)
+                   << " which already exists in file at " << path
+                   << ". Did you forget to clean up after an earlier run?");
+  }
+  h5::write_to_attribute(observation_group.id(), "observation_value",
+                         observation_value);
+  if (not contains_attribute(volume_data_group_.id(), "", "dimension")) {
+    h5::write_to_attribute(volume_data_group_.id(), "dimension", dim);
+  }
+  const auto no_transform = [](const size_t /*source_index*/,
+                               const auto /*buffer*/) {};
+
+  // Copy the tensor components without decoding them
+  for (const std::string& component_name : component_names) {
+    const hid_t dataset_id =
+        h5::open_dataset(source_group_ids.front(), component_name);
+    const hid_t datatype_id = H5Dget_type(dataset_id);
+    const bool use_float = h5::types_equal(datatype_id, h5::h5_type<float>());
+    CHECK_H5(H5Tclose(datatype_id),
+             "Failed to close datatype of tensor component " << component_name);
+    h5::close_dataset(dataset_id);
+    if (use_float) {
+      concatenate_datasets<float>(observation_group.id(), source_group_ids,
+                                  component_name, max_buffer_size,
+                                  no_transform);
+    } else {
+      concatenate_datasets<double>(observation_group.id(), source_group_ids,
+                                   component_name, max_buffer_size,
+                                   no_transform);
+    }
+    const bool is_modal =
+        is_modal_component(source_group_ids.front(), component_name);
+    for (const hid_t source_group_id : source_group_ids) {
+      if (is_modal_component(source_group_id, component_name) != is_modal) {
+        ERROR_NO_TRACE("The tensor component '"
+                       << component_name
+                       << "' must be written either as modal coefficients in "
+                          "all files or as nodal values in all files.");
+      }
+    }
+    if (is_modal) {
+      std::vector<detail::OpenGroup> source_modal_extents_groups{};
+      std::vector<hid_t> source_modal_extents_group_ids{};
+      source_modal_extents_groups.reserve(source_group_ids.size());
+      for (const hid_t source_group_id : source_group_ids) {
+        source_modal_extents_groups.emplace_back(
+            source_group_id, modal_extents_group_name, AccessType::ReadOnly);
+        source_modal_extents_group_ids.push_back(
+            source_modal_extents_groups.back().id());
+      }
+      const detail::OpenGroup modal_extents_group(observation_group.id(),
+                                                  modal_extents_group_name,
+                                                  AccessType::ReadWrite);
+      concatenate_datasets<size_t>(
+          modal_extents_group.id(), source_modal_extents_group_ids,
+          component_name, max_buffer_size, no_transform);
+    }
+  }
+
+  write_dictionaries(observation_group);
+
+  // The topology of the grids is small compared to the connectivity and the
+  // data, so it is concatenated in memory
+  std::vector<size_t> total_extents{};
+  std::vector<char> grid_names{};
+  std::vector<int> bases{};
+  std::vector<int> quadratures{};
+  // The offset of the points of each file in the concatenated data
+  std::vector<int> point_offsets{};
+  int total_number_of_points = 0;
+  for (const hid_t source_group_id : source_group_ids) {
+    const auto source_extents =
+        read_data<1, std::vector<size_t>>(source_group_id, "total_extents");
+    point_offsets.push_back(total_number_of_points);
+    for (size_t i = 0; i < source_extents.size(); i += dim) {
+      total_number_of_points += static_cast<int>(std::accumulate(
+          std::next(source_extents.begin(), static_cast<std::ptrdiff_t>(i)),
+          std::next(source_extents.begin(),
+                    static_cast<std::ptrdiff_t>(i + dim)),
+          1_st, std::multiplies<>{}));
+    }
+    total_extents.insert(total_extents.end(), source_extents.begin(),
+                         source_extents.end());
+    const auto source_grid_names =
+        read_data<1, std::vector<char>>(source_group_id, "grid_names");
+    if (not grid_names.empty()) {
+      grid_names.push_back(separator());
+    }
+    grid_names.insert(grid_names.end(), source_grid_names.begin(),
+                      source_grid_names.end());
+    const auto source_bases =
+        read_data<1, std::vector<int>>(source_group_id, "bases");
+    bases.insert(bases.end(), source_bases.begin(), source_bases.end());
+    const auto source_quadratures =
+        read_data<1, std::vector<int>>(source_group_id, "quadratures");
+    quadratures.insert(quadratures.end(), source_quadratures.begin(),
+                       source_quadratures.end());
+  }
+
+  const size_t topology_hash =
+      hash_topology(grid_names, total_extents, bases, quadratures);
+  if (link_topology(volume_data_group_.id(), observation_group.id(), path,
+                    topology_hash, grid_names, total_extents, bases,
+                    quadratures)) {
+    return;
+  }
+  h5::write_data(observation_group.id(), total_extents, {total_extents.size()},
+                 "total_extents");
+  h5::write_data(observation_group.id(), grid_names, {grid_names.size()},
+                 "grid_names");
+  h5::write_data(observation_group.id(), quadratures, {quadratures.size()},
+                 "quadratures");
+  h5::write_data(observation_group.id(), bases, {bases.size()}, "bases");
+  // Shift the connectivity of each file to the points of its grids in the
+  // concatenated data
+  concatenate_datasets<int>(
+      observation_group.id(), source_group_ids, "connectivity",
+      max_buffer_size,
+      [&point_offsets](const size_t source_index,
+                       const gsl::not_null<std::vector<int>*> buffer) {
+        for (int& point : *buffer) {
+          point += point_offsets[source_index];
+        }
+      });
+  std::vector<hid_t> pole_source_group_ids{};
+  std::vector<int> pole_point_offsets{};
+  for (size_t i = 0; i < source_group_ids.size(); ++i) {
+    if (contains_dataset_or_group(source_group_ids[i], "",
+                                  "pole_connectivity")) {
+      pole_source_group_ids.push_back(source_group_ids[i]);
+      pole_point_offsets.push_back(point_offsets[i]);
+    }
+  }
+  if (not pole_source_group_ids.empty()) {
+    concatenate_datasets<int>(
+        observation_group.id(), pole_source_group_ids, "pole_connectivity",
+        max_buffer_size,
+        [&pole_point_offsets](const size_t source_index,
+                              const gsl::not_null<std::vector<int>*> buffer) {
+          for (int& point : *buffer) {
+            point += pole_point_offsets[source_index];
+          }
+        });
+  }
+  record_topology(volume_data_group_.id(), observation_group.id(),
+                  observation_id, topology_hash);
 }
 
 std::vector<size_t> VolumeData::list_observation_ids() const {
@@ -372,32 +866,36 @@ double VolumeData::get_observation_value(const size_t observation_id) const {
                                           "observation_value");
 }
 
+size_t VolumeData::get_topology_observation_id(
+    const size_t observation_id) const {
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  detail::OpenGroup observation_group(volume_data_group_.id(), path,
+                                      AccessType::ReadOnly);
+  // Files written before the topology was shared between observations hold
+  // the topology datasets in every observation
+  if (not contains_attribute(observation_group.id(), "",
+                             "topology_observation_id")) {
+    return observation_id;
+  }
+  return h5::read_value_attribute<size_t>(observation_group.id(),
+                                          "topology_observation_id");
+}
+
 std::vector<std::string> VolumeData::list_tensor_components(
     const size_t observation_id) const {
   auto tensor_components =
       get_group_names(volume_data_group_.id(),
                       "ObservationId" + std::to_string(observation_id));
-  auto remove_data_name = [&tensor_components](const std::string& data_name) {
-    // NOLINTNEXTLINE(bugprone-unused-return-value)
-    alg::remove(tensor_components, data_name);
-  };
-
-  const auto search_result = alg::find(tensor_components, "pole_connectivity");
-  const long number_of_components_to_remove =
-      search_result != tensor_components.end() ? 6 : 5;
-
-  remove_data_name("connectivity");
-  remove_data_name("pole_connectivity");
-  remove_data_name("total_extents");
-  remove_data_name("grid_names");
-  remove_data_name("quadratures");
-  remove_data_name("bases");
-  // std::remove moves the element to the end of the vector, so we still need to
-  // actually erase it from the vector
-  tensor_components.erase(
-      tensor_components.end() - number_of_components_to_remove,
-      tensor_components.end());
-
+  // std::remove moves the elements to the end of the vector, so we still need
+  // to actually erase them from the vector
+  for (const std::string& data_name :
+       {std::string{"connectivity"}, std::string{"pole_connectivity"},
+        std::string{"total_extents"}, std::string{"grid_names"},
+        std::string{"quadratures"}, std::string{"bases"},
+        modal_extents_group_name}) {
+    tensor_components.erase(alg::remove(tensor_components, data_name),
+                            tensor_components.end());
+  }
   return tensor_components;
 }
 
@@ -420,6 +918,10 @@ TensorComponent VolumeData::get_tensor_component(
   const std::string path = "ObservationId" + std::to_string(observation_id);
   detail::OpenGroup observation_group(volume_data_group_.id(), path,
                                       AccessType::ReadOnly);
+  if (is_modal_component(observation_group.id(), tensor_component)) {
+    return get_tensor_component(observation_id, tensor_component,
+                                get_grid_names(observation_id));
+  }
 
   const hid_t dataset_id =
       h5::open_dataset(observation_group.id(), tensor_component);
@@ -427,8 +929,10 @@ TensorComponent VolumeData::get_tensor_component(
   const auto rank =
       static_cast<size_t>(H5Sget_simple_extent_ndims(dataspace_id));
   h5::close_dataspace(dataspace_id);
-  const bool use_float =
-      h5::types_equal(H5Dget_type(dataset_id), h5::h5_type<float>());
+  const hid_t datatype_id = H5Dget_type(dataset_id);
+  const bool use_float = h5::types_equal(datatype_id, h5::h5_type<float>());
+  CHECK_H5(H5Tclose(datatype_id),
+           "Failed to close datatype of tensor component " << tensor_component);
   h5::close_dataset(dataset_id);
 
   const auto get_data = [&observation_group, &rank,
@@ -475,6 +979,131 @@ std::vector<std::vector<size_t>> VolumeData::get_extents(
   return individual_extents;
 }
 
+TensorComponent VolumeData::get_tensor_component(
+    const size_t observation_id, const std::string& tensor_component,
+    const std::vector<std::string>& grid_names) const {
+  const auto all_grid_names = get_grid_names(observation_id);
+  const auto all_extents = get_extents(observation_id);
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  detail::OpenGroup observation_group(volume_data_group_.id(), path,
+                                      AccessType::ReadOnly);
+
+  // The data of components written as truncated modal coefficients are laid
+  // out by the extents of the retained modes rather than the grid extents
+  const bool is_modal =
+      is_modal_component(observation_group.id(), tensor_component);
+  std::vector<std::vector<size_t>> all_stored_extents{};
+  if (is_modal) {
+    const detail::OpenGroup modal_extents_group(observation_group.id(),
+                                                modal_extents_group_name,
+                                                AccessType::ReadOnly);
+    const auto total_modal_extents = h5::read_data<1, std::vector<size_t>>(
+        modal_extents_group.id(), tensor_component);
+    const size_t dim = get_dimension();
+    for (size_t i = 0; i < total_modal_extents.size(); i += dim) {
+      all_stored_extents.emplace_back(
+          std::next(total_modal_extents.begin(), static_cast<long>(i)),
+          std::next(total_modal_extents.begin(), static_cast<long>(i + dim)));
+    }
+  }
+  const auto& stored_extents = is_modal ? all_stored_extents : all_extents;
+
+  std::vector<std::pair<size_t, size_t>> offsets_and_lengths{};
+  offsets_and_lengths.reserve(grid_names.size());
+  size_t total_length = 0;
+  for (const auto& grid_name : grid_names) {
+    offsets_and_lengths.push_back(
+        offset_and_length_for_grid(grid_name, all_grid_names, stored_extents));
+    total_length += offsets_and_lengths.back().second;
+  }
+
+  const hid_t dataset_id =
+      h5::open_dataset(observation_group.id(), tensor_component);
+  const hid_t dataspace_id = h5::open_dataspace(dataset_id);
+  const int rank = H5Sget_simple_extent_ndims(dataspace_id);
+  if (rank != 1) {
+    h5::close_dataspace(dataspace_id);
+    h5::close_dataset(dataset_id);
+    ERROR("Can only read the data of individual grids from one-dimensional "
+          "datasets, but the dataset '"
+          << tensor_component << "' has rank " << rank);
+  }
+  const hid_t datatype_id = H5Dget_type(dataset_id);
+  const bool use_float = h5::types_equal(datatype_id, h5::h5_type<float>());
+  CHECK_H5(H5Tclose(datatype_id),
+           "Failed to close datatype of tensor component " << tensor_component);
+
+  const auto read_grids = [&dataset_id, &dataspace_id,
+                           &offsets_and_lengths](auto data) {
+    size_t memory_offset = 0;
+    for (const auto& [offset, length] : offsets_and_lengths) {
+      read_points(make_not_null(&data), dataset_id, dataspace_id, offset,
+                  length, memory_offset);
+      memory_offset += length;
+    }
+    return data;
+  };
+  TensorComponent result =
+      use_float ? TensorComponent{tensor_component,
+                                  read_grids(std::vector<float>(total_length))}
+                : TensorComponent{tensor_component,
+                                  read_grids(DataVector(total_length))};
+  h5::close_dataspace(dataspace_id);
+  h5::close_dataset(dataset_id);
+  if (not is_modal) {
+    return result;
+  }
+
+  // Reconstruct the nodal data of every grid from its modal coefficients
+  const auto all_bases = get_bases(observation_id);
+  const auto all_quadratures = get_quadratures(observation_id);
+  const auto grid_index = [&all_grid_names](const std::string& grid_name) {
+    return static_cast<size_t>(std::distance(
+        all_grid_names.begin(), alg::find(all_grid_names, grid_name)));
+  };
+  size_t total_nodal_length = 0;
+  for (const auto& grid_name : grid_names) {
+    total_nodal_length += alg::accumulate(all_extents[grid_index(grid_name)],
+                                          1_st, std::multiplies<>{});
+  }
+  std::visit(
+      [&all_bases, &all_extents, &all_quadratures, &grid_index, &grid_names,
+       &stored_extents, total_nodal_length](auto& modal_data) {
+        std::decay_t<decltype(modal_data)> nodal_data(total_nodal_length);
+        size_t modal_offset = 0;
+        size_t nodal_offset = 0;
+        for (const auto& grid_name : grid_names) {
+          const size_t index = grid_index(grid_name);
+          const size_t modal_length = alg::accumulate(
+              stored_extents[index], 1_st, std::multiplies<>{});
+          DataVector retained_modes(modal_length);
+          std::copy(std::next(modal_data.begin(),
+                              static_cast<std::ptrdiff_t>(modal_offset)),
+                    std::next(modal_data.begin(),
+                              static_cast<std::ptrdiff_t>(modal_offset +
+                                                          modal_length)),
+                    retained_modes.begin());
+          std::vector<Spectral::Basis> bases(all_bases[index].size());
+          alg::transform(all_bases[index], bases.begin(), Spectral::to_basis);
+          std::vector<Spectral::Quadrature> quadratures(
+              all_quadratures[index].size());
+          alg::transform(all_quadratures[index], quadratures.begin(),
+                         Spectral::to_quadrature);
+          const DataVector grid_nodal_data = nodal_data_from_truncated_modes(
+              retained_modes, stored_extents[index], all_extents[index], bases,
+              quadratures);
+          std::copy(grid_nodal_data.begin(), grid_nodal_data.end(),
+                    std::next(nodal_data.begin(),
+                              static_cast<std::ptrdiff_t>(nodal_offset)));
+          modal_offset += modal_length;
+          nodal_offset += grid_nodal_data.size();
+        }
+        modal_data = std::move(nodal_data);
+      },
+      result.data);
+  return result;
+}
+
 std::pair<size_t, size_t> offset_and_length_for_grid(
     const std::string& grid_name,
     const std::vector<std::string>& all_grid_names,
@@ -533,16 +1162,27 @@ auto VolumeData::get_data_by_element(
     return std::get<1>(lhs) < std::get<1>(rhs);
   });
 
-  // Retrieve element data and insert into result
+  // Retrieve element data and insert into result. The topology of the grids
+  // is only read again when it changes between observations.
+  std::optional<size_t> topology_observation_id{};
+  std::vector<std::string> grid_names{};
+  std::vector<std::vector<size_t>> extents{};
+  std::vector<std::vector<std::string>> bases{};
+  std::vector<std::vector<std::string>> quadratures{};
   for (auto& single_time_data : result) {
     const auto known_components =
         list_tensor_components(std::get<0>(single_time_data));
 
     std::vector<ElementVolumeData> element_volume_data{};
-    const auto grid_names = get_grid_names(std::get<0>(single_time_data));
-    const auto extents = get_extents(std::get<0>(single_time_data));
-    const auto bases = get_bases(std::get<0>(single_time_data));
-    const auto quadratures = get_quadratures(std::get<0>(single_time_data));
+    const size_t current_topology_observation_id =
+        get_topology_observation_id(std::get<0>(single_time_data));
+    if (topology_observation_id != current_topology_observation_id) {
+      grid_names = get_grid_names(std::get<0>(single_time_data));
+      extents = get_extents(std::get<0>(single_time_data));
+      bases = get_bases(std::get<0>(single_time_data));
+      quadratures = get_quadratures(std::get<0>(single_time_data));
+      topology_observation_id = current_topology_observation_id;
+    }
     element_volume_data.reserve(grid_names.size());
 
     const auto& component_names =
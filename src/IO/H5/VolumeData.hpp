@@ -60,6 +60,24 @@ namespace h5 {
  * `h5::offset_and_length_for_grid` function to compute the offset into the
  * contiguous dataset that corresponds to a particular grid.
  *
+ * Tensor components can also be written as truncated modal coefficients (see
+ * `h5::truncate_modes`) by setting the `TensorComponent::modal_extents`. Then
+ * the dataset of the tensor component holds the retained modal coefficients
+ * of all grids contiguously, and the extents of the retained modes of all
+ * grids are written to a dataset with the name of the tensor component in the
+ * `modal_extents` group of the observation. The `get_tensor_component()` and
+ * `get_data_by_element()` methods reconstruct the nodal data, so readers don't
+ * need to know how the data was written.
+ *
+ * The grids usually don't change between observations, so the datasets that
+ * describe them (`grid_names`, `total_extents`, `bases`, `quadratures`,
+ * `connectivity`, and `pole_connectivity`) are only written when they differ
+ * from the grids of the last observation that was written. Otherwise the
+ * observation group holds HDF5 hard links to the datasets of that earlier
+ * observation, so every observation group still contains all datasets. Use
+ * `get_topology_observation_id()` to find observations that share their
+ * topology.
+ *
  * \warning Currently the topology of the grids is assumed to be tensor products
  * of lines, i.e. lines, quadrilaterals, and hexahedrons. However, this can be
  * extended in the future. If support for more topologies is required, please
@@ -100,6 +118,28 @@ class VolumeData : public h5::Object {
   void write_volume_data(size_t observation_id, double observation_value,
                          const std::vector<ElementVolumeData>& elements);
 
+  /*!
+   * \brief Write the observation `observation_id` of all `volume_files` to
+   * this subfile as a single observation, e.g. to combine the volume data that
+   * the nodes of a simulation wrote to separate files.
+   *
+   * The datasets of the tensor components and the topology of the grids are
+   * concatenated in the order of the `volume_files` without decoding the data
+   * (tensor components written as truncated modal coefficients stay
+   * compressed). Every dataset is copied in pieces of at most
+   * `max_buffer_size` points, so the memory needed doesn't grow with the size
+   * of the data. The connectivity is shifted to the points of the
+   * concatenated grids rather than computed again, and if the concatenated
+   * grids have the same topology as the last observation written to this
+   * subfile the topology datasets are shared as in `write_volume_data()`.
+   *
+   * \requires all `volume_files` hold the observation `observation_id` with
+   * the same observation value, dimension, and tensor components.
+   */
+  void write_concatenated_volume_data(
+      size_t observation_id, const std::vector<const VolumeData*>& volume_files,
+      size_t max_buffer_size = 1'048'576);
+
   /// List all the integral observation ids in the subfile
   ///
   /// The list of observation IDs is sorted by their observation value, as
@@ -121,6 +161,12 @@ class VolumeData : public h5::Object {
                                        << " found in volume file.");
   }
 
+  /// The observation id of the observation that first wrote the topology of
+  /// the grids (names, extents, bases, quadratures, and connectivity) at
+  /// observation id `observation_id`. Observations with the same topology id
+  /// share the same topology datasets.
+  size_t get_topology_observation_id(size_t observation_id) const;
+
   /// List all the tensor components at observation id `observation_id`
   std::vector<std::string> list_tensor_components(size_t observation_id) const;
 
@@ -132,6 +178,17 @@ class VolumeData : public h5::Object {
   TensorComponent get_tensor_component(
       size_t observation_id, const std::string& tensor_component) const;
 
+  /// Read a tensor component with name `tensor_component` at observation id
+  /// `observation_id` only on the grids `grid_names`
+  ///
+  /// Only the parts of the dataset that belong to the requested grids are
+  /// read from disk, so this is much cheaper than reading the data from all
+  /// grids when only a few grids are needed. The data of the grids is
+  /// concatenated in the order of `grid_names`.
+  TensorComponent get_tensor_component(
+      size_t observation_id, const std::string& tensor_component,
+      const std::vector<std::string>& grid_names) const;
+
   /// Read the extents of all the grids stored in the file at the observation id
   /// `observation_id`
   std::vector<std::vector<size_t>> get_extents(size_t observation_id) const;
@@ -8,10 +8,13 @@
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
+#include "IO/Observer/ReductionDataBuffer.hpp"
 #include "IO/Observer/Tags.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/NodeLock.hpp"
+#include "Parallel/ParallelComponentHelpers.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -61,7 +64,12 @@ struct Initialize {
  * Uses:
  * - Metavariables:
  *   - `observed_reduction_data_tags` (see ContributeReductionData)
- *
+ * - GlobalCache (optional):
+ *   - `observers::Tags::ReductionBufferSize` and
+ *     `observers::Tags::ReductionFlushInterval` to buffer reduction data in
+ *     memory before writing it to disk (see `observers::ReductionDataBuffer`)
+ *   - `observers::Tags::CoalesceReductions` to send the reductions completed
+ *     on each node at the same observation value in a single message
  */
 template <class Metavariables>
 struct InitializeWriter {
@@ -70,7 +78,8 @@ struct InitializeWriter {
                  Tags::ContributorsOfReductionData, Tags::ReductionDataLock,
                  Tags::ContributorsOfTensorData, Tags::VolumeDataLock,
                  Tags::TensorData, Tags::NodesExpectedToContributeReductions,
-                 Tags::NodesThatContributedReductions, Tags::H5FileLock>,
+                 Tags::NodesThatContributedReductions, Tags::H5FileLock,
+                 Tags::ReductionDataBuffer, Tags::PendingReductionData>,
       typename Metavariables::observed_reduction_data_tags,
       tmpl::transform<
           typename Metavariables::observed_reduction_data_tags,
@@ -82,11 +91,25 @@ struct InitializeWriter {
   template <typename DbTagsList, typename... InboxTags, typename ArrayIndex,
             typename ActionList, typename ParallelComponent>
   static Parallel::iterable_action_return_t apply(
-      db::DataBox<DbTagsList>& /*box*/,
+      db::DataBox<DbTagsList>& box,
       const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
-      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const Parallel::GlobalCache<Metavariables>& cache,
       const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
       const ParallelComponent* const /*meta*/) {
+    if constexpr (tmpl::list_contains_v<
+                      Parallel::get_const_global_cache_tags<Metavariables>,
+                      Tags::ReductionBufferSize>) {
+      db::mutate<Tags::ReductionDataBuffer>(
+          make_not_null(&box),
+          [&cache](const gsl::not_null<ReductionDataBuffer*> buffer) {
+            *buffer = ReductionDataBuffer{
+                Parallel::get<Tags::ReductionBufferSize>(cache),
+                Parallel::get<Tags::ReductionFlushInterval>(cache)};
+          });
+    } else {
+      (void)box;
+      (void)cache;
+    }
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
 };
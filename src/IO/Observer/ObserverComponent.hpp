@@ -5,10 +5,13 @@
 
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/Initialize.hpp"
+#include "IO/Observer/ReductionActions.hpp"
 #include "IO/Observer/Tags.hpp"
 #include "Parallel/Algorithms/AlgorithmGroup.hpp"
 #include "Parallel/Algorithms/AlgorithmNodegroup.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Local.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
@@ -46,6 +49,12 @@ struct Observer {
  * \ingroup ObserversGroup
  * \brief The nodegroup parallel component that is responsible for writing data
  * to disk.
+ *
+ * Reduction data that is buffered in memory (see
+ * `observers::ReductionDataBuffer`) is written to disk at every phase change and
+ * before the executable exits. If SpECTRE was configured with
+ * `SPECTRE_TRACE_ACTIONS`, the actions traced on each node are also written
+ * before the executable exits (see `Parallel::ActionTrace`).
  */
 template <class Metavariables>
 struct ObserverWriter {
@@ -63,6 +72,28 @@ struct ObserverWriter {
 
   static void execute_next_phase(
       const Parallel::Phase /*next_phase*/,
-      Parallel::CProxy_GlobalCache<Metavariables>& /*global_cache*/) {}
+      Parallel::CProxy_GlobalCache<Metavariables>& global_cache) {
+    // Write all buffered reduction data at the end of each phase so it is on
+    // disk before checkpoints are written or elements are migrated
+    flush_reduction_data(global_cache);
+  }
+
+  static void prepare_for_exit(
+      Parallel::CProxy_GlobalCache<Metavariables>& global_cache) {
+    flush_reduction_data(global_cache);
+#ifdef SPECTRE_TRACE_ACTIONS
+    auto& local_cache = *Parallel::local_branch(global_cache);
+    Parallel::threaded_action<ThreadedActions::WriteActionTrace>(
+        Parallel::get_parallel_component<ObserverWriter>(local_cache));
+#endif  // SPECTRE_TRACE_ACTIONS
+  }
+
+ private:
+  static void flush_reduction_data(
+      Parallel::CProxy_GlobalCache<Metavariables>& global_cache) {
+    auto& local_cache = *Parallel::local_branch(global_cache);
+    Parallel::threaded_action<ThreadedActions::FlushReductionData>(
+        Parallel::get_parallel_component<ObserverWriter>(local_cache));
+  }
 };
 }  // namespace observers
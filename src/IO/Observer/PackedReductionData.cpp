@@ -0,0 +1,30 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/Observer/PackedReductionData.hpp"
+
+#include <pup.h>
+#include <pup_stl.h>
+
+namespace observers {
+void PackedReductionData::pup(PUP::er& p) {
+  p | type_index;
+  p | observation_id;
+  p | subfile_name;
+  p | reduction_names;
+  p | data;
+}
+
+bool operator==(const PackedReductionData& lhs,
+                const PackedReductionData& rhs) {
+  return lhs.type_index == rhs.type_index and
+         lhs.observation_id == rhs.observation_id and
+         lhs.subfile_name == rhs.subfile_name and
+         lhs.reduction_names == rhs.reduction_names and lhs.data == rhs.data;
+}
+
+bool operator!=(const PackedReductionData& lhs,
+                const PackedReductionData& rhs) {
+  return not(lhs == rhs);
+}
+}  // namespace observers
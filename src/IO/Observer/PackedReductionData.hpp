@@ -0,0 +1,46 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "IO/Observer/ObservationId.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace observers {
+/*!
+ * \ingroup ObserversGroup
+ * \brief The reduction data of one node for one reduction, serialized so that
+ * reductions of different types can be sent to the writing node in a single
+ * message.
+ *
+ * The `type_index` is the index of the `observers::Tags::ReductionData` tag of
+ * the reduction in `Metavariables::observed_reduction_data_tags`, which
+ * determines the type the `data` is deserialized to.
+ *
+ * \see observers::Tags::CoalesceReductions
+ */
+struct PackedReductionData {
+  size_t type_index{0};
+  ObservationId observation_id{};
+  std::string subfile_name{};
+  std::vector<std::string> reduction_names{};
+  std::vector<char> data{};
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+};
+
+bool operator==(const PackedReductionData& lhs,
+                const PackedReductionData& rhs);
+bool operator!=(const PackedReductionData& lhs,
+                const PackedReductionData& rhs);
+}  // namespace observers
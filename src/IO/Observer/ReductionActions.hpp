@@ -18,8 +18,11 @@
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/Helpers.hpp"
 #include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/PackedReductionData.hpp"
 #include "IO/Observer/Protocols/ReductionDataFormatter.hpp"
+#include "IO/Observer/ReductionDataBuffer.hpp"
 #include "IO/Observer/Tags.hpp"
+#include "Parallel/ActionTrace.hpp"
 #include "Parallel/ArrayIndex.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Info.hpp"
@@ -30,6 +33,7 @@
 #include "Parallel/Printf.hpp"
 #include "Parallel/PupStlCpp17.hpp"
 #include "Parallel/Reduction.hpp"
+#include "Parallel/Serialize.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GetOutput.hpp"
@@ -52,6 +56,7 @@ namespace ThreadedActions {
 /// \cond
 struct CollectReductionDataOnNode;
 struct WriteReductionData;
+struct WriteReductionDataBundle;
 /// \endcond
 }  // namespace ThreadedActions
 
@@ -223,8 +228,11 @@ void append_to_reduction_data(
     const gsl::not_null<std::vector<double>*> all_reduction_data,
     const std::vector<double>& t);
 
+// Flattens the `data` into a single row and passes it to the `buffer`, which
+// writes it to disk once it has accumulated enough rows.
 template <typename... Ts, size_t... Is>
-void write_data(const std::string& subfile_name,
+void write_data(const gsl::not_null<ReductionDataBuffer*> buffer,
+                const std::string& subfile_name,
                 const std::string& input_source,
                 std::vector<std::string> legend, const std::tuple<Ts...>& data,
                 const std::string& file_prefix,
@@ -235,26 +243,31 @@ void write_data(const std::string& subfile_name,
   EXPAND_PACK_LEFT_TO_RIGHT(
       append_to_reduction_data(&data_to_append, std::get<Is>(data)));
 
-  if (legend.size() != data_to_append.size()) {
-    ERROR(
-        "There must be one name provided for each piece of data. You provided "
-        << legend.size() << " names: '" << get_output(legend)
-        << "' but there are " << data_to_append.size()
-        << " pieces of data being reduced");
-  }
+  buffer->append(file_prefix + ".h5", input_source, subfile_name,
+                 std::move(legend), std::move(data_to_append));
+}
 
-  h5::H5File<h5::AccessType::ReadWrite> h5file(file_prefix + ".h5", true,
-                                               input_source);
-  constexpr size_t version_number = 0;
-  auto& time_series_file = h5file.try_insert<h5::Dat>(
-      subfile_name, std::move(legend), version_number);
-  time_series_file.append(data_to_append);
+template <typename Metavariables>
+bool coalesce_reductions(const Parallel::GlobalCache<Metavariables>& cache) {
+  if constexpr (tmpl::list_contains_v<
+                    Parallel::get_const_global_cache_tags<Metavariables>,
+                    Tags::CoalesceReductions>) {
+    return Parallel::get<Tags::CoalesceReductions>(cache);
+  } else {
+    (void)cache;
+    return false;
+  }
 }
 }  // namespace ReductionActions_detail
 
 /*!
  * \brief Gathers all the reduction data from all processing elements/cores on a
  * node.
+ *
+ * Once the node has gathered all reduction data at the `observation_id` it
+ * sends the data to node 0 with `WriteReductionData`, or holds it to send it
+ * with other reductions in a `WriteReductionDataBundle` if
+ * `observers::Tags::CoalesceReductions` is enabled.
  */
 struct CollectReductionDataOnNode {
  public:
@@ -291,17 +304,21 @@ struct CollectReductionDataOnNode {
         reduction_observers_contributed = nullptr;
     Parallel::NodeLock* reduction_data_lock = nullptr;
     Parallel::NodeLock* reduction_file_lock = nullptr;
+    ReductionDataBuffer* reduction_data_buffer = nullptr;
+    std::vector<PackedReductionData>* pending_reduction_data = nullptr;
     size_t observations_registered_with_id = std::numeric_limits<size_t>::max();
 
     node_lock->lock();
     db::mutate<Tags::ReductionData<ReductionDatums...>,
                Tags::ReductionDataNames<ReductionDatums...>,
                Tags::ContributorsOfReductionData, Tags::ReductionDataLock,
-               Tags::H5FileLock>(
+               Tags::H5FileLock, Tags::ReductionDataBuffer,
+               Tags::PendingReductionData>(
         make_not_null(&box),
         [&reduction_data, &reduction_names_map,
          &reduction_observers_contributed, &reduction_data_lock,
-         &reduction_file_lock, &observation_id, &observer_group_id,
+         &reduction_file_lock, &reduction_data_buffer, &pending_reduction_data,
+         &observation_id, &observer_group_id,
          &observations_registered_with_id](
             const gsl::not_null<std::unordered_map<
                 observers::ObservationId,
@@ -316,6 +333,10 @@ struct CollectReductionDataOnNode {
                 reduction_observers_contributed_ptr,
             const gsl::not_null<Parallel::NodeLock*> reduction_data_lock_ptr,
             const gsl::not_null<Parallel::NodeLock*> reduction_file_lock_ptr,
+            const gsl::not_null<ReductionDataBuffer*>
+                reduction_data_buffer_ptr,
+            const gsl::not_null<std::vector<PackedReductionData>*>
+                pending_reduction_data_ptr,
             const std::unordered_map<ObservationKey,
                                      std::unordered_set<ArrayComponentId>>&
                 observations_registered) {
@@ -334,6 +355,8 @@ struct CollectReductionDataOnNode {
               &*reduction_observers_contributed_ptr;
           reduction_data_lock = &*reduction_data_lock_ptr;
           reduction_file_lock = &*reduction_file_lock_ptr;
+          reduction_data_buffer = &*reduction_data_buffer_ptr;
+          pending_reduction_data = &*pending_reduction_data_ptr;
           observations_registered_with_id =
               observations_registered.at(key).size();
         },
@@ -370,6 +393,7 @@ struct CollectReductionDataOnNode {
           Parallel::get_parallel_component<ParallelComponent>(cache);
       reduction_file_lock->lock();
       ReductionActions_detail::write_data(
+          make_not_null(reduction_data_buffer),
           "/Core" + std::to_string(observe_with_core_id.value()) + subfile_name,
           observers::input_source_from_cache(cache),
           std::move(reduction_names_this_core),
@@ -413,6 +437,9 @@ struct CollectReductionDataOnNode {
     // `send_data` to allow us to defer the send call until after we've
     // unlocked the lock.
     bool send_data = false;
+    // Reductions held to be sent to node 0 in a single message. They are sent
+    // once this node completes a reduction at a different observation value.
+    std::vector<PackedReductionData> bundle_to_send{};
     if (reduction_observers_contributed->at(observation_id).size() ==
         observations_registered_with_id) {
       send_data = true;
@@ -427,9 +454,37 @@ struct CollectReductionDataOnNode {
       reduction_observers_contributed->erase(observation_id);
       reduction_data->erase(observation_id);
       reduction_names_map->erase(observation_id);
+
+      // Reductions with a formatter are sent immediately so their message is
+      // printed without delay.
+      if (ReductionActions_detail::coalesce_reductions(cache) and
+          not formatter.has_value()) {
+        send_data = false;
+        if (not pending_reduction_data->empty() and
+            pending_reduction_data->front().observation_id.value() !=
+                observation_id.value()) {
+          bundle_to_send = std::move(*pending_reduction_data);
+          pending_reduction_data->clear();
+        }
+        pending_reduction_data->push_back(PackedReductionData{
+            tmpl::index_of<typename Metavariables::observed_reduction_data_tags,
+                           Tags::ReductionData<ReductionDatums...>>::value,
+            observation_id, subfile_name, std::move(reduction_names),
+            serialize<Parallel::ReductionData<ReductionDatums...>>(
+                received_reduction_data)});
+      }
     }
     reduction_data_lock->unlock();
 
+    if (not bundle_to_send.empty()) {
+      auto& my_proxy =
+          Parallel::get_parallel_component<ParallelComponent>(cache);
+      Parallel::threaded_action<WriteReductionDataBundle>(
+          Parallel::get_parallel_component<ObserverWriter<Metavariables>>(
+              cache)[0],
+          Parallel::my_node<size_t>(*Parallel::local_branch(my_proxy)),
+          std::move(bundle_to_send), false);
+    }
     if (send_data) {
       auto& my_proxy =
           Parallel::get_parallel_component<ParallelComponent>(cache);
@@ -492,17 +547,19 @@ struct WriteReductionData {
         nodes_contributed = nullptr;
     Parallel::NodeLock* reduction_data_lock = nullptr;
     Parallel::NodeLock* reduction_file_lock = nullptr;
+    ReductionDataBuffer* reduction_data_buffer = nullptr;
     size_t observations_registered_with_id = std::numeric_limits<size_t>::max();
 
     node_lock->lock();
     db::mutate<Tags::ReductionData<ReductionDatums...>,
                Tags::ReductionDataNames<ReductionDatums...>,
                Tags::NodesThatContributedReductions, Tags::ReductionDataLock,
-               Tags::H5FileLock>(
+               Tags::H5FileLock, Tags::ReductionDataBuffer>(
         make_not_null(&box),
         [&nodes_contributed, &reduction_data, &reduction_names_map,
-         &reduction_data_lock, &reduction_file_lock, &observation_id,
-         &observations_registered_with_id, &sender_node_number](
+         &reduction_data_lock, &reduction_file_lock, &reduction_data_buffer,
+         &observation_id, &observations_registered_with_id,
+         &sender_node_number](
             const gsl::not_null<
                 typename Tags::ReductionData<ReductionDatums...>::type*>
                 reduction_data_ptr,
@@ -514,6 +571,8 @@ struct WriteReductionData {
                 nodes_contributed_ptr,
             const gsl::not_null<Parallel::NodeLock*> reduction_data_lock_ptr,
             const gsl::not_null<Parallel::NodeLock*> reduction_file_lock_ptr,
+            const gsl::not_null<ReductionDataBuffer*>
+                reduction_data_buffer_ptr,
             const std::unordered_map<ObservationKey, std::set<size_t>>&
                 nodes_registered_for_reductions) {
           const ObservationKey& key{observation_id.observation_key()};
@@ -536,6 +595,7 @@ struct WriteReductionData {
           nodes_contributed = &*nodes_contributed_ptr;
           reduction_data_lock = &*reduction_data_lock_ptr;
           reduction_file_lock = &*reduction_file_lock_ptr;
+          reduction_data_buffer = &*reduction_data_buffer_ptr;
           observations_registered_with_id =
               nodes_registered_for_reductions.at(key).size();
         },
@@ -618,7 +678,8 @@ struct WriteReductionData {
         }
       }
       ReductionActions_detail::write_data(
-          subfile_name, observers::input_source_from_cache(cache),
+          make_not_null(reduction_data_buffer), subfile_name,
+          observers::input_source_from_cache(cache),
           // NOLINTNEXTLINE(bugprone-use-after-move)
           std::move(reduction_names), std::move(received_reduction_data.data()),
           Parallel::get<Tags::ReductionFileName>(cache),
@@ -661,9 +722,13 @@ struct WriteReductionDataRow {
                     std::tuple<Ts...>&& reduction_data) {
     auto& reduction_file_lock =
         db::get_mutable_reference<Tags::H5FileLock>(make_not_null(&box));
+    auto& reduction_data_buffer =
+        db::get_mutable_reference<Tags::ReductionDataBuffer>(
+            make_not_null(&box));
     reduction_file_lock.lock();
     ThreadedActions::ReductionActions_detail::write_data(
-        subfile_name, observers::input_source_from_cache(cache),
+        make_not_null(&reduction_data_buffer), subfile_name,
+        observers::input_source_from_cache(cache),
         std::move(legend), std::move(reduction_data),
         Parallel::get<Tags::ReductionFileName>(cache),
         std::make_index_sequence<sizeof...(Ts)>{});
@@ -671,5 +736,146 @@ struct WriteReductionDataRow {
   }
 };
 
+/*!
+ * \brief Write all reduction data that is buffered on this node to disk.
+ *
+ * Invoke this action on the observers::ObserverWriter component. It is invoked
+ * on all nodes at every phase change and before the executable exits.
+ *
+ * Reductions that this node holds to send to node 0 in a single message (see
+ * `observers::Tags::CoalesceReductions`) are sent first, and node 0 flushes its
+ * buffer again once it has written them.
+ *
+ * \see observers::ReductionDataBuffer
+ */
+struct FlushReductionData {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> node_lock) {
+    Parallel::NodeLock* reduction_data_lock = nullptr;
+    Parallel::NodeLock* reduction_file_lock = nullptr;
+    ReductionDataBuffer* reduction_data_buffer = nullptr;
+    std::vector<PackedReductionData>* pending_reduction_data = nullptr;
+    node_lock->lock();
+    db::mutate<Tags::ReductionDataLock, Tags::H5FileLock,
+               Tags::ReductionDataBuffer, Tags::PendingReductionData>(
+        make_not_null(&box),
+        [&reduction_data_lock, &reduction_file_lock, &reduction_data_buffer,
+         &pending_reduction_data](
+            const gsl::not_null<Parallel::NodeLock*> reduction_data_lock_ptr,
+            const gsl::not_null<Parallel::NodeLock*> reduction_file_lock_ptr,
+            const gsl::not_null<ReductionDataBuffer*>
+                reduction_data_buffer_ptr,
+            const gsl::not_null<std::vector<PackedReductionData>*>
+                pending_reduction_data_ptr) {
+          reduction_data_lock = &*reduction_data_lock_ptr;
+          reduction_file_lock = &*reduction_file_lock_ptr;
+          reduction_data_buffer = &*reduction_data_buffer_ptr;
+          pending_reduction_data = &*pending_reduction_data_ptr;
+        });
+    node_lock->unlock();
+
+    reduction_data_lock->lock();
+    std::vector<PackedReductionData> bundle_to_send =
+        std::move(*pending_reduction_data);
+    pending_reduction_data->clear();
+    reduction_data_lock->unlock();
+    if (not bundle_to_send.empty()) {
+      auto& my_proxy =
+          Parallel::get_parallel_component<ParallelComponent>(cache);
+      Parallel::threaded_action<WriteReductionDataBundle>(
+          Parallel::get_parallel_component<ObserverWriter<Metavariables>>(
+              cache)[0],
+          Parallel::my_node<size_t>(*Parallel::local_branch(my_proxy)),
+          std::move(bundle_to_send), true);
+    }
+
+    reduction_file_lock->lock();
+    reduction_data_buffer->flush();
+    reduction_file_lock->unlock();
+  }
+};
+
+/*!
+ * \ingroup ObserversGroup
+ * \brief Write the reductions that node `sender_node_number` sent to node 0 in
+ * a single message.
+ *
+ * Each `observers::PackedReductionData` in the `bundle` is unpacked to the
+ * reduction data type in `Metavariables::observed_reduction_data_tags` it was
+ * packed from and handled as if it was sent with `WriteReductionData`. If
+ * `flush` is `true` the reduction data buffered on node 0 is written to disk
+ * afterwards (see `FlushReductionData`).
+ *
+ * \see observers::Tags::CoalesceReductions
+ */
+struct WriteReductionDataBundle {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& array_index,
+                    const gsl::not_null<Parallel::NodeLock*> node_lock,
+                    const size_t sender_node_number,
+                    std::vector<PackedReductionData>&& bundle,
+                    const bool flush) {
+    using reduction_data_tags =
+        typename Metavariables::observed_reduction_data_tags;
+    for (auto& packed_reduction_data : bundle) {
+      ASSERT(packed_reduction_data.type_index <
+                 tmpl::size<reduction_data_tags>::value,
+             "Received reduction data of unknown type "
+                 << packed_reduction_data.type_index);
+      tmpl::for_each<reduction_data_tags>([&box, &cache, &array_index,
+                                           &node_lock, &sender_node_number,
+                                           &packed_reduction_data](
+                                              auto reduction_data_tag_v) {
+        using reduction_data_tag =
+            tmpl::type_from<decltype(reduction_data_tag_v)>;
+        using reduction_data = typename reduction_data_tag::type::mapped_type;
+        if (packed_reduction_data.type_index !=
+            tmpl::index_of<reduction_data_tags, reduction_data_tag>::value) {
+          return;
+        }
+        WriteReductionData::template apply<ParallelComponent>(
+            box, cache, array_index, node_lock,
+            packed_reduction_data.observation_id, sender_node_number,
+            packed_reduction_data.subfile_name,
+            std::move(packed_reduction_data.reduction_names),
+            deserialize<reduction_data>(packed_reduction_data.data.data()));
+      });
+    }
+    if (flush) {
+      FlushReductionData::template apply<ParallelComponent>(
+          box, cache, array_index, node_lock);
+    }
+  }
+};
+
+/*!
+ * \brief Write the iterable actions traced on this node to the Chrome trace
+ * file `ReductionFileNameActionTraceNodeN.json`, where `N` is the node.
+ *
+ * Invoke this action on the observers::ObserverWriter component. It is invoked
+ * on all nodes before the executable exits if SpECTRE was configured with
+ * `SPECTRE_TRACE_ACTIONS`, see `Parallel::ActionTrace`.
+ */
+struct WriteActionTrace {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> /*node_lock*/) {
+    const int node = Parallel::my_node<int>(cache);
+    Parallel::ActionTrace::write_chrome_trace(
+        Parallel::get<Tags::ReductionFileName>(cache) + "ActionTraceNode" +
+            std::to_string(node) + ".json",
+        node);
+  }
+};
 }  // namespace ThreadedActions
 }  // namespace observers
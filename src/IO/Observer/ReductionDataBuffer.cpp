@@ -0,0 +1,108 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/Observer/ReductionDataBuffer.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/StdHelpers.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+
+namespace observers {
+ReductionDataBuffer::ReductionDataBuffer(const size_t max_buffered_rows,
+                                         const double flush_interval)
+    : max_buffered_rows_(max_buffered_rows), flush_interval_(flush_interval) {
+  ASSERT(max_buffered_rows_ > 0,
+         "Must buffer at least one row of reduction data.");
+}
+
+void ReductionDataBuffer::append(const std::string& file_name,
+                                 const std::string& input_source,
+                                 const std::string& subfile_name,
+                                 std::vector<std::string> legend,
+                                 std::vector<double> row) {
+  if (UNLIKELY(legend.size() != row.size())) {
+    ERROR("There must be one name provided for each piece of data. You provided "
+          << legend.size() << " names: '" << get_output(legend)
+          << "' but there are " << row.size()
+          << " pieces of data being reduced");
+  }
+  if (std::isnan(last_flush_time_)) {
+    last_flush_time_ = sys::wall_time();
+  }
+
+  auto& file_buffer = files_[file_name];
+  file_buffer.input_source = input_source;
+  auto& subfile_buffer = file_buffer.subfiles[subfile_name];
+  if (subfile_buffer.rows.empty()) {
+    subfile_buffer.legend = std::move(legend);
+  } else if (UNLIKELY(subfile_buffer.legend != legend)) {
+    using ::operator<<;
+    ERROR("The legend of the subfile '"
+          << subfile_name << "' in file '" << file_name
+          << "' changed while its data was buffered. The buffered legend is "
+          << subfile_buffer.legend << " while the received legend is "
+          << legend);
+  }
+  subfile_buffer.rows.push_back(std::move(row));
+  ++number_of_buffered_rows_;
+
+  if (number_of_buffered_rows_ >= max_buffered_rows_ or
+      sys::wall_time() - last_flush_time_ >= flush_interval_) {
+    flush();
+  }
+}
+
+void ReductionDataBuffer::flush() {
+  for (const auto& [file_name, file_buffer] : files_) {
+    // All subfiles of the file are written with a single handle
+    h5::H5File<h5::AccessType::ReadWrite> h5file(file_name, true,
+                                                 file_buffer.input_source);
+    for (const auto& [subfile_name, subfile_buffer] : file_buffer.subfiles) {
+      constexpr size_t version_number = 0;
+      auto& time_series_file = h5file.try_insert<h5::Dat>(
+          subfile_name, subfile_buffer.legend, version_number);
+      time_series_file.append(subfile_buffer.rows);
+      h5file.close_current_object();
+    }
+  }
+  files_.clear();
+  number_of_buffered_rows_ = 0;
+  last_flush_time_ = sys::wall_time();
+}
+
+void ReductionDataBuffer::pup(PUP::er& p) {
+  p | max_buffered_rows_;
+  p | flush_interval_;
+  p | number_of_buffered_rows_;
+  p | files_;
+  if (p.isUnpacking()) {
+    last_flush_time_ = std::numeric_limits<double>::signaling_NaN();
+  }
+}
+
+void ReductionDataBuffer::SubfileBuffer::pup(PUP::er& p) {
+  p | legend;
+  p | rows;
+}
+
+void ReductionDataBuffer::FileBuffer::pup(PUP::er& p) {
+  p | input_source;
+  p | subfiles;
+}
+}  // namespace observers
@@ -0,0 +1,100 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace observers {
+/*!
+ * \ingroup ObserversGroup
+ * \brief Buffers rows of reduction data in memory and appends them to their
+ * `h5::Dat` subfiles in batches.
+ *
+ * Opening the reduction file and extending an `h5::Dat` dataset by a single
+ * row for every observation is expensive when many time-series quantities are
+ * observed at each step, and it fragments the chunks of the datasets. This
+ * class collects the rows for each subfile of each file and writes them with a
+ * single file handle per file and a single extension per subfile once either
+ * - `max_buffered_rows` rows have been buffered in total, or
+ * - `flush_interval` seconds of wall time have passed since the last flush.
+ *
+ * The default-constructed buffer has `max_buffered_rows == 1`, i.e. every row
+ * is written as soon as it is appended.
+ *
+ * Buffered rows are serialized, so no data is lost when restarting from a
+ * checkpoint. The `observers::ObserverWriter` flushes the buffers at every
+ * phase change (in particular before writing a checkpoint) and before the
+ * executable exits, so the files on disk are consistent with the checkpoints.
+ *
+ * \note The file is closed after each flush rather than being kept open for
+ * the lifetime of the buffer, so that HDF5's file locking doesn't prevent
+ * reading the reduction file while the simulation is running.
+ *
+ * \warning This class does no locking. Guard all calls with the
+ * `observers::Tags::H5FileLock`.
+ */
+class ReductionDataBuffer {
+ public:
+  ReductionDataBuffer() = default;
+  ReductionDataBuffer(size_t max_buffered_rows, double flush_interval);
+
+  /*!
+   * \brief Buffer a row of data for the `h5::Dat` subfile `subfile_name` in
+   * the file `file_name`, and flush all buffers if necessary.
+   *
+   * The `legend` must be the same for all rows of a subfile. The
+   * `input_source` is written to the file when it is created.
+   */
+  void append(const std::string& file_name, const std::string& input_source,
+              const std::string& subfile_name, std::vector<std::string> legend,
+              std::vector<double> row);
+
+  /// Write all buffered rows to disk
+  void flush();
+
+  /// The total number of rows currently held in memory
+  size_t number_of_buffered_rows() const { return number_of_buffered_rows_; }
+
+  size_t max_buffered_rows() const { return max_buffered_rows_; }
+
+  double flush_interval() const { return flush_interval_; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  struct SubfileBuffer {
+    std::vector<std::string> legend{};
+    std::vector<std::vector<double>> rows{};
+
+    // NOLINTNEXTLINE(google-runtime-references)
+    void pup(PUP::er& p);
+  };
+
+  struct FileBuffer {
+    std::string input_source{};
+    std::map<std::string, SubfileBuffer> subfiles{};
+
+    // NOLINTNEXTLINE(google-runtime-references)
+    void pup(PUP::er& p);
+  };
+
+  size_t max_buffered_rows_{1};
+  double flush_interval_{std::numeric_limits<double>::infinity()};
+  size_t number_of_buffered_rows_{0};
+  // The wall time is not serialized, the interval restarts after a restart
+  double last_flush_time_{std::numeric_limits<double>::signaling_NaN()};
+  std::map<std::string, FileBuffer> files_{};
+};
+}  // namespace observers
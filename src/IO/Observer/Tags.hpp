@@ -18,6 +18,8 @@
 #include "DataStructures/Tensor/TensorData.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/PackedReductionData.hpp"
+#include "IO/Observer/ReductionDataBuffer.hpp"
 #include "Options/Options.hpp"
 #include "Parallel/NodeLock.hpp"
 #include "Parallel/Reduction.hpp"
@@ -132,6 +134,14 @@ struct ReductionDataNames : db::SimpleTag {
   using data_tag = ReductionData<ReductionDatums...>;
 };
 
+/// Rows of reduction data that are buffered in memory before they are written
+/// to disk.
+///
+/// \see observers::ReductionDataBuffer
+struct ReductionDataBuffer : db::SimpleTag {
+  using type = observers::ReductionDataBuffer;
+};
+
 /// Node lock used when needing to read/write to H5 files on disk.
 ///
 /// The reason for only having one lock for all files is that we currently don't
@@ -195,6 +205,37 @@ struct SurfaceFileName {
       "Name of the surface data file without extension"};
   using group = Group;
 };
+
+/// The maximum number of rows of reduction data that are buffered in memory
+/// before they are written to disk.
+struct ReductionBufferSize {
+  using type = size_t;
+  static constexpr Options::String help = {
+      "Maximum number of rows of reduction data that are held in memory before "
+      "they are written to disk. Set to 1 to write every row immediately."};
+  static type lower_bound() { return 1; }
+  using group = Group;
+};
+
+/// The maximum wall time between writes of buffered reduction data.
+struct ReductionFlushInterval {
+  using type = double;
+  static constexpr Options::String help = {
+      "Maximum wall time in seconds that reduction data is held in memory "
+      "before it is written to disk."};
+  static type lower_bound() { return 0.0; }
+  using group = Group;
+};
+
+/// Whether to send the reductions that each node completes at the same
+/// observation value to the writing node in a single message.
+struct CoalesceReductions {
+  using type = bool;
+  static constexpr Options::String help = {
+      "Send all reductions that a node completes at the same observation value "
+      "(e.g. time) to the writing node in a single message."};
+  using group = Group;
+};
 }  // namespace OptionTags
 
 namespace Tags {
@@ -254,5 +295,73 @@ struct SurfaceFileName : db::SimpleTag {
     return surface_file_name;
   }
 };
+
+/// \brief The maximum number of rows of reduction data that are buffered in
+/// memory before they are written to disk.
+///
+/// Reduction data is only buffered if this tag and
+/// `observers::Tags::ReductionFlushInterval` are in the global cache, i.e.
+/// added to the `const_global_cache_tags` of the executable. Otherwise every
+/// row is written immediately.
+///
+/// \see observers::ReductionDataBuffer
+struct ReductionBufferSize : db::SimpleTag {
+  using type = size_t;
+  using option_tags = tmpl::list<::observers::OptionTags::ReductionBufferSize>;
+
+  static constexpr bool pass_metavariables = false;
+  static size_t create_from_options(const size_t reduction_buffer_size) {
+    return reduction_buffer_size;
+  }
+};
+
+/// \brief The maximum wall time in seconds between writes of buffered
+/// reduction data.
+///
+/// \see observers::Tags::ReductionBufferSize
+struct ReductionFlushInterval : db::SimpleTag {
+  using type = double;
+  using option_tags =
+      tmpl::list<::observers::OptionTags::ReductionFlushInterval>;
+
+  static constexpr bool pass_metavariables = false;
+  static double create_from_options(const double reduction_flush_interval) {
+    return reduction_flush_interval;
+  }
+};
+
+/// \brief Whether the reductions that a node completes at the same observation
+/// value are sent to the writing node in a single message.
+///
+/// Events such as `Events::ObserveNorms` and `Events::ObserveTimeStep` that
+/// run at the same time each contribute their own reduction. With this option
+/// each node holds the reductions it has completed until it completes one at a
+/// different observation value (see `observers::ObservationId::value`), and
+/// then sends all held reductions to node 0 in one
+/// `observers::ThreadedActions::WriteReductionDataBundle` message. The held
+/// reductions are also sent when the reduction data is flushed, i.e. at every
+/// phase change and before the executable exits. Reductions with a formatter
+/// are always sent immediately so that their messages are printed without
+/// delay.
+///
+/// Reductions are only coalesced if this tag is in the global cache, i.e.
+/// added to the `const_global_cache_tags` of the executable, and is `true`.
+struct CoalesceReductions : db::SimpleTag {
+  using type = bool;
+  using option_tags = tmpl::list<::observers::OptionTags::CoalesceReductions>;
+
+  static constexpr bool pass_metavariables = false;
+  static bool create_from_options(const bool coalesce_reductions) {
+    return coalesce_reductions;
+  }
+};
+
+/// The reductions that this node has completed but not yet sent to the
+/// writing node.
+///
+/// \see observers::Tags::CoalesceReductions
+struct PendingReductionData : db::SimpleTag {
+  using type = std::vector<PackedReductionData>;
+};
 }  // namespace Tags
 }  // namespace observers
@@ -9,7 +9,9 @@
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 #include <blaze/math/typetraits/IsSparseMatrix.h>
 #include <cstddef>
+#include <iterator>
 #include <tuple>
+#include <vector>
 
 #include "Utilities/EqualWithinRoundoff.hpp"
 #include "Utilities/Gsl.hpp"
@@ -20,6 +22,89 @@ namespace LinearSolver::Serial {
 namespace detail {
 CREATE_IS_CALLABLE(reset)
 CREATE_IS_CALLABLE_V(reset)
+CREATE_IS_CALLABLE(apply_batch)
+CREATE_IS_CALLABLE_V(apply_batch)
+
+// Number of unit vectors that are fed to a linear operator at once if it
+// supports batched application
+constexpr size_t build_matrix_batch_size = 8;
+
+template <typename MatrixType, typename Iterator>
+void store_column(const gsl::not_null<MatrixType*> matrix, const size_t i,
+                  Iterator result_iterator_begin,
+                  const Iterator& result_iterator_end) {
+  auto col = column(*matrix, i);
+  if constexpr (blaze::IsSparseMatrix_v<MatrixType>) {
+    size_t k = 0;
+    while (result_iterator_begin != result_iterator_end) {
+      if (not equal_within_roundoff(*result_iterator_begin, 0.)) {
+        col[k] = *result_iterator_begin;
+      }
+      ++result_iterator_begin;
+      ++k;
+    }
+  } else {
+    std::copy(result_iterator_begin, result_iterator_end, col.begin());
+  }
+}
+
+template <typename LinearOperator, typename OperandType, typename ResultType,
+          typename MatrixType, typename... OperatorArgs>
+void build_matrix_batched(const gsl::not_null<MatrixType*> matrix,
+                          const gsl::not_null<OperandType*> operand_buffer,
+                          const gsl::not_null<ResultType*> result_buffer,
+                          const LinearOperator& linear_operator,
+                          const std::tuple<OperatorArgs...>& operator_args) {
+  const size_t size = matrix->columns();
+  std::vector<OperandType> operands(std::min(size, build_matrix_batch_size),
+                                    *operand_buffer);
+  std::vector<ResultType> results(operands.size(), *result_buffer);
+  // Each operand in the batch keeps an iterator to its unit vector location.
+  // The iterators are advanced by the batch size after every batch, so we
+  // don't have to iterate from the beginning of the operands every time.
+  using OperandIterator = decltype(operands.front().begin());
+  std::vector<OperandIterator> unit_vector_locations{};
+  unit_vector_locations.reserve(operands.size());
+  for (size_t j = 0; j < operands.size(); ++j) {
+    unit_vector_locations.push_back(
+        std::next(operands[j].begin(), static_cast<std::ptrdiff_t>(j)));
+  }
+  for (size_t first_column = 0; first_column < size;
+       first_column += build_matrix_batch_size) {
+    const size_t batch_size =
+        std::min(size - first_column, build_matrix_batch_size);
+    // The last batch may be smaller. Operators can rely on the sizes of the
+    // operand and result vectors being equal.
+    operands.resize(batch_size);
+    results.resize(batch_size);
+    unit_vector_locations.resize(batch_size);
+    // Set a 1 at the unit vector location of each operand
+    for (auto& unit_vector_location : unit_vector_locations) {
+      *unit_vector_location = 1.;
+    }
+    // Invoke the operator on all unit vectors in the batch
+    std::apply(
+        [&linear_operator, &operands,
+         &results](const auto&... expanded_operator_args) {
+          linear_operator.apply_batch(make_not_null(&results), operands,
+                                      expanded_operator_args...);
+        },
+        operator_args);
+    // Set the unit vectors back to zero and store the results in the
+    // corresponding columns of the matrix
+    for (size_t j = 0; j < batch_size; ++j) {
+      *unit_vector_locations[j] = 0.;
+      store_column(matrix, first_column + j, results[j].begin(),
+                   results[j].end());
+      // Move on to the unit vector location of the next batch, unless it
+      // lies past the end of the operand
+      if (first_column + j + build_matrix_batch_size < size) {
+        std::advance(unit_vector_locations[j],
+                     static_cast<std::ptrdiff_t>(build_matrix_batch_size));
+      }
+    }
+  }
+}
 }  // namespace detail
 
 /*!
@@ -38,6 +123,17 @@ CREATE_IS_CALLABLE_V(reset)
  * requirements on the linear operator.
  * \param operator_args These arguments are passed along to the
  * `linear_operator` when it is applied to an operand.
+ *
+ * Building the matrix requires one operator application per column. If the
+ * `linear_operator` has a member function
+ * `apply_batch(gsl::not_null<std::vector<ResultType>*> results, const
+ * std::vector<OperandType>& operands, const OperatorArgs&... args) const` it is
+ * fed several unit vectors at once, so it can amortize its setup cost (e.g.
+ * retrieving arguments and preparing memory buffers) over the batch. The
+ * `results` have the same size as the `operands` and are sized like the
+ * `result_buffer` on entry. In this case the `operand_buffer` and
+ * `result_buffer` are only used as templates for the batch's memory buffers.
+ * The operand type must be iterable in the same order as the matrix rows.
  */
 template <typename LinearOperator, typename OperandType, typename ResultType,
           typename MatrixType, typename... OperatorArgs>
@@ -52,44 +148,41 @@ void build_matrix(const gsl::not_null<MatrixType*> matrix,
   if constexpr (blaze::IsSparseMatrix_v<MatrixType>) {
     matrix->reset();
   }
-  size_t i = 0;
-  // Re-using the iterators for all operator invocations
-  auto result_iterator_begin = result_buffer->begin();
-  auto result_iterator_end = result_buffer->end();
-  for (double& unit_vector_data : *operand_buffer) {
-    // Set a 1 at the unit vector location i
-    unit_vector_data = 1.;
-    // Invoke the operator on the unit vector
-    std::apply(
-        linear_operator,
-        std::tuple_cat(std::forward_as_tuple(result_buffer, *operand_buffer),
-                       operator_args));
-    // Set the unit vector back to zero
-    unit_vector_data = 0.;
-    // Reset the iterator by calling its `reset` member function or by
-    // re-creating it
-    if constexpr (detail::is_reset_callable_v<
-                      decltype(result_iterator_begin)>) {
-      result_iterator_begin.reset();
-    } else {
-      result_iterator_begin = result_buffer->begin();
-      result_iterator_end = result_buffer->end();
-    }
-    // Store the result in column i of the matrix
-    auto col = column(*matrix, i);
-    if constexpr (blaze::IsSparseMatrix_v<MatrixType>) {
-      size_t k = 0;
-      while (result_iterator_begin != result_iterator_end) {
-        if (not equal_within_roundoff(*result_iterator_begin, 0.)) {
-          col[k] = *result_iterator_begin;
-        }
-        ++result_iterator_begin;
-        ++k;
+  if constexpr (detail::is_apply_batch_callable_v<
+                    const LinearOperator&,
+                    gsl::not_null<std::vector<ResultType>*>,
+                    const std::vector<OperandType>&, const OperatorArgs&...>) {
+    detail::build_matrix_batched(matrix, operand_buffer, result_buffer,
+                                 linear_operator, operator_args);
+  } else {
+    size_t i = 0;
+    // Re-using the iterators for all operator invocations
+    auto result_iterator_begin = result_buffer->begin();
+    auto result_iterator_end = result_buffer->end();
+    for (double& unit_vector_data : *operand_buffer) {
+      // Set a 1 at the unit vector location i
+      unit_vector_data = 1.;
+      // Invoke the operator on the unit vector
+      std::apply(
+          linear_operator,
+          std::tuple_cat(std::forward_as_tuple(result_buffer, *operand_buffer),
+                         operator_args));
+      // Set the unit vector back to zero
+      unit_vector_data = 0.;
+      // Reset the iterator by calling its `reset` member function or by
+      // re-creating it
+      if constexpr (detail::is_reset_callable_v<
+                        decltype(result_iterator_begin)>) {
+        result_iterator_begin.reset();
+      } else {
+        result_iterator_begin = result_buffer->begin();
+        result_iterator_end = result_buffer->end();
       }
-    } else {
-      std::copy(result_iterator_begin, result_iterator_end, col.begin());
+      // Store the result in column i of the matrix
+      detail::store_column(matrix, i, result_iterator_begin,
+                           result_iterator_end);
+      ++i;
     }
-    ++i;
   }
 }
 
@@ -0,0 +1,248 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/ActionTrace.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/Phase.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+
+namespace Parallel::ActionTrace {
+namespace {
+// The data recorded by one processing element. The mutex is only contended
+// while the data is being collected.
+struct Recorder {
+  std::mutex mutex{};
+  ProcData data{};
+};
+
+// The registered names and the recorders of all processing elements of this
+// process.
+struct Registry {
+  std::mutex mutex{};
+  std::vector<ActionInfo> actions{};
+  std::unordered_map<std::string, size_t> element_ids{};
+  std::vector<std::string> elements{};
+  std::vector<std::unique_ptr<Recorder>> recorders{};
+};
+
+Registry& registry() {
+  static Registry registry{};
+  return registry;
+}
+
+Recorder& local_recorder() {
+  thread_local Recorder* recorder = [] {
+    auto& the_registry = registry();
+    const std::lock_guard lock(the_registry.mutex);
+    auto& new_recorder =
+        the_registry.recorders.emplace_back(std::make_unique<Recorder>());
+    new_recorder->data.proc = sys::my_proc();
+    new_recorder->data.dropped_events = 0;
+    return new_recorder.get();
+  }();
+  return *recorder;
+}
+
+std::string escape_json(const std::string& text) {
+  std::string result{};
+  result.reserve(text.size());
+  for (const char c : text) {
+    if (c == '"' or c == '\\') {
+      result += '\\';
+      result += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      result += ' ';
+    } else {
+      result += c;
+    }
+  }
+  return result;
+}
+}  // namespace
+
+void Statistics::add(const double duration, const bool retried) {
+  ++calls;
+  if (retried) {
+    ++retries;
+  }
+  total_time += duration;
+  max_time = std::max(max_time, duration);
+}
+
+void Statistics::merge(const Statistics& other) {
+  calls += other.calls;
+  retries += other.retries;
+  total_time += other.total_time;
+  max_time = std::max(max_time, other.max_time);
+}
+
+size_t register_action(const std::string& component,
+                       const Parallel::Phase phase,
+                       const std::string& action) {
+  auto& the_registry = registry();
+  const std::lock_guard lock(the_registry.mutex);
+  the_registry.actions.push_back(ActionInfo{component, phase, action});
+  return the_registry.actions.size() - 1;
+}
+
+size_t register_element(const std::string& name) {
+  auto& the_registry = registry();
+  const std::lock_guard lock(the_registry.mutex);
+  const auto [it, inserted] =
+      the_registry.element_ids.emplace(name, the_registry.elements.size());
+  if (inserted) {
+    the_registry.elements.push_back(name);
+  }
+  return it->second;
+}
+
+void record(const size_t action_id, const size_t element_id,
+            const double start_time, const double end_time,
+            const Parallel::AlgorithmExecution execution) {
+  auto& recorder = local_recorder();
+  const std::lock_guard lock(recorder.mutex);
+  auto& data = recorder.data;
+  const double duration = end_time - start_time;
+  const bool retried = execution == Parallel::AlgorithmExecution::Retry;
+  if (data.statistics.size() <= action_id) {
+    data.statistics.resize(action_id + 1);
+  }
+  data.statistics[action_id].add(duration, retried);
+  if (data.events.size() < max_events_per_proc) {
+    data.events.push_back(
+        Event{action_id, element_id, start_time, duration, retried});
+  } else {
+    ++data.dropped_events;
+  }
+}
+
+std::vector<ActionInfo> registered_actions() {
+  auto& the_registry = registry();
+  const std::lock_guard lock(the_registry.mutex);
+  return the_registry.actions;
+}
+
+std::vector<std::string> registered_elements() {
+  auto& the_registry = registry();
+  const std::lock_guard lock(the_registry.mutex);
+  return the_registry.elements;
+}
+
+std::vector<ProcData> recorded_data() {
+  auto& the_registry = registry();
+  const std::lock_guard lock(the_registry.mutex);
+  std::vector<ProcData> result{};
+  result.reserve(the_registry.recorders.size());
+  for (const auto& recorder : the_registry.recorders) {
+    const std::lock_guard recorder_lock(recorder->mutex);
+    result.push_back(recorder->data);
+  }
+  return result;
+}
+
+std::string chrome_trace(const int node) {
+  const auto actions = registered_actions();
+  const auto elements = registered_elements();
+  const auto data = recorded_data();
+
+  std::vector<Statistics> node_statistics(actions.size());
+  for (const auto& proc_data : data) {
+    for (size_t id = 0; id < proc_data.statistics.size(); ++id) {
+      node_statistics[id].merge(proc_data.statistics[id]);
+    }
+  }
+
+  std::ostringstream os{};
+  os << std::setprecision(12);
+  os << "{\"traceEvents\":[";
+  bool first = true;
+  const auto separator = [&first, &os]() {
+    if (not first) {
+      os << ",\n";
+    }
+    first = false;
+  };
+  separator();
+  os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << node
+     << ",\"args\":{\"name\":\"Node " << node << "\"}}";
+  for (const auto& proc_data : data) {
+    separator();
+    os << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << node
+       << ",\"tid\":" << proc_data.proc << ",\"args\":{\"name\":\"Proc "
+       << proc_data.proc << "\"}}";
+    for (const auto& event : proc_data.events) {
+      const auto& action = actions[event.action_id];
+      separator();
+      // Chrome traces are in microseconds
+      os << "{\"name\":\"" << escape_json(action.action)
+         << "\",\"cat\":\"" << escape_json(action.component)
+         << "\",\"ph\":\"X\",\"pid\":" << node << ",\"tid\":" << proc_data.proc
+         << ",\"ts\":" << 1.0e6 * event.start_time
+         << ",\"dur\":" << 1.0e6 * event.duration
+         << ",\"args\":{\"element\":\""
+         << escape_json(elements[event.element_id]) << "\",\"phase\":\""
+         << action.phase << "\",\"retried\":"
+         << (event.retried ? "true" : "false") << "}}";
+    }
+  }
+  os << "],\n\"displayTimeUnit\":\"ms\",\n\"actionStatistics\":[";
+  first = true;
+  for (size_t id = 0; id < actions.size(); ++id) {
+    const auto& statistics = node_statistics[id];
+    if (statistics.calls == 0) {
+      continue;
+    }
+    separator();
+    os << "{\"component\":\"" << escape_json(actions[id].component)
+       << "\",\"phase\":\"" << actions[id].phase << "\",\"action\":\""
+       << escape_json(actions[id].action) << "\",\"calls\":" << statistics.calls
+       << ",\"retries\":" << statistics.retries
+       << ",\"totalTime\":" << statistics.total_time
+       << ",\"maxTime\":" << statistics.max_time << "}";
+  }
+  size_t dropped_events = 0;
+  for (const auto& proc_data : data) {
+    dropped_events += proc_data.dropped_events;
+  }
+  os << "],\n\"droppedEvents\":" << dropped_events << "}\n";
+  return os.str();
+}
+
+void write_chrome_trace(const std::string& filename, const int node) {
+  const auto data = recorded_data();
+  if (std::all_of(data.begin(), data.end(), [](const ProcData& proc_data) {
+        return proc_data.statistics.empty();
+      })) {
+    return;
+  }
+  std::ofstream file(filename);
+  if (not file.is_open()) {
+    ERROR("Could not open '" << filename << "' to write the action trace.");
+  }
+  file << chrome_trace(node);
+}
+
+void clear() {
+  auto& the_registry = registry();
+  const std::lock_guard lock(the_registry.mutex);
+  for (const auto& recorder : the_registry.recorders) {
+    const std::lock_guard recorder_lock(recorder->mutex);
+    recorder->data.statistics.clear();
+    recorder->data.events.clear();
+    recorder->data.dropped_events = 0;
+  }
+}
+}  // namespace Parallel::ActionTrace
@@ -0,0 +1,124 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/Phase.hpp"
+#include "Utilities/PrettyType.hpp"
+
+/*!
+ * \ingroup ParallelGroup
+ * \brief Built-in tracing of the iterable actions executed by the parallel
+ * components.
+ *
+ * \details If SpECTRE is configured with `-D SPECTRE_TRACE_ACTIONS=ON`, every
+ * invocation of an iterable action by `Parallel::DistributedObject` is timed
+ * and recorded. For each component, phase, and action the number of calls, the
+ * number of calls that returned `Parallel::AlgorithmExecution::Retry`, and the
+ * total and maximum wall time are accumulated. In addition, the first
+ * `max_events_per_proc` invocations on each processing element are kept as
+ * individual events, labeled by the array index of the element that invoked
+ * them, so the time spent by each element is available.
+ *
+ * The data recorded by all processing elements of a node is combined by
+ * `write_chrome_trace`, which the `observers::ObserverWriter` calls on every
+ * node when the executable exits. The resulting file can be loaded into
+ * `chrome://tracing` or [Perfetto](https://ui.perfetto.dev), with one process
+ * per node and one thread per processing element. The accumulated statistics
+ * are stored in the same file under the `"actionStatistics"` key.
+ *
+ * Without `SPECTRE_TRACE_ACTIONS` nothing is recorded and the algorithm loop
+ * has no overhead.
+ */
+namespace Parallel::ActionTrace {
+/// The number of action invocations on each processing element that are
+/// stored as individual events. Later invocations only contribute to the
+/// `Statistics`.
+constexpr size_t max_events_per_proc = 100000;
+
+/// Accumulated statistics of the invocations of one iterable action
+struct Statistics {
+  size_t calls = 0;
+  size_t retries = 0;
+  double total_time = 0.0;
+  double max_time = 0.0;
+
+  void add(double duration, bool retried);
+
+  void merge(const Statistics& other);
+};
+
+/// A single invocation of an iterable action
+struct Event {
+  size_t action_id;
+  size_t element_id;
+  double start_time;
+  double duration;
+  bool retried;
+};
+
+/// The name of the component, the phase, and the name of an action
+/// registered with `register_action`
+struct ActionInfo {
+  std::string component;
+  Parallel::Phase phase;
+  std::string action;
+};
+
+/// The data recorded by one processing element
+struct ProcData {
+  int proc;
+  std::vector<Statistics> statistics;
+  std::vector<Event> events;
+  size_t dropped_events;
+};
+
+/// Returns an identifier for the action, which is the same for all calls
+/// with the same arguments on this process.
+size_t register_action(const std::string& component, Parallel::Phase phase,
+                       const std::string& action);
+
+/// Returns an identifier for the element, which is the same for all calls
+/// with the same `name` on this process.
+size_t register_element(const std::string& name);
+
+/// The identifier of `Action` executed by `ParallelComponent` in `Phase`.
+template <typename ParallelComponent, Parallel::Phase Phase, typename Action>
+size_t action_id() {
+  static const size_t id = register_action(
+      pretty_type::name<ParallelComponent>(), Phase,
+      pretty_type::name<Action>());
+  return id;
+}
+
+/// Records an invocation of an action on the calling processing element.
+/// The times are wall times in seconds, e.g. from `sys::wall_time()`.
+void record(size_t action_id, size_t element_id, double start_time,
+            double end_time, Parallel::AlgorithmExecution execution);
+
+/// The actions registered on this process, indexed by their identifiers
+std::vector<ActionInfo> registered_actions();
+
+/// The elements registered on this process, indexed by their identifiers
+std::vector<std::string> registered_elements();
+
+/// A copy of the data recorded by every processing element of this process
+std::vector<ProcData> recorded_data();
+
+/// The data recorded on this process as a Chrome trace, see
+/// `Parallel::ActionTrace`. `node` is used as the process identifier.
+std::string chrome_trace(int node);
+
+/// Writes `chrome_trace(node)` to `filename`, if any action has been recorded
+/// on this process.
+void write_chrome_trace(const std::string& filename, int node);
+
+/// Discards all data recorded on this process. The registered actions and
+/// elements are kept.
+void clear();
+}  // namespace Parallel::ActionTrace
@@ -630,6 +630,48 @@ struct RegisterGlobalCacheMutate : RegistrationHelper {
   static bool registrar;
 };
 
+/*!
+ * \ingroup CharmExtensionsGroup
+ * \brief Derived class for registering GlobalCache::invoke_on_node
+ *
+ * Calls the appropriate Charm++ function to register the invoke_on_node
+ * function.
+ */
+template <typename Metavariables, typename Function, typename... Args>
+struct RegisterGlobalCacheInvokeOnNode : RegistrationHelper {
+  using cproxy = CProxy_GlobalCache<Metavariables>;
+  using ckindex = CkIndex_GlobalCache<Metavariables>;
+  using algorithm = GlobalCache<Metavariables>;
+
+  RegisterGlobalCacheInvokeOnNode() = default;
+  RegisterGlobalCacheInvokeOnNode(const RegisterGlobalCacheInvokeOnNode&) =
+      default;
+  RegisterGlobalCacheInvokeOnNode& operator=(
+      const RegisterGlobalCacheInvokeOnNode&) = default;
+  RegisterGlobalCacheInvokeOnNode(RegisterGlobalCacheInvokeOnNode&&) = default;
+  RegisterGlobalCacheInvokeOnNode& operator=(
+      RegisterGlobalCacheInvokeOnNode&&) = default;
+  ~RegisterGlobalCacheInvokeOnNode() override = default;
+
+  void register_with_charm() const override {
+    static bool done_registration{false};
+    if (done_registration) {
+      return;  // LCOV_EXCL_LINE
+    }
+    done_registration = true;
+    ckindex::template idx_invoke_on_node<Function>(
+        static_cast<void (algorithm::*)(const std::tuple<Args...>&,
+                                        const CkCallback&)>(nullptr));
+  }
+
+  std::string name() const override {
+    return get_template_parameters_as_string<
+        RegisterGlobalCacheInvokeOnNode>();
+  }
+
+  static bool registrar;
+};
+
 /*!
  * \ingroup CharmExtensionsGroup
  * \brief Derived class for registering the invoke_iterable_action entry method.
@@ -800,6 +842,13 @@ bool Parallel::charmxx::RegisterGlobalCacheMutate<
     Parallel::charmxx::register_func_with_charm<RegisterGlobalCacheMutate<
         Metavariables, GlobalCacheTag, Function, Args...>>();
 
+// clang-tidy: redundant declaration
+template <typename Metavariables, typename Function, typename... Args>
+bool Parallel::charmxx::RegisterGlobalCacheInvokeOnNode<
+    Metavariables, Function, Args...>::registrar =  // NOLINT
+    Parallel::charmxx::register_func_with_charm<
+        RegisterGlobalCacheInvokeOnNode<Metavariables, Function, Args...>>();
+
 // clang-tidy: redundant declaration
 template <typename ParallelComponent, typename Action, typename PhaseIndex,
           typename DataBoxIndex>
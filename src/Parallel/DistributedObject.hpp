@@ -20,6 +20,7 @@
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "Parallel/ActionTrace.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/AlgorithmMetafunctions.hpp"
 #include "Parallel/Algorithms/AlgorithmArrayDeclarations.hpp"
@@ -408,6 +409,11 @@ class DistributedObject<ParallelComponent,
 #ifdef SPECTRE_CHARM_PROJECTIONS
   double non_action_time_start_;
 #endif
+#ifdef SPECTRE_TRACE_ACTIONS
+  // Not serialized, so that the element is registered again with
+  // Parallel::ActionTrace on the process it migrates to.
+  size_t trace_element_id_ = std::numeric_limits<size_t>::max();
+#endif
 
   Parallel::CProxy_GlobalCache<metavariables> global_cache_proxy_;
   bool performing_action_ = false;
@@ -1027,12 +1033,28 @@ bool DistributedObject<
         ParallelComponent, ThisAction, PhaseIndex, DataBoxIndex>::registrar;
   }
 #endif // SPECTRE_CHARM_PROJECTIONS
+#ifdef SPECTRE_TRACE_ACTIONS
+  if (trace_element_id_ == std::numeric_limits<size_t>::max()) {
+    trace_element_id_ = ActionTrace::register_element(
+        MakeString{} << pretty_type::name<ParallelComponent>() << "["
+                     << array_index_ << "]");
+  }
+  const double trace_start_time = sys::wall_time();
+#endif  // SPECTRE_TRACE_ACTIONS
 
   const auto& [requested_execution, next_action_step] = ThisAction::apply(
       box_, inboxes_, *Parallel::local_branch(global_cache_proxy_),
       std::as_const(array_index_), actions_list{},
       std::add_pointer_t<ParallelComponent>{});
 
+#ifdef SPECTRE_TRACE_ACTIONS
+  ActionTrace::record(
+      ActionTrace::action_id<ParallelComponent, phase_dep_action::phase,
+                             ThisAction>(),
+      trace_element_id_, trace_start_time, sys::wall_time(),
+      requested_execution);
+#endif  // SPECTRE_TRACE_ACTIONS
+
   if (next_action_step.has_value()) {
     ASSERT(
         AlgorithmExecution::Retry != requested_execution,
@@ -459,6 +459,16 @@ class GlobalCache : public CBase_GlobalCache<Metavariables> {
   template <typename GlobalCacheTag, typename Function, typename... Args>
   void mutate(const std::tuple<Args...>& args);
 
+  /// Entry method that calls `Function::apply(cache, args...)`, where `cache`
+  /// is this branch of the GlobalCache and `args` are the contents of `args`.
+  /// Invoke it on the GlobalCache proxy to call the function once on every
+  /// node, e.g. to distribute work over the nodes at startup. The `args` are
+  /// sent to every node once. After all nodes have called the function, the
+  /// `callback` is executed.
+  template <typename Function, typename... Args>
+  void invoke_on_node(const std::tuple<Args...>& args,
+                      const CkCallback& callback);
+
   /// Entry method that computes the size of the local branch of the
   /// GlobalCache and sends it to the MemoryMonitor parallel component.
   ///
@@ -631,6 +641,20 @@ void GlobalCache<Metavariables>::mutate(const std::tuple<Args...>& args) {
   }
 }
 
+template <typename Metavariables>
+template <typename Function, typename... Args>
+void GlobalCache<Metavariables>::invoke_on_node(
+    const std::tuple<Args...>& args, const CkCallback& callback) {
+  (void)Parallel::charmxx::RegisterGlobalCacheInvokeOnNode<
+      Metavariables, Function, Args...>::registrar;
+  std::apply(
+      [this](const auto&... unpacked_args) {
+        Function::apply(*this, unpacked_args...);
+      },
+      args);
+  this->contribute(callback);
+}
+
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wsuggest-attribute=noreturn"
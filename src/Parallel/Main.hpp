@@ -44,11 +44,26 @@
 #include "Utilities/System/ParallelInfo.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
+#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
 #include "Utilities/TypeTraits/CreateGetTypeAliasOrDefault.hpp"
 
 #include "Parallel/Main.decl.h"
 
 namespace Parallel {
+namespace detail {
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(distribute_element_creation)
+
+// Array components can define `static constexpr bool
+// distribute_element_creation = true;` to insert their elements from every
+// node in parallel. Their `allocate_array` then returns before the elements are
+// inserted, and every node contributes to a reduction to
+// `Main::distributed_array_allocated` once it has inserted its elements.
+template <typename ParallelComponent>
+struct distributes_element_creation
+    : std::bool_constant<get_distribute_element_creation_or_default_v<
+          ParallelComponent, false>> {};
+}  // namespace detail
+
 /// \ingroup ParallelGroup
 /// The main function of a Charm++ executable.
 /// See [the Parallelization documentation](group__ParallelGroup.html#details)
@@ -87,6 +102,13 @@ class Main : public CBase_Main<Metavariables> {
   /// components, then execute the initialization phase on each component
   void allocate_remaining_components_and_execute_initialization_phase();
 
+  /// Reduction target that is invoked once all nodes have inserted the
+  /// elements of an array component that distributes its element creation.
+  ///
+  /// \details Once all such array components are allocated, finishes their
+  /// insertion and executes the initialization phase on each component.
+  void distributed_array_allocated();
+
   /// Determine the next phase of the simulation and execute it.
   void execute_next_phase();
 
@@ -102,6 +124,12 @@ class Main : public CBase_Main<Metavariables> {
   /// used as the callback after a quiescence detection.
   void start_write_checkpoint();
 
+  /// Exit the program once all components have prepared for exiting
+  ///
+  /// \details This call is wrapped within an entry method so that it may be
+  /// used as the callback after a quiescence detection.
+  void exit_after_quiescence();
+
   /// Reduction target for data used in phase change decisions.
   ///
   /// It is required that the `Parallel::ReductionData` holds a single
@@ -126,6 +154,10 @@ class Main : public CBase_Main<Metavariables> {
   // Check if future checkpoint dirs are available; error if any already exist.
   void check_future_checkpoint_dirs_available() const;
 
+  // Execute the initialization phase on each component once all components are
+  // allocated.
+  void execute_initialization_phase();
+
   template <typename ParallelComponent>
   using parallel_component_options =
       Parallel::get_option_tags<typename ParallelComponent::initialization_tags,
@@ -156,6 +188,9 @@ class Main : public CBase_Main<Metavariables> {
                               Parallel::is_bound_array<tmpl::_1>>>;
   using singleton_component_list =
       tmpl::filter<component_list, Parallel::is_singleton<tmpl::_1>>;
+  using distributed_array_component_list =
+      tmpl::filter<all_array_component_list,
+                   detail::distributes_element_creation<tmpl::_1>>;
 
   Parallel::Phase current_phase_{Parallel::Phase::Initialization};
   CProxy_MutableGlobalCache<Metavariables> mutable_global_cache_proxy_;
@@ -165,6 +200,9 @@ class Main : public CBase_Main<Metavariables> {
   // the chares are created.  It is a member variable because passing
   // local state through charm callbacks is painful.
   tuples::tagged_tuple_from_typelist<option_list> options_{};
+  // Number of array components in `distributed_array_component_list` whose
+  // elements have all been inserted. Only used during startup.
+  size_t number_of_distributed_arrays_allocated_ = 0;
   // type to be determined by the collection of available phase changers in the
   // Metavariables
   tuples::tagged_tuple_from_typelist<phase_change_tags_and_combines_list>
@@ -175,6 +213,23 @@ class Main : public CBase_Main<Metavariables> {
 
 namespace detail {
 
+// Parallel components can define a static function
+// `prepare_for_exit(CProxy_GlobalCache<Metavariables>&)` that is called when
+// the `Exit` phase is entered, e.g. to write buffered data to disk. The program
+// exits once quiescence is reached after these calls.
+template <typename ParallelComponent, typename = std::void_t<>>
+struct has_prepare_for_exit : std::false_type {};
+
+template <typename ParallelComponent>
+struct has_prepare_for_exit<
+    ParallelComponent,
+    std::void_t<decltype(&ParallelComponent::prepare_for_exit)>>
+    : std::true_type {};
+
+template <typename ParallelComponent>
+constexpr bool has_prepare_for_exit_v =
+    has_prepare_for_exit<ParallelComponent>::value;
+
 // Charm++ AtSync effectively requires an additional global sync to the
 // quiescence detection we do for switching phases. However, AtSync only needs
 // to be called for one array to trigger the sync-based load balancing, so the
@@ -627,6 +682,33 @@ void Main<Metavariables>::
   // Free any resources from the initial option parsing.
   options_ = decltype(options_){};
 
+  // Arrays that insert their elements on every node are still being
+  // allocated, so wait for them in `distributed_array_allocated`.
+  if constexpr (tmpl::size<distributed_array_component_list>::value == 0) {
+    execute_initialization_phase();
+  }
+}
+
+template <typename Metavariables>
+void Main<Metavariables>::distributed_array_allocated() {
+  ++number_of_distributed_arrays_allocated_;
+  if (number_of_distributed_arrays_allocated_ <
+      tmpl::size<distributed_array_component_list>::value) {
+    return;
+  }
+  tmpl::for_each<distributed_array_component_list>(
+      [this](auto parallel_component_v) {
+        using parallel_component =
+            tmpl::type_from<decltype(parallel_component_v)>;
+        Parallel::get_parallel_component<parallel_component>(
+            *Parallel::local_branch(global_cache_proxy_))
+            .doneInserting();
+      });
+  execute_initialization_phase();
+}
+
+template <typename Metavariables>
+void Main<Metavariables>::execute_initialization_phase() {
   tmpl::for_each<component_list>([this](auto parallel_component_v) {
     using parallel_component = tmpl::type_from<decltype(parallel_component_v)>;
     Parallel::get_parallel_component<parallel_component>(
@@ -670,8 +752,23 @@ void Main<Metavariables>::execute_next_phase() {
   Parallel::printf("Entering phase: %s\n", current_phase_);
 
   if (Parallel::Phase::Exit == current_phase_) {
-    Informer::print_exit_info();
-    sys::exit();
+    bool wait_for_components = false;
+    tmpl::for_each<component_list>(
+        [this, &wait_for_components](auto parallel_component) {
+          using component = tmpl::type_from<decltype(parallel_component)>;
+          if constexpr (detail::has_prepare_for_exit_v<component>) {
+            component::prepare_for_exit(global_cache_proxy_);
+            wait_for_components = true;
+          }
+        });
+    if (not wait_for_components) {
+      exit_after_quiescence();
+    } else {
+      CkStartQD(
+          CkCallback(CkIndex_Main<Metavariables>::exit_after_quiescence(),
+                     this->thisProxy));
+    }
+    return;
   }
   tmpl::for_each<component_list>([this](auto parallel_component) {
     tmpl::type_from<decltype(parallel_component)>::execute_next_phase(
@@ -722,6 +819,12 @@ void Main<Metavariables>::start_write_checkpoint() {
                               this->thisProxy));
 }
 
+template <typename Metavariables>
+void Main<Metavariables>::exit_after_quiescence() {
+  Informer::print_exit_info();
+  sys::exit();
+}
+
 template <typename Metavariables>
 template <typename InvokeCombine, typename... Tags>
 void Main<Metavariables>::phase_change_reduction(
@@ -0,0 +1,89 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/ReductionActions.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/MemoryMonitor/Tags.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+
+namespace mem_monitor {
+/*!
+ * \brief Simple action meant to be used as a callback for
+ * Parallel::contribute_to_reduction that writes the memory usage of each item
+ * in the DataBox of the elements of an Array parallel component to disk.
+ *
+ * \details The arguments are the names of the DataBox items (see
+ * `db::DataBox::size_of_items()`) and the minimum, sum, and maximum over all
+ * elements of the size of each item in bytes. The columns in the dat file
+ * when the DataBox holds the items `A` and `B` will be
+ *
+ * - %Time
+ * - Number of elements
+ * - A min (MB)
+ * - A mean (MB)
+ * - A max (MB)
+ * - B min (MB)
+ * - B mean (MB)
+ * - B max (MB)
+ *
+ * The dat file will be placed in the `/MemoryMonitors/` group in the reduction
+ * file next to the one written by `mem_monitor::ProcessArray`. The name of the
+ * dat file is the `pretty_type::name` of the component followed by
+ * `DataBoxItems`.
+ */
+template <typename ArrayComponent>
+struct ProcessDataBoxItems {
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            typename ArrayIndex>
+  static void apply(db::DataBox<DbTags>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/, const double time,
+                    const size_t number_of_elements,
+                    const std::vector<std::string>& item_names,
+                    const std::vector<double>& min_size_per_item,
+                    const std::vector<double>& total_size_per_item,
+                    const std::vector<double>& max_size_per_item) {
+    ASSERT(min_size_per_item.size() == item_names.size() and
+               total_size_per_item.size() == item_names.size() and
+               max_size_per_item.size() == item_names.size(),
+           "Expected the sizes of " << item_names.size()
+                                    << " DataBox items, but received "
+                                    << min_size_per_item.size() << ", "
+                                    << total_size_per_item.size() << ", and "
+                                    << max_size_per_item.size());
+    auto& observer_writer_proxy = Parallel::get_parallel_component<
+        observers::ObserverWriter<Metavariables>>(cache);
+
+    std::vector<std::string> legend{{"Time", "Number of elements"}};
+    std::vector<double> sizes{};
+    legend.reserve(2 + 3 * item_names.size());
+    sizes.reserve(3 * item_names.size());
+    for (size_t i = 0; i < item_names.size(); i++) {
+      legend.emplace_back(item_names[i] + " min (MB)");
+      legend.emplace_back(item_names[i] + " mean (MB)");
+      legend.emplace_back(item_names[i] + " max (MB)");
+      sizes.push_back(min_size_per_item[i] / 1.0e6);
+      sizes.push_back(total_size_per_item[i] /
+                      static_cast<double>(number_of_elements) / 1.0e6);
+      sizes.push_back(max_size_per_item[i] / 1.0e6);
+    }
+
+    Parallel::threaded_action<
+        observers::ThreadedActions::WriteReductionDataRow>(
+        // Node 0 is always the writer
+        observer_writer_proxy[0],
+        subfile_name<ArrayComponent>() + "DataBoxItems", legend,
+        std::make_tuple(time, static_cast<double>(number_of_elements), sizes));
+  }
+};
+}  // namespace mem_monitor
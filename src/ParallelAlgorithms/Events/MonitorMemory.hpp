@@ -14,6 +14,7 @@
 #include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/DataBox/TagName.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "Domain/Structure/Element.hpp"
@@ -38,11 +39,14 @@
 #include "Parallel/Serialize.hpp"
 #include "Parallel/TypeTraits.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessArray.hpp"
+#include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessDataBoxItems.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessGroups.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessSingleton.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Functional.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/StdHelpers.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -72,6 +76,15 @@ namespace Events {
  * component ("Blah" for example) in the input file. An ERROR will occur and a
  * list of the available components to monitor will be printed.
  *
+ * If `DataBoxItems` is enabled and the DgElementArray is monitored, the size of
+ * every item in the DataBox of each element is computed as well (see
+ * `db::DataBox::size_of_items()`). The minimum, mean, and maximum over all
+ * elements of the size of each item are written to a second file whose name
+ * is the one of the DgElementArray file followed by `DataBoxItems`. This shows
+ * which items, e.g. mortar data or Jacobians, are responsible for the memory
+ * usage of the elements. See `mem_monitor::ProcessDataBoxItems` for the
+ * columns of the file.
+ *
  * \note Currently, the only Parallel::Algorithms::Array parallel component that
  * can be monitored is the DgElementArray itself.
  */
@@ -86,6 +99,21 @@ class MonitorMemory : public Event {
       // Vector of total mem usage on each node
       Parallel::ReductionDatum<std::vector<double>,
                                funcl::ElementWise<funcl::Plus<>>>>;
+  // Reduction data for the sizes of the DataBox items of arrays
+  using DataBoxItemsReductionData = Parallel::ReductionData<
+      // Time
+      Parallel::ReductionDatum<double, funcl::AssertEqual<>>,
+      // Number of elements
+      Parallel::ReductionDatum<size_t, funcl::Plus<>>,
+      // Names of the items
+      Parallel::ReductionDatum<std::vector<std::string>, funcl::AssertEqual<>>,
+      // Min, total, and max size of each item
+      Parallel::ReductionDatum<std::vector<double>,
+                               funcl::ElementWise<funcl::Min<>>>,
+      Parallel::ReductionDatum<std::vector<double>,
+                               funcl::ElementWise<funcl::Plus<>>>,
+      Parallel::ReductionDatum<std::vector<double>,
+                               funcl::ElementWise<funcl::Max<>>>>;
 
  public:
   explicit MonitorMemory(CkMigrateMessage* msg);
@@ -101,7 +129,15 @@ class MonitorMemory : public Event {
         "instead."};
   };
 
-  using options = tmpl::list<ComponentsToMonitor>;
+  struct DataBoxItems {
+    using type = bool;
+    static constexpr Options::String help = {
+        "Also monitor the memory usage of each item in the DataBox of the "
+        "DgElementArray, reduced over all elements. Only has an effect if the "
+        "DgElementArray is monitored."};
+  };
+
+  using options = tmpl::list<ComponentsToMonitor, DataBoxItems>;
 
   static constexpr Options::String help =
       "Observe memory usage of parallel components.";
@@ -111,20 +147,22 @@ class MonitorMemory : public Event {
   template <typename Metavariables>
   MonitorMemory(
       const std::optional<std::vector<std::string>>& components_to_monitor,
-      const Options::Context& context, Metavariables /*meta*/);
+      bool monitor_data_box_items, const Options::Context& context,
+      Metavariables /*meta*/);
 
-  using observed_reduction_data_tags =
-      observers::make_reduction_data_tags<tmpl::list<ReductionData>>;
+  using observed_reduction_data_tags = observers::make_reduction_data_tags<
+      tmpl::list<ReductionData, DataBoxItemsReductionData>>;
 
   using compute_tags_for_observation_box = tmpl::list<>;
 
-  using argument_tags =
-      tmpl::list<ObservationValueTag, domain::Tags::Element<Dim>>;
+  using argument_tags = tmpl::list<ObservationValueTag,
+                                   domain::Tags::Element<Dim>, ::Tags::DataBox>;
 
-  template <typename Metavariables, typename ArrayIndex,
+  template <typename DbTagsList, typename Metavariables, typename ArrayIndex,
             typename ParallelComponent>
   void operator()(const typename ObservationValueTag::type& observation_value,
                   const ::Element<Dim>& element,
+                  const db::DataBox<DbTagsList>& box,
                   Parallel::GlobalCache<Metavariables>& cache,
                   const ArrayIndex& array_index,
                   const ParallelComponent* const /*meta*/) const;
@@ -153,6 +191,7 @@ class MonitorMemory : public Event {
 
  private:
   std::unordered_set<std::string> components_to_monitor_{};
+  bool monitor_data_box_items_{false};
 };
 
 /// \cond
@@ -164,7 +203,9 @@ template <size_t Dim, typename ObservationValueTag>
 template <typename Metavariables>
 MonitorMemory<Dim, ObservationValueTag>::MonitorMemory(
     const std::optional<std::vector<std::string>>& components_to_monitor,
-    const Options::Context& context, Metavariables /*meta*/) {
+    const bool monitor_data_box_items, const Options::Context& context,
+    Metavariables /*meta*/)
+    : monitor_data_box_items_(monitor_data_box_items) {
   using component_list = tmpl::push_back<typename Metavariables::component_list,
                                          Parallel::GlobalCache<Metavariables>>;
   std::unordered_map<std::string, std::string> existing_components{};
@@ -227,18 +268,18 @@ MonitorMemory<Dim, ObservationValueTag>::MonitorMemory(
 }
 
 template <size_t Dim, typename ObservationValueTag>
-template <typename Metavariables, typename ArrayIndex,
+template <typename DbTagsList, typename Metavariables, typename ArrayIndex,
           typename ParallelComponent>
 void MonitorMemory<Dim, ObservationValueTag>::operator()(
     const typename ObservationValueTag::type& observation_value,
-    const ::Element<Dim>& element, Parallel::GlobalCache<Metavariables>& cache,
-    const ArrayIndex& array_index,
+    const ::Element<Dim>& element, const db::DataBox<DbTagsList>& box,
+    Parallel::GlobalCache<Metavariables>& cache, const ArrayIndex& array_index,
     const ParallelComponent* const /*meta*/) const {
   using component_list = tmpl::push_back<typename Metavariables::component_list,
                                          Parallel::GlobalCache<Metavariables>>;
 
-  tmpl::for_each<component_list>([this, &observation_value, &element, &cache,
-                                  &array_index](auto component_v) {
+  tmpl::for_each<component_list>([this, &observation_value, &element, &box,
+                                  &cache, &array_index](auto component_v) {
     using component = tmpl::type_from<decltype(component_v)>;
 
     // If we aren't monitoring this parallel component, then just exit now
@@ -284,6 +325,25 @@ void MonitorMemory<Dim, ObservationValueTag>::operator()(
           mem_monitor::ProcessArray<ParallelComponent>>(
           ReductionData{static_cast<double>(observation_value), data},
           array_element_proxy, memory_monitor_proxy);
+
+      if (monitor_data_box_items_) {
+        // The event runs on the elements of the DgElementArray, so the
+        // DataBox passed to the event is the one of this element.
+        const auto item_sizes = box.size_of_items();
+        std::vector<std::string> item_names(item_sizes.size());
+        std::vector<double> sizes(item_sizes.size());
+        for (size_t i = 0; i < item_sizes.size(); i++) {
+          item_names[i] = item_sizes[i].first;
+          sizes[i] = static_cast<double>(item_sizes[i].second);
+        }
+
+        Parallel::contribute_to_reduction<
+            mem_monitor::ProcessDataBoxItems<ParallelComponent>>(
+            DataBoxItemsReductionData{static_cast<double>(observation_value),
+                                      1_st, std::move(item_names), sizes,
+                                      sizes, sizes},
+            array_element_proxy, memory_monitor_proxy);
+      }
     } else if constexpr (Parallel::is_singleton_v<component>) {
       // If this is a singleton, we only run this once so use the designated
       // element. Nothing to reduce with singletons so just call the simple
@@ -344,6 +404,7 @@ template <size_t Dim, typename ObservationValueTag>
 void MonitorMemory<Dim, ObservationValueTag>::pup(PUP::er& p) {
   Event::pup(p);
   p | components_to_monitor_;
+  p | monitor_data_box_items_;
 }
 
 template <size_t Dim, typename ObservationValueTag>
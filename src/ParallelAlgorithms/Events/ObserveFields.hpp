@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <functional>
 #include <initializer_list>
+#include <limits>
 #include <optional>
 #include <pup.h>
 #include <string>
@@ -19,9 +20,11 @@
 #include "DataStructures/DataBox/TagName.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/FloatingPointType.hpp"
+#include "DataStructures/ModalVector.hpp"
 #include "DataStructures/Tensor/TensorData.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
+#include "IO/H5/ModalCompression.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/GetSectionObservationKey.hpp"
 #include "IO/Observer/ObservationId.hpp"
@@ -29,6 +32,8 @@
 #include "IO/Observer/Tags.hpp"
 #include "IO/Observer/VolumeActions.hpp"
 #include "NumericalAlgorithms/Interpolation/RegularGridInterpolant.hpp"
+#include "NumericalAlgorithms/LinearOperators/CoefficientTransforms.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Options/Auto.hpp"
 #include "Options/Options.hpp"
 #include "Parallel/ArrayIndex.hpp"
@@ -51,8 +56,6 @@
 #include "Utilities/TypeTraits/IsA.hpp"
 
 /// \cond
-template <size_t Dim>
-class Mesh;
 namespace Frame {
 struct Inertial;
 }  // namespace Frame
@@ -83,6 +86,17 @@ class ObserveFields;
  * The user may specify an `interpolation_mesh` to which the
  * data is interpolated.
  *
+ * The user may also specify a `h5::ModalCompression` error bound. Then the
+ * tensor components are written as their modal coefficients on each element,
+ * truncated to the smallest block of lowest modes that keeps the pointwise
+ * error below the bound (see `h5::truncate_modes`). For smooth data this
+ * reduces the size of the volume data considerably. `h5::VolumeData`
+ * reconstructs the nodal values when the data is read. Data on elements
+ * whose mesh is not modally compressible (see `h5::is_modally_compressible`),
+ * e.g. subcell meshes, is written as nodal values. For tensors written in
+ * single precision the rounding of the coefficients counts towards the error
+ * bound.
+ *
  * \note The `NonTensorComputeTags` are intended to be used for `Variables`
  * compute tags like `Tags::DerivCompute`
  *
@@ -155,16 +169,29 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
     using type = FloatingPointType;
   };
 
+  struct ModalCompression {
+    using type =
+        Options::Auto<h5::ModalCompression, Options::AutoLabel::None>;
+    static constexpr Options::String help =
+        "Write truncated modal coefficients instead of nodal values, "
+        "keeping the pointwise error on each element below the specified "
+        "bound. Set to 'None' to write nodal values. The data is written on "
+        "the 'InterpolateToMesh' if one is given.";
+  };
+
   using options =
       tmpl::list<SubfileName, CoordinatesFloatingPointType, FloatingPointTypes,
-                 VariablesToObserve, InterpolateToMesh>;
+                 VariablesToObserve, InterpolateToMesh, ModalCompression>;
 
   static constexpr Options::String help =
       "Observe volume tensor fields.\n"
       "\n"
       "Writes volume quantities:\n"
       " * InertialCoordinates\n"
-      " * Tensors listed in the 'VariablesToObserve' option\n";
+      " * Tensors listed in the 'VariablesToObserve' option\n"
+      "\n"
+      "The data can be written as truncated modal coefficients to save disk "
+      "space. See the 'ModalCompression' option.\n";
 
   ObserveFields() = default;
 
@@ -173,6 +200,7 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
                 const std::vector<FloatingPointType>& floating_point_types,
                 const std::vector<std::string>& variables_to_observe,
                 std::optional<Mesh<VolumeDim>> interpolation_mesh = {},
+                std::optional<h5::ModalCompression> modal_compression = {},
                 const Options::Context& context = {});
 
   using compute_tags_for_observation_box =
@@ -197,8 +225,8 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
     }
     call_operator_impl(subfile_path_ + *section_observation_key,
                        variables_to_observe_, interpolation_mesh_,
-                       observation_value, mesh, box, cache, array_index,
-                       component);
+                       modal_compression_, observation_value, mesh, box, cache,
+                       array_index, component);
   }
 
   // We factor out the work into a static member function so it can  be shared
@@ -211,6 +239,7 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
       const std::unordered_map<std::string, FloatingPointType>&
           variables_to_observe,
       const std::optional<Mesh<VolumeDim>>& interpolation_mesh,
+      const std::optional<h5::ModalCompression>& modal_compression,
       const typename ObservationValueTag::type& observation_value,
       const Mesh<VolumeDim>& mesh,
       const ObservationBox<DataBoxType, ComputeTagsList>& box,
@@ -219,8 +248,13 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
       const ParallelComponent* const /*meta*/) {
     // if no interpolation_mesh is provided, the interpolation is essentially
     // ignored by the RegularGridInterpolant except for a single copy.
-    const intrp::RegularGrid interpolant(mesh,
-                                         interpolation_mesh.value_or(mesh));
+    const Mesh<VolumeDim> observation_mesh = interpolation_mesh.value_or(mesh);
+    const intrp::RegularGrid interpolant(mesh, observation_mesh);
+    const std::vector<size_t> observation_extents(
+        observation_mesh.extents().begin(), observation_mesh.extents().end());
+    const bool mesh_is_modally_compressible =
+        h5::is_modally_compressible(std::vector<Spectral::Basis>(
+            observation_mesh.basis().begin(), observation_mesh.basis().end()));
 
     // Remove tensor types, only storing individual components.
     std::vector<TensorComponent> components;
@@ -233,19 +267,40 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
         0_st));
 
     const auto record_tensor_component_impl =
-        [&components, &interpolant](const auto& tensor,
-                                    const FloatingPointType floating_point_type,
-                                    const std::string& tag_name) {
+        [&components, &interpolant, mesh_is_modally_compressible,
+         &modal_compression, &observation_extents, &observation_mesh](
+            const auto& tensor, const FloatingPointType floating_point_type,
+            const std::string& tag_name) {
           for (size_t i = 0; i < tensor.size(); ++i) {
-            const auto tensor_component = interpolant.interpolate(tensor[i]);
+            DataVector tensor_component = interpolant.interpolate(tensor[i]);
+            std::vector<size_t> modal_extents{};
+            if (modal_compression.has_value()) {
+              if (mesh_is_modally_compressible) {
+                // Coefficients written in single precision are rounded, which
+                // counts towards the error bound
+                auto [retained_extents, retained_modes] = h5::truncate_modes(
+                    to_modal_coefficients(tensor_component, observation_mesh),
+                    observation_extents,
+                    modal_compression->error_bound(max(abs(tensor_component))),
+                    floating_point_type == FloatingPointType::Float
+                        ? 0.5 * std::numeric_limits<float>::epsilon()
+                        : 0.0);
+                tensor_component = std::move(retained_modes);
+                modal_extents = std::move(retained_extents);
+              } else {
+                modal_extents = observation_extents;
+              }
+            }
             if (floating_point_type == FloatingPointType::Float) {
               components.emplace_back(
                   tag_name + tensor.component_suffix(i),
                   std::vector<float>{tensor_component.begin(),
-                                     tensor_component.end()});
+                                     tensor_component.end()},
+                  std::move(modal_extents));
             } else {
               components.emplace_back(tag_name + tensor.component_suffix(i),
-                                      tensor_component);
+                                      std::move(tensor_component),
+                                      std::move(modal_extents));
             }
           }
         };
@@ -285,10 +340,8 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
         observers::ArrayComponentId(
             std::add_pointer_t<ParallelComponent>{nullptr},
             Parallel::ArrayIndex<ElementId<VolumeDim>>(array_index)),
-        element_name, std::move(components),
-        interpolation_mesh.value_or(mesh).extents(),
-        interpolation_mesh.value_or(mesh).basis(),
-        interpolation_mesh.value_or(mesh).quadrature());
+        element_name, std::move(components), observation_mesh.extents(),
+        observation_mesh.basis(), observation_mesh.quadrature());
   }
 
   using observation_registration_tags = tmpl::list<::Tags::DataBox>;
@@ -325,6 +378,7 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
     p | subfile_path_;
     p | variables_to_observe_;
     p | interpolation_mesh_;
+    p | modal_compression_;
   }
 
  private:
@@ -343,6 +397,7 @@ class ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
   std::string subfile_path_;
   std::unordered_map<std::string, FloatingPointType> variables_to_observe_{};
   std::optional<Mesh<VolumeDim>> interpolation_mesh_{};
+  std::optional<h5::ModalCompression> modal_compression_{};
 };
 
 template <size_t VolumeDim, typename ObservationValueTag, typename... Tensors,
@@ -354,6 +409,7 @@ ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
                   const std::vector<FloatingPointType>& floating_point_types,
                   const std::vector<std::string>& variables_to_observe,
                   std::optional<Mesh<VolumeDim>> interpolation_mesh,
+                  std::optional<h5::ModalCompression> modal_compression,
                   const Options::Context& context)
     : subfile_path_("/" + subfile_name),
       variables_to_observe_([&context, &floating_point_types,
@@ -381,7 +437,8 @@ ObserveFields<VolumeDim, ObservationValueTag, tmpl::list<Tensors...>,
         }
         return result;
       }()),
-      interpolation_mesh_(interpolation_mesh) {
+      interpolation_mesh_(interpolation_mesh),
+      modal_compression_(modal_compression) {
   using ::operator<<;
   const std::unordered_set<std::string> valid_tensors{
       db::tag_name<Tensors>()...};
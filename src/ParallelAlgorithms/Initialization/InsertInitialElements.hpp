@@ -0,0 +1,84 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <unordered_set>
+#include <vector>
+
+#include "Domain/Block.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/ElementDistribution.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/InitialElementIds.hpp"
+#include "Domain/Tags.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace Initialization {
+/*!
+ * \brief Inserts the elements of the initial domain into the array
+ * `ParallelComponent`, placing them on procs with the
+ * `domain::BlockZCurveProcDistribution`.
+ *
+ * Pass `insert_on_all_nodes = true` to insert all elements of the domain from
+ * the calling proc and finish the insertion with `doneInserting`. Otherwise,
+ * only the elements that are placed on procs of this node are inserted. Invoke
+ * the function on every node with `Parallel::GlobalCache::invoke_on_node` to
+ * create the elements in parallel. Then the initialization items are sent to
+ * every node once, instead of once per element, and `doneInserting` must be
+ * called once on the array after all nodes have inserted their elements.
+ *
+ * The `initialization_items` must hold the
+ * `domain::Tags::InitialRefinementLevels<Dim>`, and the `domain::Tags::Domain`
+ * is retrieved from the global cache. Each node computes the element
+ * distribution itself, so `procs_to_ignore` must be the same on all nodes.
+ */
+template <size_t Dim, typename ParallelComponent>
+struct InsertInitialElements {
+  template <typename Metavariables, typename InitializationItems>
+  static void apply(Parallel::GlobalCache<Metavariables>& cache,
+                    const InitializationItems& initialization_items,
+                    const std::unordered_set<size_t>& procs_to_ignore,
+                    const bool insert_on_all_nodes = false) {
+    auto& element_array =
+        Parallel::get_parallel_component<ParallelComponent>(cache);
+    const auto& domain = Parallel::get<domain::Tags::Domain<Dim>>(cache);
+    const auto& initial_refinement_levels =
+        get<domain::Tags::InitialRefinementLevels<Dim>>(initialization_items);
+    const size_t num_of_procs_to_use =
+        Parallel::number_of_procs<size_t>(cache) - procs_to_ignore.size();
+    const domain::BlockZCurveProcDistribution<Dim> element_distribution{
+        num_of_procs_to_use, initial_refinement_levels, procs_to_ignore};
+    const size_t my_node = Parallel::my_node<size_t>(cache);
+    const auto is_inserted_here = [&cache, insert_on_all_nodes,
+                                   my_node](const size_t proc) {
+      return insert_on_all_nodes or
+             Parallel::node_of<size_t>(proc, cache) == my_node;
+    };
+    auto global_cache = cache.get_this_proxy();
+    for (const auto& block : domain.blocks()) {
+      if (alg::none_of(element_distribution.procs_for_block(block.id()),
+                       is_inserted_here)) {
+        continue;
+      }
+      const std::vector<ElementId<Dim>> element_ids = initial_element_ids(
+          block.id(), initial_refinement_levels[block.id()]);
+      for (const auto& element_id : element_ids) {
+        const size_t target_proc =
+            element_distribution.get_proc_for_element(element_id);
+        if (is_inserted_here(target_proc)) {
+          element_array(element_id)
+              .insert(global_cache, initialization_items, target_proc);
+        }
+      }
+    }
+    if (insert_on_all_nodes) {
+      element_array.doneInserting();
+    }
+  }
+};
+}  // namespace Initialization
@@ -11,6 +11,7 @@
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/VariablesTag.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
+#include "ParallelAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
 #include "ParallelAlgorithms/Interpolation/Tags.hpp"  // IWYU pragma: keep
 #include "Utilities/Requires.hpp"
 #include "Utilities/TMPL.hpp"
@@ -60,6 +61,8 @@ CREATE_IS_CALLABLE_V(initialize)
 ///   - `Tags::InterpolatedVars<InterpolationTargetTag,TemporalId>`
 ///   - `::Tags::Variables<typename
 ///                   InterpolationTargetTag::vars_to_interpolate_to_target>`
+///   - `Tags::GatheredShards<InterpolationTargetTag,TemporalId>` if the
+///     shards of a sharded InterpolationTarget are gathered for the callback
 /// - Removes: nothing
 /// - Modifies: nothing
 ///
@@ -78,6 +81,10 @@ struct InitializeInterpolationTarget {
 
   using simple_tags = tmpl::append<
       return_tag_list_initial,
+      tmpl::conditional_t<
+          InterpolationTarget_detail::gather_shards<InterpolationTargetTag>,
+          tmpl::list<Tags::GatheredShards<InterpolationTargetTag, TemporalId>>,
+          tmpl::list<>>,
       initialize_interpolation_target_detail::get_simple_tags_or_default_t<
           typename InterpolationTargetTag::compute_target_points,
           tmpl::list<>>>;
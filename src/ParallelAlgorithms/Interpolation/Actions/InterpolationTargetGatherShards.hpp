@@ -0,0 +1,149 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/Variables.hpp"
+#include "ParallelAlgorithms/Interpolation/InterpolatedVars.hpp"
+#include "ParallelAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
+#include "ParallelAlgorithms/Interpolation/Tags.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+namespace Parallel {
+template <typename Metavariables>
+class GlobalCache;
+}  // namespace Parallel
+/// \endcond
+
+namespace intrp {
+namespace Actions {
+/// \ingroup ActionsGroup
+/// \brief Receives the interpolated variables on all the points of one shard
+/// of a sharded InterpolationTarget, on the first shard.
+///
+/// Once the variables of all shards have been received for `temporal_id`, they
+/// are concatenated in the order of the shards, and then
+/// `InterpolationTargetTag::post_interpolation_callback` is called on all the
+/// points of the target.
+///
+/// Uses:
+/// - DataBox:
+///   - `Tags::GatheredShards<InterpolationTargetTag,TemporalId>`
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies:
+///   - `Tags::GatheredShards<InterpolationTargetTag,TemporalId>`
+///   - `Tags::InterpolatedVars<InterpolationTargetTag,TemporalId>`
+///   - `Tags::IndicesOfInvalidInterpPoints<TemporalId>`
+///   - `::Tags::Variables<typename
+///                   InterpolationTargetTag::vars_to_interpolate_to_target>`
+///
+/// \note `Tags::InterpolatedVars` and `Tags::IndicesOfInvalidInterpPoints`
+/// are used only while calling the callback, since the first shard has
+/// already cleaned up the data of its own points for `temporal_id`.
+template <typename InterpolationTargetTag>
+struct InterpolationTargetGatherShards {
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            typename ArrayIndex, typename TemporalId>
+  static void apply(
+      db::DataBox<DbTags>& box, Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& /*array_index*/, const TemporalId& temporal_id,
+      const size_t shard,
+      Variables<typename InterpolationTargetTag::vars_to_interpolate_to_target>
+          shard_vars,
+      std::unordered_set<size_t> shard_invalid_indices) {
+    using vars_type = Variables<
+        typename InterpolationTargetTag::vars_to_interpolate_to_target>;
+    using gathered_type = Vars::GatheredShards<
+        typename InterpolationTargetTag::vars_to_interpolate_to_target>;
+    constexpr size_t number_of_shards =
+        InterpolationTarget_detail::number_of_shards<InterpolationTargetTag>;
+    static_assert(
+        InterpolationTarget_detail::gather_shards<InterpolationTargetTag>,
+        "InterpolationTargetGatherShards should be used only for sharded "
+        "InterpolationTargets whose callback needs all the points");
+
+    bool have_all_shards = false;
+    db::mutate<Tags::GatheredShards<InterpolationTargetTag, TemporalId>,
+               Tags::InterpolatedVars<InterpolationTargetTag, TemporalId>,
+               Tags::IndicesOfInvalidInterpPoints<TemporalId>>(
+        make_not_null(&box),
+        [&have_all_shards, &temporal_id, &shard, &shard_vars,
+         &shard_invalid_indices](
+            const gsl::not_null<std::unordered_map<TemporalId, gathered_type>*>
+                gathered_shards,
+            const gsl::not_null<std::unordered_map<TemporalId, vars_type>*>
+                interpolated_vars,
+            const gsl::not_null<
+                std::unordered_map<TemporalId, std::unordered_set<size_t>>*>
+                indices_of_invalid) {
+          auto& gathered = (*gathered_shards)[temporal_id];
+          ASSERT(gathered.vars.count(shard) == 0,
+                 "Received shard " << shard << " twice at temporal_id "
+                                   << temporal_id);
+          gathered.vars.emplace(shard, std::move(shard_vars));
+          gathered.invalid_indices.emplace(shard,
+                                           std::move(shard_invalid_indices));
+          if (gathered.vars.size() < number_of_shards) {
+            return;
+          }
+          have_all_shards = true;
+
+          size_t number_of_points = 0;
+          for (size_t s = 0; s < number_of_shards; ++s) {
+            number_of_points += gathered.vars.at(s).number_of_grid_points();
+          }
+          vars_type all_vars(number_of_points);
+          auto& all_invalid_indices = (*indices_of_invalid)[temporal_id];
+          const size_t nvars = all_vars.number_of_independent_components;
+          size_t offset = 0;
+          for (size_t s = 0; s < number_of_shards; ++s) {
+            const auto& vars = gathered.vars.at(s);
+            const size_t npts_shard = vars.number_of_grid_points();
+            for (size_t v = 0; v < nvars; ++v) {
+              for (size_t i = 0; i < npts_shard; ++i) {
+                // clang-tidy: no pointer arithmetic
+                all_vars.data()[offset + i + v * number_of_points] =  // NOLINT
+                    vars.data()[i + v * npts_shard];                  // NOLINT
+              }
+            }
+            for (const size_t index : gathered.invalid_indices.at(s)) {
+              all_invalid_indices.insert(offset + index);
+            }
+            offset += npts_shard;
+          }
+          (*interpolated_vars)[temporal_id] = std::move(all_vars);
+          gathered_shards->erase(temporal_id);
+        });
+
+    if (have_all_shards) {
+      // The return value is always true for non-sequential targets
+      InterpolationTarget_detail::call_callback<InterpolationTargetTag>(
+          make_not_null(&box), make_not_null(&cache), temporal_id);
+      db::mutate<Tags::InterpolatedVars<InterpolationTargetTag, TemporalId>,
+                 Tags::IndicesOfInvalidInterpPoints<TemporalId>>(
+          make_not_null(&box),
+          [&temporal_id](
+              const gsl::not_null<std::unordered_map<TemporalId, vars_type>*>
+                  interpolated_vars,
+              const gsl::not_null<
+                  std::unordered_map<TemporalId, std::unordered_set<size_t>>*>
+                  indices_of_invalid) {
+            interpolated_vars->erase(temporal_id);
+            indices_of_invalid->erase(temporal_id);
+          });
+    }
+  }
+};
+}  // namespace Actions
+}  // namespace intrp
@@ -28,6 +28,9 @@ namespace Actions {
 /// This action should be placed in the Registration PDAL for
 /// InterpolationTarget.
 ///
+/// If the InterpolationTarget is sharded, only the first shard sends the
+/// points, since every shard computes the same points.
+///
 /// Uses:
 /// - DataBox:
 ///   - Anything that the particular
@@ -46,13 +49,20 @@ struct InterpolationTargetSendTimeIndepPointsToElements {
       db::DataBox<DbTags>& box,
       const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
       Parallel::GlobalCache<Metavariables>& cache,
-      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      [[maybe_unused]] const ArrayIndex& array_index,
+      const ActionList /*meta*/,
       const ParallelComponent* const /*meta*/) {
     static_assert(
         not InterpolationTargetTag::compute_target_points::is_sequential::value,
         "Actions::InterpolationTargetSendTimeIndepPointsToElement can be used "
         "only with non-sequential targets, since a sequential target is "
         "time-dependent by definition.");
+    if constexpr (InterpolationTarget_detail::number_of_shards<
+                      InterpolationTargetTag> > 1) {
+      if (array_index != 0) {
+        return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+      }
+    }
     auto coords = InterpolationTargetTag::compute_target_points::points(
         box, tmpl::type_<Metavariables>{});
     auto& receiver_proxy = Parallel::get_parallel_component<
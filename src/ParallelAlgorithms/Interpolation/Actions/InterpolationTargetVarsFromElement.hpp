@@ -3,24 +3,22 @@
 
 #pragma once
 
+#include <cstddef>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "ParallelAlgorithms/Interpolation/Actions/InterpolationTargetGatherShards.hpp"
 #include "ParallelAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
 #include "ParallelAlgorithms/Interpolation/Tags.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 
-/// \cond
-namespace Parallel {
-template <typename Metavariables>
-class GlobalCache;
-}  // namespace Parallel
-/// \endcond
-
 namespace intrp {
 namespace Actions {
 /// \ingroup ActionsGroup
@@ -35,6 +33,12 @@ namespace Actions {
 ///   `Tags::IndicesOfFilledInterpPoints`, and
 ///   `Tags::IndicesOfInvalidInterpPoints` for the finished `temporal_id`.
 ///
+/// For a sharded InterpolationTarget, each shard receives only the data on the
+/// points that it owns, with `block_logical_coords` and `global_offsets`
+/// relative to the first point of the shard. If the callback needs all the
+/// points of the target, then instead of calling the callback the shard sends
+/// its data to `InterpolationTargetGatherShards` on the first shard.
+///
 /// Uses:
 /// - DataBox:
 ///   - `Tags::TemporalIds<TemporalId>`
@@ -67,7 +71,7 @@ struct InterpolationTargetVarsFromElement {
             typename ArrayIndex, typename TemporalId>
   static void apply(
       db::DataBox<DbTags>& box, Parallel::GlobalCache<Metavariables>& cache,
-      const ArrayIndex& /*array_index*/,
+      [[maybe_unused]] const ArrayIndex& array_index,
       const std::vector<Variables<
           typename InterpolationTargetTag::vars_to_interpolate_to_target>>&
           vars_src,
@@ -141,11 +145,28 @@ struct InterpolationTargetVarsFromElement {
     if (InterpolationTarget_detail::have_data_at_all_points<
             InterpolationTargetTag>(box, temporal_id)) {
       // All the valid points have been interpolated.
-      // We throw away the return value of call_callback in this case
-      // (it is known to be always true; it can be false only for
-      //  sequential interpolations, which is static-asserted against above).
-      InterpolationTarget_detail::call_callback<InterpolationTargetTag>(
-          make_not_null(&box), make_not_null(&cache), temporal_id);
+      if constexpr (InterpolationTarget_detail::gather_shards<
+                        InterpolationTargetTag>) {
+        const auto& invalid_indices =
+            db::get<Tags::IndicesOfInvalidInterpPoints<TemporalId>>(box);
+        auto& first_shard = Parallel::get_parallel_component<ParallelComponent>(
+            cache)[static_cast<size_t>(0)];
+        Parallel::simple_action<
+            InterpolationTargetGatherShards<InterpolationTargetTag>>(
+            first_shard, temporal_id, static_cast<size_t>(array_index),
+            db::get<Tags::InterpolatedVars<InterpolationTargetTag, TemporalId>>(
+                box)
+                .at(temporal_id),
+            invalid_indices.count(temporal_id) > 0
+                ? invalid_indices.at(temporal_id)
+                : std::unordered_set<size_t>{});
+      } else {
+        // We throw away the return value of call_callback in this case
+        // (it is known to be always true; it can be false only for
+        //  sequential interpolations, which is static-asserted against above).
+        InterpolationTarget_detail::call_callback<InterpolationTargetTag>(
+            make_not_null(&box), make_not_null(&cache), temporal_id);
+      }
       InterpolationTarget_detail::clean_up_interpolation_target<
           InterpolationTargetTag>(make_not_null(&box), temporal_id);
     }
@@ -12,6 +12,7 @@
 #include "Parallel/CharmPupable.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
 #include "ParallelAlgorithms/Interpolation/Interpolate.hpp"
+#include "ParallelAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
 #include "Utilities/PrettyType.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -76,6 +77,11 @@ class Interpolate<VolumeDim, InterpolationTargetTag,
     static_assert(
         std::is_same_v<typename Metavariables::interpolator_source_vars,
                        tmpl::list<InterpolatorSourceVarTags...>>);
+    static_assert(
+        InterpolationTarget_detail::number_of_shards<InterpolationTargetTag> ==
+            1,
+        "Sharded InterpolationTargets are supported only by "
+        "InterpolateWithoutInterpComponent");
     interpolate<InterpolationTargetTag>(temporal_id, mesh, cache, array_index,
                                         interpolator_source_vars...);
   }
@@ -3,12 +3,22 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <iterator>
+#include <optional>
 #include <pup.h>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/IdPair.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/ElementLogicalCoordinates.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Domain/Structure/BlockId.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Evolution/DgSubcell/Tags/ActiveGrid.hpp"
 #include "Evolution/DgSubcell/Tags/Mesh.hpp"
@@ -19,8 +29,11 @@
 #include "Parallel/Invoke.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
 #include "ParallelAlgorithms/Interpolation/Actions/InterpolationTargetVarsFromElement.hpp"
+#include "ParallelAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
 #include "ParallelAlgorithms/Interpolation/PointInfoTag.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/PrettyType.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
@@ -104,18 +117,81 @@ class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
       Parallel::GlobalCache<Metavariables>& cache,
       const ElementId<VolumeDim>& array_index,
       const ParallelComponent* const /*meta*/) const {
-    const auto& block_logical_coords =
-        InterpolationTarget_detail::block_logical_coords<
-            InterpolationTargetTag>(
-            cache,
-            get<Vars::PointInfoTag<InterpolationTargetTag, VolumeDim>>(
-                point_infos),
-            temporal_id);
+    constexpr size_t number_of_shards =
+        InterpolationTarget_detail::number_of_shards<InterpolationTargetTag>;
+    using BlockLogicalCoords = std::vector<std::optional<IdPair<
+        domain::BlockId, tnsr::I<double, VolumeDim, ::Frame::BlockLogical>>>>;
+    const auto& target_points =
+        get<Vars::PointInfoTag<InterpolationTargetTag, VolumeDim>>(point_infos);
+    const size_t number_of_points = get<0>(target_points).size();
     const std::vector<ElementId<VolumeDim>> element_ids{{array_index}};
-    const auto element_coord_holders =
-        element_logical_coordinates(element_ids, block_logical_coords);
 
-    if (element_coord_holders.count(array_index) == 0) {
+    // Locate the points of each shard separately, so the offsets of the points
+    // in this element are relative to the first point of the shard. Each
+    // element still locates all points of the target, since any of them may be
+    // in the element.
+    std::array<BlockLogicalCoords, number_of_shards> block_logical_coords{};
+    std::array<std::optional<ElementLogicalCoordHolder<VolumeDim>>,
+               number_of_shards>
+        element_coord_holders{};
+    bool has_points_in_element = false;
+    for (size_t shard = 0; shard < number_of_shards; ++shard) {
+      if constexpr (number_of_shards == 1) {
+        gsl::at(block_logical_coords, shard) =
+            InterpolationTarget_detail::block_logical_coords<
+                InterpolationTargetTag>(cache, target_points, temporal_id);
+      } else {
+        const auto [first_point, end_point] =
+            InterpolationTarget_detail::shard_point_range(
+                number_of_points, number_of_shards, shard);
+        std::decay_t<decltype(target_points)> shard_points(end_point -
+                                                           first_point);
+        for (size_t d = 0; d < VolumeDim; ++d) {
+          std::copy(target_points.get(d).begin() +
+                        static_cast<std::ptrdiff_t>(first_point),
+                    target_points.get(d).begin() +
+                        static_cast<std::ptrdiff_t>(end_point),
+                    shard_points.get(d).begin());
+        }
+        gsl::at(block_logical_coords, shard) =
+            InterpolationTarget_detail::block_logical_coords<
+                InterpolationTargetTag>(cache, shard_points, temporal_id);
+      }
+      auto shard_coord_holders = element_logical_coordinates(
+          element_ids, gsl::at(block_logical_coords, shard));
+      if (shard_coord_holders.count(array_index) > 0) {
+        gsl::at(element_coord_holders, shard) =
+            std::move(shard_coord_holders.at(array_index));
+        has_points_in_element = true;
+      }
+    }
+
+    // A shard that has no valid points never receives data from any element,
+    // so the element that holds the first valid point of the target sends it
+    // an empty message to let it complete.
+    const auto has_valid_point = [](const BlockLogicalCoords& coords) {
+      return alg::any_of(coords,
+                         [](const auto& coord) { return coord.has_value(); });
+    };
+    bool has_first_valid_point = false;
+    if constexpr (number_of_shards > 1) {
+      const auto first_shard_with_valid_point =
+          alg::find_if(block_logical_coords, has_valid_point);
+      if (first_shard_with_valid_point != block_logical_coords.end()) {
+        const auto shard = static_cast<size_t>(std::distance(
+            block_logical_coords.begin(), first_shard_with_valid_point));
+        const auto first_valid_point = static_cast<size_t>(std::distance(
+            first_shard_with_valid_point->begin(),
+            alg::find_if(*first_shard_with_valid_point,
+                         [](const auto& coord) { return coord.has_value(); })));
+        has_first_valid_point =
+            gsl::at(element_coord_holders, shard).has_value() and
+            alg::found(gsl::at(element_coord_holders, shard)->offsets,
+                       first_valid_point);
+      }
+    }
+
+    if (not has_points_in_element and not has_first_valid_point) {
       // There are no target points in this element, so we don't need
       // to do anything.
       return;
@@ -124,8 +200,6 @@ class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
     // There are points in this element, so interpolate to them and
     // send the interpolated data to the target.  This is done
     // in several steps:
-    const auto& element_coord_holder = element_coord_holders.at(array_index);
-
     // 1. Get the list of variables
     Variables<typename InterpolationTargetTag::vars_to_interpolate_to_target>
         interp_vars(mesh.number_of_grid_points());
@@ -181,22 +255,42 @@ class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
                                     source_vars_input)...);
     }
 
-    // 2. Set up interpolator
-    intrp::Irregular<VolumeDim> interpolator(
-        mesh, element_coord_holder.element_logical_coords);
-
-    // 3. Interpolate and send interpolated data to target
+    // 2. Interpolate and send interpolated data to the target, or to each
+    // shard of the target.
+    using vars_type = Variables<
+        typename InterpolationTargetTag::vars_to_interpolate_to_target>;
     auto& receiver_proxy = Parallel::get_parallel_component<
         InterpolationTarget<Metavariables, InterpolationTargetTag>>(cache);
-    Parallel::simple_action<
-        Actions::InterpolationTargetVarsFromElement<InterpolationTargetTag>>(
-        receiver_proxy,
-        std::vector<Variables<
-            typename InterpolationTargetTag::vars_to_interpolate_to_target>>(
-            {interpolator.interpolate(interp_vars)}),
-        block_logical_coords,
-        std::vector<std::vector<size_t>>({element_coord_holder.offsets}),
-        temporal_id);
+    for (size_t shard = 0; shard < number_of_shards; ++shard) {
+      auto& element_coord_holder = gsl::at(element_coord_holders, shard);
+      std::vector<vars_type> interpolated_vars{};
+      std::vector<std::vector<size_t>> offsets{};
+      if (element_coord_holder.has_value()) {
+        const intrp::Irregular<VolumeDim> interpolator(
+            mesh, element_coord_holder->element_logical_coords);
+        interpolated_vars.push_back(interpolator.interpolate(interp_vars));
+        offsets.push_back(std::move(element_coord_holder->offsets));
+      } else if (has_first_valid_point and
+                 not has_valid_point(gsl::at(block_logical_coords, shard))) {
+        interpolated_vars.emplace_back(0);
+        offsets.emplace_back();
+      } else {
+        continue;
+      }
+      if constexpr (number_of_shards > 1) {
+        Parallel::simple_action<Actions::InterpolationTargetVarsFromElement<
+            InterpolationTargetTag>>(
+            receiver_proxy[shard], std::move(interpolated_vars),
+            std::move(gsl::at(block_logical_coords, shard)),
+            std::move(offsets), temporal_id);
+      } else {
+        Parallel::simple_action<Actions::InterpolationTargetVarsFromElement<
+            InterpolationTargetTag>>(
+            receiver_proxy, std::move(interpolated_vars),
+            std::move(gsl::at(block_logical_coords, shard)),
+            std::move(offsets), temporal_id);
+      }
+    }
   }
 
   template <typename ParallelComponent>
@@ -108,6 +108,32 @@ void operator|(
   pup(p, t);
 }
 
+/// \brief Holds the interpolated `Variables` of the shards of a sharded
+/// `InterpolationTarget` at a single `temporal_id`, as they are gathered on
+/// the first shard.
+///
+/// `TagList` is a `tmpl::list` of tags that go into the `Variables`.
+template <typename TagList>
+struct GatheredShards {
+  /// `vars.at(shard)` holds the `Variables` on all the points owned by
+  /// `shard`. Shards that have not yet sent their points have no entry.
+  std::unordered_map<size_t, Variables<TagList>> vars{};
+  /// `invalid_indices.at(shard)` holds the indices, relative to the first
+  /// point owned by `shard`, of the points that are outside the domain.
+  std::unordered_map<size_t, std::unordered_set<size_t>> invalid_indices{};
+};
+
+template <typename TagList>
+void pup(PUP::er& p, GatheredShards<TagList>& t) {  // NOLINT
+  p | t.vars;
+  p | t.invalid_indices;
+}
+
+template <typename TagList>
+void operator|(PUP::er& p, GatheredShards<TagList>& t) {  // NOLINT
+  pup(p, t);
+}
+
 /// Indexes a particular `Holder` in the `TaggedTuple` that is
 /// accessed from the `Interpolator`'s `DataBox` with tag
 /// `Tags::InterpolatedVarsHolders`.
@@ -3,9 +3,13 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <unordered_set>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
+#include "Parallel/Algorithms/AlgorithmArray.hpp"
 #include "Parallel/Algorithms/AlgorithmSingleton.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Local.hpp"
@@ -15,10 +19,13 @@
 #include "Parallel/Tags/ResourceInfo.hpp"
 #include "ParallelAlgorithms/Actions/TerminatePhase.hpp"
 #include "ParallelAlgorithms/Interpolation/Actions/InterpolationTargetSendPoints.hpp"
+#include "ParallelAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
 #include "ParallelAlgorithms/Interpolation/Protocols/InterpolationTargetTag.hpp"
 #include "Utilities/PrettyType.hpp"
 #include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
 #include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
 #include "Utilities/TypeTraits.hpp"
 
 /// \cond
@@ -257,6 +264,33 @@ namespace intrp {
 /// GlobalCache (one copy per node) since the points need be computed only
 /// once.
 ///
+/// ### Sharded InterpolationTargets
+///
+/// If the `InterpolationTargetTag` specifies
+/// `static constexpr size_t number_of_shards` greater than one, the
+/// InterpolationTarget is a chare array with one element per shard instead of
+/// a singleton, and the points of the target are split into
+/// `number_of_shards` contiguous ranges (see
+/// `InterpolationTarget_detail::shard_point_range`). This is only supported
+/// for non-sequential targets interpolated without the `Interpolator`
+/// ParallelComponent.
+///
+/// Elements send the interpolated data for each point directly to the shard
+/// that owns it, so each shard only receives, stores, and counts the data for
+/// its own points, and the memory and the number of messages per shard
+/// decrease with the number of shards. Once a shard has received the data for
+/// all its points:
+///
+/// - If the `post_interpolation_callback` specifies
+///   `static constexpr bool needs_all_points = false`, the shard calls the
+///   callback on its own points.
+/// - Otherwise, the shard sends its data to shard 0 with
+///   `Actions::InterpolationTargetGatherShards`, which calls the callback on
+///   all points once it has received the data of all shards.
+///
+/// The shards are distributed evenly over the processors that are not
+/// reserved for singletons.
+///
 template <class Metavariables, typename InterpolationTargetTag>
 struct InterpolationTarget {
   using interpolation_target_tag = InterpolationTargetTag;
@@ -266,7 +300,20 @@ struct InterpolationTarget {
   static std::string name() {
     return pretty_type::name<InterpolationTargetTag>();
   }
-  using chare_type = ::Parallel::Algorithms::Singleton;
+  static constexpr size_t number_of_shards =
+      InterpolationTarget_detail::number_of_shards<InterpolationTargetTag>;
+  static_assert(number_of_shards > 0,
+                "An InterpolationTarget needs at least one shard");
+  static_assert(
+      number_of_shards == 1 or
+          not InterpolationTargetTag::compute_target_points::is_sequential::
+              value,
+      "Only non-sequential InterpolationTargets can be sharded");
+  using chare_type =
+      tmpl::conditional_t<(number_of_shards > 1),
+                          ::Parallel::Algorithms::Array,
+                          ::Parallel::Algorithms::Singleton>;
+  using array_index = size_t;
   using const_global_cache_tags =
       Parallel::get_const_global_cache_tags_from_actions<tmpl::list<
           typename InterpolationTargetTag::compute_target_points,
@@ -290,12 +337,44 @@ struct InterpolationTarget {
                           InterpolationTargetTag>>>,
               Parallel::Actions::TerminatePhase>>>;
 
-  using initialization_tags =
-      tmpl::append<Parallel::get_initialization_tags<
-                       Parallel::get_initialization_actions_list<
-                           phase_dependent_action_list>>,
-                   tmpl::list<Parallel::Tags::SingletonInfo<InterpolationTarget<
-                       Metavariables, InterpolationTargetTag>>>>;
+  using initialization_tags = tmpl::append<
+      Parallel::get_initialization_tags<
+          Parallel::get_initialization_actions_list<
+              phase_dependent_action_list>>,
+      tmpl::conditional_t<
+          (number_of_shards > 1), tmpl::list<>,
+          tmpl::list<Parallel::Tags::SingletonInfo<
+              InterpolationTarget<Metavariables, InterpolationTargetTag>>>>>;
+
+  /// Used only for sharded InterpolationTargets: inserts the shards,
+  /// distributing them evenly over the processors not in `procs_to_ignore`.
+  static void allocate_array(
+      Parallel::CProxy_GlobalCache<Metavariables>& global_cache,
+      const tuples::tagged_tuple_from_typelist<initialization_tags>&
+          initialization_items,
+      const std::unordered_set<size_t>& procs_to_ignore = {}) {
+    auto& local_cache = *Parallel::local_branch(global_cache);
+    auto& array_proxy = Parallel::get_parallel_component<
+        InterpolationTarget<Metavariables, InterpolationTargetTag>>(
+        local_cache);
+    const auto number_of_procs = static_cast<size_t>(sys::number_of_procs());
+    std::vector<size_t> procs_to_use{};
+    procs_to_use.reserve(number_of_procs);
+    for (size_t proc = 0; proc < number_of_procs; ++proc) {
+      if (procs_to_ignore.count(proc) == 0) {
+        procs_to_use.push_back(proc);
+      }
+    }
+    if (procs_to_use.empty()) {
+      procs_to_use.push_back(0);
+    }
+    for (size_t shard = 0; shard < number_of_shards; ++shard) {
+      array_proxy[shard].insert(
+          global_cache, initialization_items,
+          procs_to_use[shard * procs_to_use.size() / number_of_shards]);
+    }
+    array_proxy.doneInserting();
+  }
 
   static void execute_next_phase(
       Parallel::Phase next_phase,
@@ -3,8 +3,12 @@
 
 #include "ParallelAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
 
+#include <cstddef>
+#include <utility>
+
 #include "DataStructures/LinkedMessageId.hpp"
 #include "Time/TimeStepId.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 
 namespace intrp::InterpolationTarget_detail {
 double get_temporal_id_value(const double time) { return time; }
@@ -21,4 +25,21 @@ double evaluate_temporal_id_for_expiration(const LinkedMessageId<double>& id) {
 double evaluate_temporal_id_for_expiration(const TimeStepId& time_id) {
   return time_id.step_time().value();
 }
+
+std::pair<size_t, size_t> shard_point_range(const size_t number_of_points,
+                                            const size_t number_of_shards,
+                                            const size_t shard) {
+  ASSERT(shard < number_of_shards, "Shard " << shard << " does not exist for "
+                                            << number_of_shards << " shards");
+  return {shard * number_of_points / number_of_shards,
+          (shard + 1) * number_of_points / number_of_shards};
+}
+
+size_t shard_of_point(const size_t number_of_points,
+                      const size_t number_of_shards, const size_t point) {
+  ASSERT(point < number_of_points, "Point " << point << " does not exist for "
+                                            << number_of_points << " points");
+  // The largest shard whose range starts at or before point
+  return ((point + 1) * number_of_shards - 1) / number_of_points;
+}
 }  // namespace intrp::InterpolationTarget_detail
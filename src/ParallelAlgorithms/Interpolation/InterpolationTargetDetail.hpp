@@ -12,6 +12,7 @@
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/IdPair.hpp"
 #include "DataStructures/Tensor/Metafunctions.hpp"
+#include "DataStructures/Variables.hpp"
 #include "DataStructures/VariablesTag.hpp"
 #include "Domain/BlockLogicalCoordinates.hpp"
 #include "Domain/Tags.hpp"
@@ -20,12 +21,14 @@
 #include "Parallel/Invoke.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Utilities/Algorithm.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 #include "Utilities/TypeTraits.hpp"
+#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
 #include "Utilities/TypeTraits/CreateHasStaticMemberVariable.hpp"
 #include "Utilities/TypeTraits/CreateHasTypeAlias.hpp"
 
@@ -102,6 +105,40 @@ auto apply_callback(
   return true;
 }
 
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(number_of_shards)
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(needs_all_points)
+
+/// The number of shards over which the points of the InterpolationTarget
+/// are distributed, given by the optional `number_of_shards` of the
+/// `InterpolationTargetTag` (default 1, i.e. no sharding).
+template <typename InterpolationTargetTag>
+constexpr size_t number_of_shards =
+    get_number_of_shards_or_default_v<InterpolationTargetTag, size_t{1}>;
+
+/// True if the InterpolationTarget is sharded and its
+/// `post_interpolation_callback` needs all the points of the target, so the
+/// shards gather their points on the first shard, which then calls the
+/// callback.  Callbacks that can be called on any subset of the points
+/// declare `static constexpr bool needs_all_points = false` and are called by
+/// each shard on its own points.
+template <typename InterpolationTargetTag>
+constexpr bool gather_shards =
+    number_of_shards<InterpolationTargetTag> > 1 and
+    get_needs_all_points_or_default_v<
+        typename InterpolationTargetTag::post_interpolation_callback, true>;
+
+/// The half-open range of the indices of the points of a target with
+/// `number_of_points` points that are owned by `shard`.  The points are
+/// split into contiguous ranges whose sizes differ by at most one.
+std::pair<size_t, size_t> shard_point_range(size_t number_of_points,
+                                            size_t number_of_shards,
+                                            size_t shard);
+
+/// The shard owning the point with index `point` of a target with
+/// `number_of_points` points, consistent with `shard_point_range`.
+size_t shard_of_point(size_t number_of_points, size_t number_of_shards,
+                      size_t point);
+
 CREATE_HAS_STATIC_MEMBER_VARIABLE(fill_invalid_points_with)
 CREATE_HAS_STATIC_MEMBER_VARIABLE_V(fill_invalid_points_with)
 
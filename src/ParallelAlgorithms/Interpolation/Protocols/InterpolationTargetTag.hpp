@@ -76,6 +76,11 @@ constexpr bool if_alias_exists_assert_conforms_to_v =
  *   be interpolating to the interpolation target. Only needed when *not* using
  *   the Interpolator ParallelComponent.
  *
+ * - a `static constexpr size_t number_of_shards` greater than one, to
+ *   distribute the points over that many elements of a chare array (see
+ *   the documentation of intrp::InterpolationTarget). Only supported when
+ *   *not* using the Interpolator ParallelComponent.
+ *
  * An example of a struct that conforms to this protocol is
  *
  * \snippet Helpers/ParallelAlgorithms/Interpolation/Examples.hpp InterpolationTargetTag
@@ -101,6 +101,12 @@ struct has_signature_3<
  * `apply` function must check for invalid points, and should typically exit
  * with an error message if it finds any.
  *
+ * A struct conforming to this protocol can also have an optional `static
+ * constexpr bool needs_all_points`. If it is `false`, then each shard of a
+ * sharded InterpolationTarget calls `apply` on only the points that it owns,
+ * instead of gathering all the points on one shard first. The default is
+ * `true`.
+ *
  * Here is an example of a class that conforms to this protocols:
  *
  * \snippet Helpers/ParallelAlgorithms/Interpolation/Examples.hpp PostInterpolationCallback
@@ -88,6 +88,17 @@ struct InterpolatedVars : db::SimpleTag {
           typename InterpolationTargetTag::vars_to_interpolate_to_target>>;
 };
 
+/// Holds the interpolated variables that the shards of a sharded
+/// InterpolationTarget have sent to the first shard, for the
+/// `temporal_id`s at which not all shards have sent their points yet.
+template <typename InterpolationTargetTag, typename TemporalId>
+struct GatheredShards : db::SimpleTag {
+  using type = std::unordered_map<
+      TemporalId,
+      Vars::GatheredShards<
+          typename InterpolationTargetTag::vars_to_interpolate_to_target>>;
+};
+
 template <typename InterpolationTargetTag>
 struct VarsToInterpolateToTarget {
   using type =
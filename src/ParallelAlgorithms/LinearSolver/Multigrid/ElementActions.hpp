@@ -14,6 +14,7 @@
 #include "DataStructures/FixedHashMap.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "Domain/Structure/ChildSize.hpp"
+#include "Domain/Structure/CreateInitialMesh.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "IO/Logging/Tags.hpp"
 #include "IO/Observer/Tags.hpp"
@@ -51,7 +52,8 @@ template <size_t Dim, typename FieldsTag, typename OptionsGroup,
           typename SourceTag>
 struct InitializeElement {
   using initialization_tags = tmpl::list<Tags::ChildrenRefinementLevels<Dim>,
-                                         Tags::ParentRefinementLevels<Dim>>;
+                                         Tags::ParentRefinementLevels<Dim>,
+                                         Tags::ParentExtents<Dim>>;
   using simple_tags =
       tmpl::list<Tags::ParentId<Dim>, Tags::ChildIds<Dim>,
                  Tags::ParentMesh<Dim>,
@@ -62,6 +64,8 @@ struct InitializeElement {
   using compute_tags = tmpl::list<>;
   using const_global_cache_tags =
       tmpl::list<Tags::MaxLevels<OptionsGroup>,
+                 Tags::PCoarseningMinPoints<OptionsGroup>,
+                 Tags::MinElementsPerProc<OptionsGroup>,
                  Tags::OutputVolumeData<OptionsGroup>>;
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
@@ -78,9 +82,11 @@ struct InitializeElement {
 
     const size_t multigrid_level = element_id.grid_index();
     const bool is_finest_grid = multigrid_level == 0;
+    const auto& parent_extents = db::get<Tags::ParentExtents<Dim>>(box);
     const bool is_coarsest_grid =
         db::get<domain::Tags::InitialRefinementLevels<Dim>>(box) ==
-        db::get<Tags::ParentRefinementLevels<Dim>>(box);
+            db::get<Tags::ParentRefinementLevels<Dim>>(box) and
+        db::get<domain::Tags::InitialExtents<Dim>>(box) == parent_extents;
 
     std::optional<ElementId<Dim>> parent_id =
         is_coarsest_grid ? std::nullopt
@@ -89,9 +95,14 @@ struct InitializeElement {
         element_id, db::get<Tags::ChildrenRefinementLevels<Dim>>(
                         box)[element_id.block_id()]);
 
+    // The parent mesh has fewer grid points than this element's mesh if the
+    // parent grid is p-coarsened
     const auto& mesh = db::get<domain::Tags::Mesh<Dim>>(box);
     std::optional<Mesh<Dim>> parent_mesh =
-        is_coarsest_grid ? std::nullopt : std::make_optional(mesh);
+        is_coarsest_grid
+            ? std::nullopt
+            : std::make_optional(domain::Initialization::create_initial_mesh(
+                  parent_extents, *parent_id, mesh.quadrature(0)));
 
     auto observation_key_level = std::make_optional(
         is_finest_grid ? std::string{""}
@@ -23,6 +23,7 @@
 #include "ParallelAlgorithms/LinearSolver/Multigrid/Hierarchy.hpp"
 #include "ParallelAlgorithms/LinearSolver/Multigrid/Tags.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/PrettyType.hpp"
 #include "Utilities/ProtocolHelpers.hpp"
 #include "Utilities/System/ParallelInfo.hpp"
@@ -41,7 +42,12 @@ namespace LinearSolver::multigrid {
  * the initial set of element IDs in the domain. This is taken as the finest
  * grid in the multigrid hierarchy. Coarser grids are determined by successively
  * applying `LinearSolver::multigrid::coarsen`, up to
- * `LinearSolver::multigrid::Tags::MaxLevels` grids.
+ * `LinearSolver::multigrid::Tags::MaxLevels` grids. If
+ * `LinearSolver::multigrid::Tags::PCoarseningMinPoints` is set, the coarser
+ * grids also have their `domain::Tags::InitialExtents` reduced by
+ * `LinearSolver::multigrid::p_coarsen` in all dimensions that can't be
+ * h-coarsened any further, so the hierarchy continues with p-multigrid levels
+ * once the blocks are fully h-coarsened.
  *
  * Array elements are created for all element IDs on all grids, meaning they all
  * share the same parallel component, action list etc. Elements are connected to
@@ -65,7 +71,13 @@ namespace LinearSolver::multigrid {
  * The elements are distributed on processors using the
  * `domain::BlockZCurveProcDistribution` for every grid independently. An
  * unordered set of `size_t`s can be passed to the `apply` function which
- * represents physical processors to avoid placing elements on.
+ * represents physical processors to avoid placing elements on. If
+ * `LinearSolver::multigrid::Tags::MinElementsPerProc` is set, grids with few
+ * elements are distributed on only the first few of the available processors
+ * so that every processor holds at least this many elements. This
+ * agglomerates the coarse grids onto a single node or a small subset of
+ * processors. The restriction and prolongation between grids address elements
+ * by their IDs, so they work independently of where the elements are placed.
  */
 template <size_t Dim, typename OptionsGroup>
 struct ElementsAllocator
@@ -75,6 +87,7 @@ struct ElementsAllocator
       tmpl::list<domain::Tags::InitialRefinementLevels<Dim>,
                  Tags::ChildrenRefinementLevels<Dim>,
                  Tags::ParentRefinementLevels<Dim>,
+                 domain::Tags::InitialExtents<Dim>, Tags::ParentExtents<Dim>,
                  Parallel::Tags::Section<ElementArray, Tags::MultigridLevel>,
                  Parallel::Tags::Section<ElementArray, Tags::IsFinestGrid>>;
 
@@ -101,6 +114,9 @@ struct ElementsAllocator
         get<Tags::ChildrenRefinementLevels<Dim>>(initialization_items);
     auto& parent_refinement_levels =
         get<Tags::ParentRefinementLevels<Dim>>(initialization_items);
+    auto& initial_extents =
+        get<domain::Tags::InitialExtents<Dim>>(initialization_items);
+    auto& parent_extents = get<Tags::ParentExtents<Dim>>(initialization_items);
     std::optional<size_t> max_levels =
         get<Tags::MaxLevels<OptionsGroup>>(local_cache);
     if (max_levels == 0) {
@@ -109,6 +125,22 @@ struct ElementsAllocator
           "valid value. Set the option to '1' to effectively disable "
           "multigrid.");
     }
+    const std::optional<size_t>& min_elements_per_proc =
+        get<Tags::MinElementsPerProc<OptionsGroup>>(local_cache);
+    if (min_elements_per_proc == 0) {
+      ERROR_NO_TRACE(
+          "The 'MinElementsPerProc' option must be at least '1'. Set it to "
+          "'None' to distribute all multigrid levels on all available procs.");
+    }
+    const std::optional<size_t>& p_coarsening_min_points =
+        get<Tags::PCoarseningMinPoints<OptionsGroup>>(local_cache);
+    if (p_coarsening_min_points.has_value() and
+        *p_coarsening_min_points < 2) {
+      ERROR_NO_TRACE(
+          "The 'PCoarseningMinPoints' option must be at least '2', because "
+          "meshes with a single grid point per dimension are not supported. "
+          "Set it to 'None' to disable p-coarsening.");
+    }
     const size_t num_iterations =
         get<Convergence::Tags::Iterations<OptionsGroup>>(local_cache);
     if (UNLIKELY(num_iterations == 0)) {
@@ -122,10 +154,17 @@ struct ElementsAllocator
       // Store the current grid as child grid before coarsening it
       children_refinement_levels = initial_refinement_levels;
       initial_refinement_levels = parent_refinement_levels;
-      // Construct coarsened (parent) grid
+      initial_extents = parent_extents;
+      // Construct coarsened (parent) grid. Dimensions that are already fully
+      // h-coarsened get p-coarsened instead, if enabled.
       if (not max_levels.has_value() or multigrid_level < *max_levels - 1) {
         parent_refinement_levels =
             LinearSolver::multigrid::coarsen(initial_refinement_levels);
+        if (p_coarsening_min_points.has_value()) {
+          parent_extents = LinearSolver::multigrid::p_coarsen(
+              initial_extents, initial_refinement_levels,
+              *p_coarsening_min_points);
+        }
       }
       // Create element IDs for all elements on this level
       std::vector<ElementId<Dim>> element_ids{};
@@ -162,9 +201,15 @@ struct ElementsAllocator
                               array_indices.data(), array_indices.size())})
               : std::nullopt;
       // Create the elements for this refinement level and distribute them among
-      // processors
-      const size_t num_of_procs_to_use =
+      // processors. Grids with few elements are agglomerated onto fewer
+      // processors, if requested.
+      size_t num_of_procs_to_use =
           static_cast<size_t>(sys::number_of_procs()) - procs_to_ignore.size();
+      if (min_elements_per_proc.has_value()) {
+        num_of_procs_to_use = std::clamp(
+            element_ids.size() / *min_elements_per_proc, 1_st,
+            num_of_procs_to_use);
+      }
       const domain::BlockZCurveProcDistribution<Dim> element_distribution{
           num_of_procs_to_use, initial_refinement_levels, procs_to_ignore};
       for (const auto& element_id : element_ids) {
@@ -174,12 +219,13 @@ struct ElementsAllocator
             .insert(global_cache, initialization_items, target_proc);
       }
       Parallel::printf(
-          "%s level %zu has %zu elements in %zu blocks distributed on %d "
+          "%s level %zu has %zu elements in %zu blocks distributed on %zu "
           "procs.\n",
           pretty_type::name<OptionsGroup>(), multigrid_level,
           element_ids.size(), domain.blocks().size(), num_of_procs_to_use);
       ++multigrid_level;
-    } while (initial_refinement_levels != parent_refinement_levels);
+    } while (initial_refinement_levels != parent_refinement_levels or
+             initial_extents != parent_extents);
     element_array.doneInserting();
   }
 };
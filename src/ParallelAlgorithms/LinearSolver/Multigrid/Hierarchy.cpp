@@ -3,6 +3,7 @@
 
 #include "ParallelAlgorithms/LinearSolver/Multigrid/Hierarchy.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <unordered_set>
@@ -31,6 +32,34 @@ std::vector<std::array<size_t, Dim>> coarsen(
   return initial_refinement_levels;
 }
 
+template <size_t Dim>
+std::vector<std::array<size_t, Dim>> p_coarsen(
+    std::vector<std::array<size_t, Dim>> initial_extents,
+    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+    const size_t min_num_points) {
+  ASSERT(initial_extents.size() == initial_refinement_levels.size(),
+         "Expected initial extents and refinement levels for the same number "
+         "of blocks, but got "
+             << initial_extents.size() << " and "
+             << initial_refinement_levels.size() << ".");
+  ASSERT(min_num_points >= 2,
+         "Can't p-coarsen to fewer than 2 grid points per dimension, but "
+         "requested at least "
+             << min_num_points << " grid points.");
+  for (size_t block_id = 0; block_id < initial_extents.size(); ++block_id) {
+    for (size_t d = 0; d < Dim; ++d) {
+      if (gsl::at(initial_refinement_levels[block_id], d) > 0) {
+        continue;
+      }
+      auto& num_points = gsl::at(initial_extents[block_id], d);
+      if (num_points > min_num_points) {
+        num_points = std::max((num_points + 1) / 2, min_num_points);
+      }
+    }
+  }
+  return initial_extents;
+}
+
 template <size_t Dim>
 ElementId<Dim> parent_id(const ElementId<Dim>& child_id) {
   std::array<SegmentId, Dim> parent_segment_ids = child_id.segment_ids();
@@ -162,6 +191,11 @@ std::unordered_set<ElementId<3>> child_ids<3>(
 #define INSTANTIATE(r, data)                                                 \
   template std::vector<std::array<size_t, DIM(data)>> coarsen(               \
       std::vector<std::array<size_t, DIM(data)>> initial_refinement_levels); \
+  template std::vector<std::array<size_t, DIM(data)>> p_coarsen(             \
+      std::vector<std::array<size_t, DIM(data)>> initial_extents,            \
+      const std::vector<std::array<size_t, DIM(data)>>&                      \
+          initial_refinement_levels,                                         \
+      size_t min_num_points);                                                \
   template ElementId<DIM(data)> parent_id(const ElementId<DIM(data)>& child_id);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
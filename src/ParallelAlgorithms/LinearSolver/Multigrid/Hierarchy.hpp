@@ -35,6 +35,36 @@ template <size_t Dim>
 std::vector<std::array<size_t, Dim>> coarsen(
     std::vector<std::array<size_t, Dim>> initial_refinement_levels);
 
+/*!
+ * \brief Reduce the number of grid points per dimension of all blocks in the
+ * domain ("p-coarsening")
+ *
+ * Only dimensions that can't be h-coarsened any further, i.e. dimensions with
+ * refinement level zero, are p-coarsened. This means `coarsen` and
+ * `p_coarsen` can be applied to the same grid to construct the next-coarser
+ * grid, and the resulting hierarchy first merges elements and then reduces
+ * their polynomial order once the blocks are fully h-coarsened. The number of
+ * grid points is halved (rounding up), but not reduced below
+ * `min_num_points`. Dimensions that already have `min_num_points` grid points
+ * or fewer are left unchanged, so if the return value equals the
+ * `initial_extents` the entire domain is fully p-coarsened.
+ *
+ * \tparam Dim The spatial dimension of the domain
+ * \param initial_extents The number of grid points in each block of the domain
+ * and in every dimension.
+ * \param initial_refinement_levels The refinement level in each block of the
+ * domain and in every dimension. These are the refinement levels of the grid
+ * that is being coarsened, not the refinement levels of the coarsened grid.
+ * \param min_num_points The number of grid points per dimension below which
+ * the extents are not reduced. Must be at least 2.
+ * \return std::vector<std::array<size_t, Dim>> The coarsened extents
+ */
+template <size_t Dim>
+std::vector<std::array<size_t, Dim>> p_coarsen(
+    std::vector<std::array<size_t, Dim>> initial_extents,
+    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+    size_t min_num_points);
+
 /*!
  * \brief The element covering the `child_id` on the coarser grid.
  *
@@ -45,14 +45,17 @@ struct VcycleUpLabel {};
  *
  * \par Grid hierarchy
  * This geometric multigrid solver relies on a strategy to coarsen the
- * computational grid in a way that removes small-scale modes. We currently
- * h-coarsen the domain, meaning that we create multigrid levels by successively
- * combining two elements into one along every dimension of the grid. We only
- * p-coarsen the grid in the sense that we choose the smaller of the two
- * polynomial degrees when combining elements. This strategy follows
- * \cite Vincent2019qpd. See `LinearSolver::multigrid::ElementsAllocator` and
- * `LinearSolver::multigrid::coarsen` for the code that creates the multigrid
- * hierarchy.
+ * computational grid in a way that removes small-scale modes. We h-coarsen the
+ * domain, meaning that we create multigrid levels by successively combining two
+ * elements into one along every dimension of the grid. When combining elements
+ * we choose the smaller of the two polynomial degrees. This strategy follows
+ * \cite Vincent2019qpd. Once the elements can't be combined any further along a
+ * dimension, the grid can optionally be p-coarsened along that dimension by
+ * reducing the number of grid points per element (see
+ * `LinearSolver::multigrid::Tags::PCoarseningMinPoints`). See
+ * `LinearSolver::multigrid::ElementsAllocator`,
+ * `LinearSolver::multigrid::coarsen` and `LinearSolver::multigrid::p_coarsen`
+ * for the code that creates the multigrid hierarchy.
  *
  * \par Inter-mesh operators
  * The algorithm relies on operations that project data between grids. Residuals
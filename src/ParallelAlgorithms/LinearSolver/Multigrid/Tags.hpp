@@ -35,6 +35,29 @@ struct MaxLevels {
   using group = OptionsGroup;
 };
 
+template <typename OptionsGroup>
+struct PCoarseningMinPoints {
+  using type = Options::Auto<size_t, Options::AutoLabel::None>;
+  static constexpr Options::String help =
+      "Reduce the number of grid points per dimension on coarser grids once "
+      "the elements can't be merged any further (p-multigrid), down to this "
+      "minimum number of grid points (at least 2). Set to 'None' to only "
+      "coarsen by merging elements (h-multigrid).";
+  using group = OptionsGroup;
+};
+
+template <typename OptionsGroup>
+struct MinElementsPerProc {
+  using type = Options::Auto<size_t, Options::AutoLabel::None>;
+  static constexpr Options::String help =
+      "Distribute each multigrid level on at most as many procs as it has "
+      "elements divided by this number. Coarse levels with few elements are "
+      "thereby agglomerated onto a small set of procs, so they are less "
+      "dominated by communication latency. Set to 'None' to distribute all "
+      "levels on all available procs.";
+  using group = OptionsGroup;
+};
+
 template <typename OptionsGroup>
 struct OutputVolumeData {
   using type = bool;
@@ -103,6 +126,19 @@ struct ParentRefinementLevels : db::SimpleTag {
   static constexpr auto create_from_options = base::create_from_options;
 };
 
+/// Initial number of grid points of the next-coarser (parent) grid
+template <size_t Dim>
+struct ParentExtents : db::SimpleTag {
+ private:
+  using base = domain::Tags::InitialExtents<Dim>;
+
+ public:
+  using type = typename base::type;
+  static constexpr bool pass_metavariables = base::pass_metavariables;
+  using option_tags = typename base::option_tags;
+  static constexpr auto create_from_options = base::create_from_options;
+};
+
 /// Maximum number of multigrid levels that will be created. A value of '1'
 /// effectively disables the multigrid, and `std::nullopt` means the number
 /// of multigrid levels is not capped.
@@ -117,6 +153,37 @@ struct MaxLevels : db::SimpleTag {
   }
 };
 
+/// Minimum number of grid points per dimension that coarser grids are reduced
+/// to once the elements can't be merged any further (see
+/// `LinearSolver::multigrid::p_coarsen`). A value of `std::nullopt` disables
+/// p-coarsening.
+template <typename OptionsGroup>
+struct PCoarseningMinPoints : db::SimpleTag {
+  using type = std::optional<size_t>;
+  static constexpr bool pass_metavariables = false;
+  using option_tags =
+      tmpl::list<OptionTags::PCoarseningMinPoints<OptionsGroup>>;
+  static type create_from_options(const type value) { return value; };
+  static std::string name() {
+    return "PCoarseningMinPoints(" + pretty_type::name<OptionsGroup>() + ")";
+  }
+};
+
+/// Minimum number of elements per proc when distributing a multigrid level.
+/// Levels with fewer elements than procs times this number are agglomerated
+/// onto fewer procs. A value of `std::nullopt` means all levels are distributed
+/// on all available procs.
+template <typename OptionsGroup>
+struct MinElementsPerProc : db::SimpleTag {
+  using type = std::optional<size_t>;
+  static constexpr bool pass_metavariables = false;
+  using option_tags = tmpl::list<OptionTags::MinElementsPerProc<OptionsGroup>>;
+  static type create_from_options(const type value) { return value; };
+  static std::string name() {
+    return "MinElementsPerProc(" + pretty_type::name<OptionsGroup>() + ")";
+  }
+};
+
 /// Whether or not volume data should be recorded for debugging purposes
 template <typename OptionsGroup>
 struct OutputVolumeData : db::SimpleTag {
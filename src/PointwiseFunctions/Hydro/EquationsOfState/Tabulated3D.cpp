@@ -0,0 +1,566 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "PointwiseFunctions/Hydro/EquationsOfState/Tabulated3D.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/EosTable.hpp"
+#include "IO/H5/File.hpp"
+#include "Utilities/ContainerHelpers.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/ErrorHandling/ExpectsAndEnsures.hpp"
+#include "Utilities/ForceInline.hpp"
+#include "Utilities/MakeWithValue.hpp"
+
+namespace EquationsOfState {
+namespace detail {
+// The interpolation data of a `Tabulated3D` equation of state, which is shared
+// between all equations of state using the same table.
+struct Tabulated3DTable {
+  // The quantities stored for each point of the table, in order.
+  static constexpr size_t log_pressure = 0;
+  static constexpr size_t log_shifted_energy = 1;
+  static constexpr size_t sound_speed_squared = 2;
+  static constexpr size_t number_of_quantities = 3;
+
+  // Rest mass density, temperature, and electron fraction
+  std::array<std::array<double, 2>, 3> bounds{};
+  std::array<size_t, 3> number_of_points{};
+  std::array<bool, 3> uses_log_spacing{};
+  // The interpolation coordinate of the first point and the inverse of the
+  // spacing between the points in each dimension.
+  std::array<double, 3> lower_coordinate{};
+  std::array<double, 3> inverse_spacing{};
+  // Added to the specific internal energy so that its logarithm is defined.
+  double energy_shift = 0.0;
+  // The smallest value of epsilon + p / rho at the points of the table.
+  double minimum_enthalpy_minus_one = 0.0;
+  // The quantities are stored next to each other for each point, and the
+  // points are stored with the electron fraction varying fastest.
+  std::vector<double> data{};
+
+  // The interpolation coordinate of `value` in `dimension`, scaled so that the
+  // points of the table are at the integers.
+  template <typename DataType>
+  DataType scaled_coordinate(const size_t dimension,
+                             const DataType& value) const {
+    using std::log;
+    if (uses_log_spacing[dimension]) {
+      return (log(value) - lower_coordinate[dimension]) *
+             inverse_spacing[dimension];
+    }
+    return (value - lower_coordinate[dimension]) * inverse_spacing[dimension];
+  }
+
+  // The inverse of `scaled_coordinate`.
+  template <typename DataType>
+  DataType value_from_scaled_coordinate(const size_t dimension,
+                                        const DataType& coordinate) const {
+    using std::exp;
+    if (uses_log_spacing[dimension]) {
+      return exp(coordinate / inverse_spacing[dimension] +
+                 lower_coordinate[dimension]);
+    }
+    return coordinate / inverse_spacing[dimension] +
+           lower_coordinate[dimension];
+  }
+
+  SPECTRE_ALWAYS_INLINE size_t offset(const size_t density_index,
+                                      const size_t temperature_index,
+                                      const size_t electron_fraction_index,
+                                      const size_t quantity) const {
+    return ((density_index * number_of_points[1] + temperature_index) *
+                number_of_points[2] +
+            electron_fraction_index) *
+               number_of_quantities +
+           quantity;
+  }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) {
+    p | bounds;
+    p | number_of_points;
+    p | uses_log_spacing;
+    p | lower_coordinate;
+    p | inverse_spacing;
+    p | energy_shift;
+    p | minimum_enthalpy_minus_one;
+    p | data;
+  }
+};
+}  // namespace detail
+
+namespace {
+using Table = detail::Tabulated3DTable;
+
+// The cell containing the scaled coordinate `x` and the weight of the upper
+// point of the cell, clamping `x` to the table. Infinite coordinates (e.g. the
+// logarithm of a vanishing density) are clamped as well, but NaN coordinates
+// (e.g. the logarithm of a negative density) can't be located in the table.
+struct CellAndWeight {
+  size_t cell;
+  double weight;
+};
+
+SPECTRE_ALWAYS_INLINE CellAndWeight
+cell_and_weight(const double x, const size_t number_of_points) {
+  if (UNLIKELY(std::isnan(x))) {
+    ERROR(
+        "Can't interpolate the Tabulated3D equation of state at a NaN table "
+        "coordinate. This happens for NaN or negative values of "
+        "log-spaced table quantities such as the rest mass density.");
+  }
+  const double clamped_x =
+      std::clamp(x, 0.0, static_cast<double>(number_of_points - 1));
+  const size_t cell =
+      std::min(static_cast<size_t>(clamped_x), number_of_points - 2);
+  return {cell, clamped_x - static_cast<double>(cell)};
+}
+
+// Bilinear interpolation in the density and the electron fraction of
+// `quantity` at the temperature point `temperature_index`.
+SPECTRE_ALWAYS_INLINE double interpolate_at_temperature_point(
+    const Table& table, const CellAndWeight& density,
+    const size_t temperature_index, const CellAndWeight& electron_fraction,
+    const size_t quantity) {
+  const double* const lower_density = &table.data[table.offset(
+      density.cell, temperature_index, electron_fraction.cell, quantity)];
+  const double* const upper_density = &table.data[table.offset(
+      density.cell + 1, temperature_index, electron_fraction.cell, quantity)];
+  constexpr size_t ye_stride = Table::number_of_quantities;
+  const double lower_density_value =
+      lower_density[0] +
+      electron_fraction.weight * (lower_density[ye_stride] - lower_density[0]);
+  const double upper_density_value =
+      upper_density[0] +
+      electron_fraction.weight * (upper_density[ye_stride] - upper_density[0]);
+  return lower_density_value +
+         density.weight * (upper_density_value - lower_density_value);
+}
+
+SPECTRE_ALWAYS_INLINE double interpolate_point(
+    const Table& table, const double density_coordinate,
+    const double temperature_coordinate, const double ye_coordinate,
+    const size_t quantity) {
+  const CellAndWeight density =
+      cell_and_weight(density_coordinate, table.number_of_points[0]);
+  const CellAndWeight temperature =
+      cell_and_weight(temperature_coordinate, table.number_of_points[1]);
+  const CellAndWeight electron_fraction =
+      cell_and_weight(ye_coordinate, table.number_of_points[2]);
+  const double lower_temperature_value = interpolate_at_temperature_point(
+      table, density, temperature.cell, electron_fraction, quantity);
+  const double upper_temperature_value = interpolate_at_temperature_point(
+      table, density, temperature.cell + 1, electron_fraction, quantity);
+  return lower_temperature_value +
+         temperature.weight *
+             (upper_temperature_value - lower_temperature_value);
+}
+
+// The scaled temperature coordinate at which the interpolated logarithm of the
+// shifted specific internal energy is `log_shifted_energy`.
+double invert_energy_at_point(const Table& table,
+                              const double density_coordinate,
+                              const double log_shifted_energy,
+                              const double ye_coordinate) {
+  const CellAndWeight density =
+      cell_and_weight(density_coordinate, table.number_of_points[0]);
+  const CellAndWeight electron_fraction =
+      cell_and_weight(ye_coordinate, table.number_of_points[2]);
+  const auto energy_at = [&table, &density,
+                          &electron_fraction](const size_t temperature_index) {
+    return interpolate_at_temperature_point(table, density, temperature_index,
+                                            electron_fraction,
+                                            Table::log_shifted_energy);
+  };
+  size_t lower_index = 0;
+  size_t upper_index = table.number_of_points[1] - 1;
+  double lower_energy = energy_at(lower_index);
+  double upper_energy = energy_at(upper_index);
+  if (log_shifted_energy <= lower_energy) {
+    return 0.0;
+  }
+  if (log_shifted_energy >= upper_energy) {
+    return static_cast<double>(upper_index);
+  }
+  while (upper_index - lower_index > 1) {
+    const size_t middle_index = (lower_index + upper_index) / 2;
+    const double middle_energy = energy_at(middle_index);
+    if (middle_energy <= log_shifted_energy) {
+      lower_index = middle_index;
+      lower_energy = middle_energy;
+    } else {
+      upper_index = middle_index;
+      upper_energy = middle_energy;
+    }
+  }
+  // The interpolant is linear in the temperature coordinate within the cell.
+  return static_cast<double>(lower_index) +
+         (log_shifted_energy - lower_energy) / (upper_energy - lower_energy);
+}
+
+template <typename DataType>
+DataType interpolate(const Table& table, const DataType& density_coordinate,
+                     const DataType& temperature_coordinate,
+                     const DataType& ye_coordinate, const size_t quantity) {
+  auto result = make_with_value<DataType>(density_coordinate, 0.0);
+  for (size_t i = 0; i < get_size(result); ++i) {
+    get_element(result, i) = interpolate_point(
+        table, get_element(density_coordinate, i),
+        get_element(temperature_coordinate, i), get_element(ye_coordinate, i),
+        quantity);
+  }
+  return result;
+}
+
+template <typename DataType>
+DataType temperature_coordinate_from_energy(
+    const Table& table, const DataType& density_coordinate,
+    const DataType& specific_internal_energy, const DataType& ye_coordinate) {
+  // Energies below the table are clamped to the lowest temperature, so the
+  // argument of the logarithm is kept positive.
+  const double smallest_shifted_energy = std::numeric_limits<double>::min();
+  auto result = make_with_value<DataType>(density_coordinate, 0.0);
+  for (size_t i = 0; i < get_size(result); ++i) {
+    get_element(result, i) = invert_energy_at_point(
+        table, get_element(density_coordinate, i),
+        std::log(std::max(
+            get_element(specific_internal_energy, i) + table.energy_shift,
+            smallest_shifted_energy)),
+        get_element(ye_coordinate, i));
+  }
+  return result;
+}
+
+std::shared_ptr<const Table> make_table(
+    const std::array<std::array<double, 2>, 3>& bounds,
+    const std::array<size_t, 3>& number_of_points,
+    const std::array<bool, 3>& uses_log_spacing, const DataVector& pressure,
+    const DataVector& specific_internal_energy,
+    const DataVector& sound_speed_squared) {
+  auto table = std::make_shared<Table>();
+  table->bounds = bounds;
+  table->number_of_points = number_of_points;
+  table->uses_log_spacing = uses_log_spacing;
+  for (size_t d = 0; d < 3; ++d) {
+    if (number_of_points[d] < 2) {
+      ERROR("Tabulated3D requires at least two points in each dimension, but "
+            "dimension "
+            << d << " has " << number_of_points[d] << " points.");
+    }
+    if (not(bounds[d][0] < bounds[d][1])) {
+      ERROR("The bounds of dimension " << d << " of the table are not "
+                                       << "increasing: (" << bounds[d][0]
+                                       << ", " << bounds[d][1] << ")");
+    }
+    if (uses_log_spacing[d] and bounds[d][0] <= 0.0) {
+      ERROR("Dimension " << d << " of the table is log spaced but its lower "
+                         << "bound " << bounds[d][0] << " is not positive.");
+    }
+    const double lower =
+        uses_log_spacing[d] ? std::log(bounds[d][0]) : bounds[d][0];
+    const double upper =
+        uses_log_spacing[d] ? std::log(bounds[d][1]) : bounds[d][1];
+    table->lower_coordinate[d] = lower;
+    table->inverse_spacing[d] =
+        static_cast<double>(number_of_points[d] - 1) / (upper - lower);
+  }
+  const size_t table_size =
+      number_of_points[0] * number_of_points[1] * number_of_points[2];
+  if (pressure.size() != table_size or
+      specific_internal_energy.size() != table_size or
+      sound_speed_squared.size() != table_size) {
+    ERROR("The tabulated quantities must have "
+          << table_size << " points, but the pressure, specific internal "
+          << "energy, and sound speed squared have " << pressure.size() << ", "
+          << specific_internal_energy.size() << ", and "
+          << sound_speed_squared.size() << " points.");
+  }
+  if (min(pressure) <= 0.0) {
+    ERROR("Tabulated3D requires a positive pressure, but the smallest "
+          "tabulated pressure is "
+          << min(pressure));
+  }
+  const double min_energy = min(specific_internal_energy);
+  const double max_energy = max(specific_internal_energy);
+  // Shift the energy so that it is positive with a margin that is small
+  // compared to the range of the table.
+  table->energy_shift =
+      min_energy > 0.0 ? 0.0
+                       : 1.0e-10 * (max_energy - min_energy) - min_energy;
+
+  table->data.resize(Table::number_of_quantities * table_size);
+  table->minimum_enthalpy_minus_one = std::numeric_limits<double>::max();
+  for (size_t i = 0; i < number_of_points[0]; ++i) {
+    const double rest_mass_density =
+        table->value_from_scaled_coordinate(0, static_cast<double>(i));
+    for (size_t j = 0; j < number_of_points[1]; ++j) {
+      for (size_t k = 0; k < number_of_points[2]; ++k) {
+        const size_t point = (i * number_of_points[1] + j) *
+                                 number_of_points[2] +
+                             k;
+        if (j > 0 and
+            specific_internal_energy[point] <=
+                specific_internal_energy[point - number_of_points[2]]) {
+          ERROR("The tabulated specific internal energy must increase with the "
+                "temperature, but it does not at density index "
+                << i << ", temperature index " << j
+                << ", electron fraction index " << k);
+        }
+        table->data[table->offset(i, j, k, Table::log_pressure)] =
+            std::log(pressure[point]);
+        table->data[table->offset(i, j, k, Table::log_shifted_energy)] =
+            std::log(specific_internal_energy[point] + table->energy_shift);
+        table->data[table->offset(i, j, k, Table::sound_speed_squared)] =
+            sound_speed_squared[point];
+        table->minimum_enthalpy_minus_one =
+            std::min(table->minimum_enthalpy_minus_one,
+                     specific_internal_energy[point] +
+                         pressure[point] / rest_mass_density);
+      }
+    }
+  }
+  return table;
+}
+
+std::shared_ptr<const Table> read_table(const std::string& table_filename,
+                                        const std::string& table_subfilename) {
+  h5::H5File<h5::AccessType::ReadOnly> file{table_filename};
+  const auto& eos_table = file.get<h5::EosTable>("/" + table_subfilename);
+  const std::vector<std::string> expected_names{
+      "rest mass density", "temperature", "electron fraction"};
+  if (eos_table.independent_variable_names() != expected_names) {
+    ERROR("The independent variables of the equation of state table "
+          << table_filename << ":" << table_subfilename
+          << " must be 'rest mass density', 'temperature', and 'electron "
+             "fraction', in that order.");
+  }
+  std::array<std::array<double, 2>, 3> bounds{};
+  std::array<size_t, 3> number_of_points{};
+  std::array<bool, 3> uses_log_spacing{};
+  for (size_t d = 0; d < 3; ++d) {
+    bounds[d] = eos_table.independent_variable_bounds()[d];
+    number_of_points[d] = eos_table.independent_variable_number_of_points()[d];
+    uses_log_spacing[d] = eos_table.independent_variable_uses_log_spacing()[d];
+  }
+  auto table = make_table(bounds, number_of_points, uses_log_spacing,
+                          eos_table.read_quantity("pressure"),
+                          eos_table.read_quantity("specific internal energy"),
+                          eos_table.read_quantity("sound speed squared"));
+  file.close_current_object();
+  return table;
+}
+
+// Tables read from files are shared by all equations of state in the process,
+// so that each table is only read and stored once per node in SMP builds.
+std::shared_ptr<const Table> shared_table(
+    const std::string& table_filename, const std::string& table_subfilename) {
+  static std::mutex tables_mutex{};
+  static std::unordered_map<std::string, std::weak_ptr<const Table>> tables{};
+  const std::string key = table_filename + ":" + table_subfilename;
+  std::lock_guard<std::mutex> lock{tables_mutex};
+  auto table = tables[key].lock();
+  if (table == nullptr) {
+    table = read_table(table_filename, table_subfilename);
+    tables[key] = table;
+  }
+  return table;
+}
+}  // namespace
+
+template <bool IsRelativistic>
+Tabulated3D<IsRelativistic>::Tabulated3D(std::string table_filename,
+                                         std::string table_subfilename)
+    : table_filename_(std::move(table_filename)),
+      table_subfilename_(std::move(table_subfilename)),
+      table_(shared_table(table_filename_, table_subfilename_)) {}
+
+template <bool IsRelativistic>
+Tabulated3D<IsRelativistic>::Tabulated3D(
+    const std::array<std::array<double, 2>, 3>& bounds,
+    const std::array<size_t, 3>& number_of_points,
+    const std::array<bool, 3>& uses_log_spacing, const DataVector& pressure,
+    const DataVector& specific_internal_energy,
+    const DataVector& sound_speed_squared)
+    : table_(make_table(bounds, number_of_points, uses_log_spacing, pressure,
+                        specific_internal_energy, sound_speed_squared)) {}
+
+EQUATION_OF_STATE_MEMBER_DEFINITIONS(template <bool IsRelativistic>,
+                                     Tabulated3D<IsRelativistic>, double, 3)
+EQUATION_OF_STATE_MEMBER_DEFINITIONS(template <bool IsRelativistic>,
+                                     Tabulated3D<IsRelativistic>, DataVector,
+                                     3)
+
+template <bool IsRelativistic>
+Tabulated3D<IsRelativistic>::Tabulated3D(CkMigrateMessage* msg)
+    : EquationOfState<IsRelativistic, 3>(msg) {}
+
+template <bool IsRelativistic>
+void Tabulated3D<IsRelativistic>::pup(PUP::er& p) {
+  EquationOfState<IsRelativistic, 3>::pup(p);
+  p | table_filename_;
+  p | table_subfilename_;
+  if (table_filename_.empty()) {
+    // The table was constructed in memory, so it has to be sent.
+    Table table = p.isUnpacking() ? Table{} : *table_;
+    p | table;
+    if (p.isUnpacking()) {
+      table_ = std::make_shared<const Table>(std::move(table));
+    }
+  } else if (p.isUnpacking()) {
+    table_ = shared_table(table_filename_, table_subfilename_);
+  }
+}
+
+template <bool IsRelativistic>
+double Tabulated3D<IsRelativistic>::rest_mass_density_lower_bound() const {
+  return table_->bounds[0][0];
+}
+
+template <bool IsRelativistic>
+double Tabulated3D<IsRelativistic>::rest_mass_density_upper_bound() const {
+  return table_->bounds[0][1];
+}
+
+template <bool IsRelativistic>
+double Tabulated3D<IsRelativistic>::temperature_lower_bound() const {
+  return table_->bounds[1][0];
+}
+
+template <bool IsRelativistic>
+double Tabulated3D<IsRelativistic>::temperature_upper_bound() const {
+  return table_->bounds[1][1];
+}
+
+template <bool IsRelativistic>
+double Tabulated3D<IsRelativistic>::electron_fraction_lower_bound() const {
+  return table_->bounds[2][0];
+}
+
+template <bool IsRelativistic>
+double Tabulated3D<IsRelativistic>::electron_fraction_upper_bound() const {
+  return table_->bounds[2][1];
+}
+
+template <bool IsRelativistic>
+double Tabulated3D<IsRelativistic>::specific_internal_energy_lower_bound(
+    const double rest_mass_density, const double electron_fraction) const {
+  return get(specific_internal_energy_from_density_and_temperature(
+      Scalar<double>{rest_mass_density},
+      Scalar<double>{temperature_lower_bound()},
+      Scalar<double>{electron_fraction}));
+}
+
+template <bool IsRelativistic>
+double Tabulated3D<IsRelativistic>::specific_internal_energy_upper_bound(
+    const double rest_mass_density, const double electron_fraction) const {
+  return get(specific_internal_energy_from_density_and_temperature(
+      Scalar<double>{rest_mass_density},
+      Scalar<double>{temperature_upper_bound()},
+      Scalar<double>{electron_fraction}));
+}
+
+template <bool IsRelativistic>
+double Tabulated3D<IsRelativistic>::specific_enthalpy_lower_bound() const {
+  return (IsRelativistic ? 1.0 : 0.0) + table_->minimum_enthalpy_minus_one;
+}
+
+template <bool IsRelativistic>
+template <class DataType>
+Scalar<DataType>
+Tabulated3D<IsRelativistic>::pressure_from_density_and_temperature_impl(
+    const Scalar<DataType>& rest_mass_density,
+    const Scalar<DataType>& temperature,
+    const Scalar<DataType>& electron_fraction) const {
+  using std::exp;
+  return Scalar<DataType>{exp(interpolate(
+      *table_, table_->scaled_coordinate(0, get(rest_mass_density)),
+      table_->scaled_coordinate(1, get(temperature)),
+      table_->scaled_coordinate(2, get(electron_fraction)),
+      Table::log_pressure))};
+}
+
+template <bool IsRelativistic>
+template <class DataType>
+Scalar<DataType>
+Tabulated3D<IsRelativistic>::pressure_from_density_and_energy_impl(
+    const Scalar<DataType>& rest_mass_density,
+    const Scalar<DataType>& specific_internal_energy,
+    const Scalar<DataType>& electron_fraction) const {
+  using std::exp;
+  const DataType density_coordinate =
+      table_->scaled_coordinate(0, get(rest_mass_density));
+  const DataType ye_coordinate =
+      table_->scaled_coordinate(2, get(electron_fraction));
+  return Scalar<DataType>{exp(interpolate(
+      *table_, density_coordinate,
+      temperature_coordinate_from_energy(*table_, density_coordinate,
+                                         get(specific_internal_energy),
+                                         ye_coordinate),
+      ye_coordinate, Table::log_pressure))};
+}
+
+template <bool IsRelativistic>
+template <class DataType>
+Scalar<DataType> Tabulated3D<IsRelativistic>::
+    specific_internal_energy_from_density_and_temperature_impl(
+        const Scalar<DataType>& rest_mass_density,
+        const Scalar<DataType>& temperature,
+        const Scalar<DataType>& electron_fraction) const {
+  using std::exp;
+  return Scalar<DataType>{
+      exp(interpolate(*table_,
+                      table_->scaled_coordinate(0, get(rest_mass_density)),
+                      table_->scaled_coordinate(1, get(temperature)),
+                      table_->scaled_coordinate(2, get(electron_fraction)),
+                      Table::log_shifted_energy)) -
+      table_->energy_shift};
+}
+
+template <bool IsRelativistic>
+template <class DataType>
+Scalar<DataType>
+Tabulated3D<IsRelativistic>::temperature_from_density_and_energy_impl(
+    const Scalar<DataType>& rest_mass_density,
+    const Scalar<DataType>& specific_internal_energy,
+    const Scalar<DataType>& electron_fraction) const {
+  return Scalar<DataType>{table_->value_from_scaled_coordinate(
+      1, temperature_coordinate_from_energy(
+             *table_, table_->scaled_coordinate(0, get(rest_mass_density)),
+             get(specific_internal_energy),
+             table_->scaled_coordinate(2, get(electron_fraction))))};
+}
+
+template <bool IsRelativistic>
+template <class DataType>
+Scalar<DataType> Tabulated3D<IsRelativistic>::
+    sound_speed_squared_from_density_and_temperature_impl(
+        const Scalar<DataType>& rest_mass_density,
+        const Scalar<DataType>& temperature,
+        const Scalar<DataType>& electron_fraction) const {
+  return Scalar<DataType>{
+      interpolate(*table_, table_->scaled_coordinate(0, get(rest_mass_density)),
+                  table_->scaled_coordinate(1, get(temperature)),
+                  table_->scaled_coordinate(2, get(electron_fraction)),
+                  Table::sound_speed_squared)};
+}
+}  // namespace EquationsOfState
+
+template class EquationsOfState::Tabulated3D<true>;
+template class EquationsOfState::Tabulated3D<false>;
@@ -0,0 +1,165 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <boost/preprocessor/arithmetic/dec.hpp>
+#include <boost/preprocessor/arithmetic/inc.hpp>
+#include <boost/preprocessor/control/expr_iif.hpp>
+#include <boost/preprocessor/list/adt.hpp>
+#include <boost/preprocessor/repetition/for.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+#include <boost/preprocessor/tuple/to_list.hpp>
+#include <cstddef>
+#include <memory>
+#include <pup.h>
+#include <string>
+
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"  // IWYU pragma: keep
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+class DataVector;
+namespace EquationsOfState::detail {
+struct Tabulated3DTable;
+}  // namespace EquationsOfState::detail
+/// \endcond
+
+namespace EquationsOfState {
+/*!
+ * \ingroup EquationsOfStateGroup
+ * \brief A tabulated equation of state depending on the rest mass density
+ * \f$\rho\f$, the temperature \f$T\f$, and the electron fraction \f$Y_e\f$.
+ *
+ * The table is read from an `h5::EosTable` subfile whose independent variables
+ * are `"rest mass density"`, `"temperature"`, and `"electron fraction"` (with
+ * the electron fraction varying fastest), and which contains the quantities
+ * `"pressure"`, `"specific internal energy"`, and `"sound speed squared"`. The
+ * rest mass density and the temperature may be log spaced, in which case the
+ * interpolation is performed in their logarithms.
+ *
+ * ### Interpolation
+ *
+ * The logarithm of the pressure, the logarithm of the (shifted so that it is
+ * positive) specific internal energy, and the sound speed squared are
+ * interpolated trilinearly. The three quantities are stored next to each other
+ * for each point of the table, so an interpolation reads the eight corners of
+ * its cell from a few contiguous cache lines. When called with `DataVector`s,
+ * the mapping of all points to the table coordinates and the final
+ * exponentiation are performed as vector operations on the whole `DataVector`,
+ * and only the gather from the table is done point by point.
+ *
+ * The temperature is recovered from the specific internal energy by inverting
+ * the interpolant exactly: the temperature cell is found by bisection over the
+ * table's temperature points at the interpolated \f$\rho\f$ and \f$Y_e\f$, and
+ * within the cell the interpolant is linear in the temperature coordinate. The
+ * specific internal energy must therefore increase monotonically with the
+ * temperature, which is checked when the table is loaded. Values outside the
+ * table are clamped to the table bounds.
+ *
+ * ### Memory
+ *
+ * Tables read from a file are shared between all `Tabulated3D` objects in the
+ * same process that read the same subfile, including copies and objects
+ * deserialized by Charm++. The table is therefore read and stored once per
+ * node in SMP builds of Charm++, rather than once per PE. Deserializing an
+ * equation of state read from a file reads (or reuses) the table on the
+ * receiving node rather than sending it.
+ */
+template <bool IsRelativistic>
+class Tabulated3D : public EquationOfState<IsRelativistic, 3> {
+ public:
+  static constexpr size_t thermodynamic_dim = 3;
+  static constexpr bool is_relativistic = IsRelativistic;
+
+  struct TableFilename {
+    using type = std::string;
+    static constexpr Options::String help = {
+        "H5 file containing the equation of state table"};
+  };
+
+  struct TableSubFilename {
+    using type = std::string;
+    static constexpr Options::String help = {
+        "The h5::EosTable subfile in the H5 file, without the extension"};
+  };
+
+  static constexpr Options::String help = {
+      "A tabulated equation of state in the rest mass density, the "
+      "temperature, and the electron fraction, interpolated trilinearly."};
+
+  using options = tmpl::list<TableFilename, TableSubFilename>;
+
+  Tabulated3D() = default;
+  Tabulated3D(const Tabulated3D&) = default;
+  Tabulated3D& operator=(const Tabulated3D&) = default;
+  Tabulated3D(Tabulated3D&&) = default;
+  Tabulated3D& operator=(Tabulated3D&&) = default;
+  ~Tabulated3D() override = default;
+
+  Tabulated3D(std::string table_filename, std::string table_subfilename);
+
+  /// Construct the equation of state from tabulated data in memory, laid out
+  /// as in an `h5::EosTable` with the independent variables rest mass
+  /// density, temperature, and electron fraction.
+  Tabulated3D(const std::array<std::array<double, 2>, 3>& bounds,
+              const std::array<size_t, 3>& number_of_points,
+              const std::array<bool, 3>& uses_log_spacing,
+              const DataVector& pressure,
+              const DataVector& specific_internal_energy,
+              const DataVector& sound_speed_squared);
+
+  EQUATION_OF_STATE_FORWARD_DECLARE_MEMBERS(Tabulated3D, 3)
+
+  WRAPPED_PUPable_decl_base_template(  // NOLINT
+      SINGLE_ARG(EquationOfState<IsRelativistic, 3>), Tabulated3D);
+
+  /// The lower bound of the rest mass density that is valid for this EOS
+  double rest_mass_density_lower_bound() const override;
+
+  /// The upper bound of the rest mass density that is valid for this EOS
+  double rest_mass_density_upper_bound() const override;
+
+  /// The lower bound of the temperature that is valid for this EOS
+  double temperature_lower_bound() const override;
+
+  /// The upper bound of the temperature that is valid for this EOS
+  double temperature_upper_bound() const override;
+
+  /// The lower bound of the electron fraction that is valid for this EOS
+  double electron_fraction_lower_bound() const override;
+
+  /// The upper bound of the electron fraction that is valid for this EOS
+  double electron_fraction_upper_bound() const override;
+
+  /// The specific internal energy at the lowest temperature of the table for
+  /// the given rest mass density \f$\rho\f$ and electron fraction \f$Y_e\f$
+  double specific_internal_energy_lower_bound(
+      double rest_mass_density, double electron_fraction) const override;
+
+  /// The specific internal energy at the highest temperature of the table for
+  /// the given rest mass density \f$\rho\f$ and electron fraction \f$Y_e\f$
+  double specific_internal_energy_upper_bound(
+      double rest_mass_density, double electron_fraction) const override;
+
+  /// The smallest specific enthalpy at the points of the table
+  double specific_enthalpy_lower_bound() const override;
+
+ private:
+  EQUATION_OF_STATE_FORWARD_DECLARE_MEMBER_IMPLS(3)
+
+  std::string table_filename_{};
+  std::string table_subfilename_{};
+  std::shared_ptr<const detail::Tabulated3DTable> table_{};
+};
+
+/// \cond
+template <bool IsRelativistic>
+PUP::able::PUP_ID EquationsOfState::Tabulated3D<IsRelativistic>::my_PUP_ID =
+    0;
+/// \endcond
+}  // namespace EquationsOfState
@@ -77,6 +77,18 @@ def generate_xdmf(file_prefix, output, subfile_name, start_time, stop_time,
                 # to allow viewing the part that was written.
                 if not h5temporal:
                     continue
+                # Tensor components written as truncated modal coefficients
+                # (see the 'ModalCompression' option of ObserveFields) can't be
+                # visualized as nodal data.
+                modal_extents = h5temporal.get('modal_extents')
+                if modal_extents is not None and len(modal_extents) > 0:
+                    raise ValueError(
+                        ("The tensor components {} in file '{}' are stored as "
+                         "truncated modal coefficients, which can't be "
+                         "visualized directly. Reconstruct the nodal data "
+                         "first, e.g. by interpolating it with "
+                         "InterpolateVolumeData.py.").format(
+                             list(modal_extents.keys()), h5file[1]))
                 # Make sure the coordinates are found in the file. We assume
                 # there should always be an x-coordinate.
                 assert coordinates + '_x' in h5temporal, (
@@ -68,7 +68,9 @@ def interpolate_h5_file(source_file_path,
     grid specified by `target_mesh` and writes the results into
     `target_volume_data` inside `target_file_path`. The `target_file_path` can
     be the same as the `source_file_path` if the volume subfile paths are
-    different.
+    different. Tensor components that were written as truncated modal
+    coefficients are reconstructed to nodal data when they are read, so the
+    target data is always nodal and can be visualized.
 
     Parameters
     ----------
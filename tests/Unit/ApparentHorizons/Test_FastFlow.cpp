@@ -7,6 +7,7 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <optional>
 #include <random>
 #include <string>
 #include <utility>
@@ -38,16 +39,21 @@
 
 namespace {
 
-FastFlow::Status do_iteration(
+// Returns the final status and the total number of points that were
+// "interpolated" to, i.e. where the solution was evaluated
+std::pair<FastFlow::Status, size_t> do_iteration(
     const gsl::not_null<Strahlkorper<Frame::Inertial>*> strahlkorper,
     const gsl::not_null<FastFlow*> flow,
     const gr::Solutions::KerrSchild& solution) {
   FastFlow::Status status = FastFlow::Status::SuccessfulIteration;
+  size_t number_of_points = 0;
 
   while (status == FastFlow::Status::SuccessfulIteration) {
     const auto l_mesh = flow->current_l_mesh(*strahlkorper);
     const auto prolonged_strahlkorper =
         Strahlkorper<Frame::Inertial>(l_mesh, l_mesh, *strahlkorper);
+    number_of_points +=
+        prolonged_strahlkorper.ylm_spherepack().physical_size();
 
     const auto box = db::create<
         db::AddSimpleTags<StrahlkorperTags::items_tags<Frame::Inertial>>,
@@ -83,7 +89,7 @@ FastFlow::Status do_iteration(
             inverse_spatial_metric));
     status = status_and_info.first;
   }
-  return status;
+  return {status, number_of_points};
 }
 
 void test_construct_from_options_fast() {
@@ -95,7 +101,8 @@ void test_construct_from_options_fast() {
       "TruncationTol: 1.e-3\n"
       "DivergenceTol: 1.1\n"
       "DivergenceIter: 6\n"
-      "MaxIts: 200");
+      "MaxIts: 200\n"
+      "CoarseLMax: None");
   CHECK(created ==
         FastFlow(FastFlow::FlowType::Fast, 1.1, 0.6, 1e-10, 1e-3, 1.1, 6, 200));
 }
@@ -109,11 +116,27 @@ void test_construct_from_options_jacobi() {
       "TruncationTol: 1.e-3\n"
       "DivergenceTol: 1.1\n"
       "DivergenceIter: 6\n"
-      "MaxIts: 200");
+      "MaxIts: 200\n"
+      "CoarseLMax: None");
   CHECK(created == FastFlow(FastFlow::FlowType::Jacobi, 1.1, 0.6, 1e-10, 1e-3,
                             1.1, 6, 200));
 }
 
+void test_construct_from_options_coarse() {
+  const auto created = TestHelpers::test_creation<FastFlow>(
+      "Flow: Fast\n"
+      "Alpha: 1.1\n"
+      "Beta: 0.6\n"
+      "AbsTol: 1.e-10\n"
+      "TruncationTol: 1.e-3\n"
+      "DivergenceTol: 1.1\n"
+      "DivergenceIter: 6\n"
+      "MaxIts: 200\n"
+      "CoarseLMax: 6");
+  CHECK(created == FastFlow(FastFlow::FlowType::Fast, 1.1, 0.6, 1e-10, 1e-3,
+                            1.1, 6, 200, 6));
+}
+
 void test_construct_from_options_curvature() {
   const auto created = TestHelpers::test_creation<FastFlow>(
       "Flow: Curvature\n"
@@ -123,7 +146,8 @@ void test_construct_from_options_curvature() {
       "TruncationTol: 1.e-3\n"
       "DivergenceTol: 1.1\n"
       "DivergenceIter: 6\n"
-      "MaxIts: 200");
+      "MaxIts: 200\n"
+      "CoarseLMax: None");
   CHECK(created == FastFlow(FastFlow::FlowType::Curvature, 1.1, 0.6, 1e-10,
                             1e-3, 1.1, 6, 200));
 }
@@ -132,6 +156,10 @@ void test_serialize() {
   FastFlow fastflow(FastFlow::FlowType::Jacobi, 1.1, 0.6, 1e-10, 1e-3, 1.1, 6,
                     200);
   test_serialization(fastflow);
+  FastFlow coarse_fastflow(FastFlow::FlowType::Jacobi, 1.1, 0.6, 1e-10, 1e-3,
+                           1.1, 6, 200, 4);
+  test_serialization(coarse_fastflow);
+  CHECK(coarse_fastflow != fastflow);
 }
 
 void test_copy_and_move() {
@@ -166,7 +194,7 @@ void test_negative_radius_error() {
 
   const gr::Solutions::KerrSchild solution(1.0, {{0., 0., 0.}}, {{0., 0., 0.}});
 
-  const auto status = do_iteration(&strahlkorper, &flow, solution);
+  const auto status = do_iteration(&strahlkorper, &flow, solution).first;
   CHECK(status == FastFlow::Status::NegativeRadius);
 }
 
@@ -177,7 +205,7 @@ void test_too_many_iterations_error() {
 
   const gr::Solutions::KerrSchild solution(1.0, {{0., 0., 0.}}, {{0., 0., 0.}});
 
-  const auto status = do_iteration(&strahlkorper, &flow, solution);
+  const auto status = do_iteration(&strahlkorper, &flow, solution).first;
   CHECK(status == FastFlow::Status::MaxIts);
 }
 
@@ -189,7 +217,7 @@ void test_schwarzschild(FastFlow::Flow::type type_of_flow,
   const gr::Solutions::KerrSchild solution(1.0, {{0., 0., 0.}}, {{0., 0., 0.}});
 
   const auto iterate_and_check = [&strahlkorper, &flow, &solution]() {
-    const auto status = do_iteration(&strahlkorper, &flow, solution);
+    const auto status = do_iteration(&strahlkorper, &flow, solution).first;
     CHECK(converged(status));
 
     const auto box = db::create<
@@ -228,16 +256,25 @@ void test_schwarzschild(FastFlow::Flow::type type_of_flow,
   iterate_and_check();
 }
 
-void test_kerr(FastFlow::Flow::type type_of_flow, const double mass,
-               const size_t max_iterations) {
+// Returns the total number of points the solution was evaluated at
+size_t test_kerr(FastFlow::Flow::type type_of_flow, const double mass,
+                 const size_t max_iterations,
+                 const std::optional<size_t> coarse_l_max = std::nullopt) {
   Strahlkorper<Frame::Inertial> strahlkorper(8, 8, 2.0 * mass, {{0, 0, 0}});
-  FastFlow flow(type_of_flow, 1.0, 0.5, 1e-12, 1e-2, 1.2, 5, max_iterations);
+  FastFlow flow(type_of_flow, 1.0, 0.5, 1e-12, 1e-2, 1.2, 5, max_iterations,
+                coarse_l_max);
 
   const std::array<double, 3> spin = {{0.1, 0.2, 0.3}};
   const gr::Solutions::KerrSchild solution(mass, spin, {{0., 0., 0.}});
 
-  const auto status = do_iteration(&strahlkorper, &flow, solution);
+  const auto [status, number_of_points] =
+      do_iteration(&strahlkorper, &flow, solution);
   CHECK(converged(status));
+  // The surface is found at full resolution, even when iterating on a coarse
+  // surface in between
+  CHECK(strahlkorper.l_max() == 8);
+  CHECK(strahlkorper.m_max() == 8);
+  CHECK_FALSE(flow.iterating_on_coarse_surface());
 
   const double spin_magnitude =
       sqrt(square(spin[0]) + square(spin[1]) + square(spin[2]));
@@ -266,6 +303,19 @@ void test_kerr(FastFlow::Flow::type type_of_flow, const double mass,
   Approx custom_approx = Approx::custom().epsilon(1.e-10).scale(1.);
   CHECK(r_min_pt == custom_approx(r_min_val));
   CHECK(r_max_pt == custom_approx(r_max_val));
+  return number_of_points;
+}
+
+void test_coarse_to_fine() {
+  const size_t number_of_points = test_kerr(FastFlow::FlowType::Fast, 2.0, 100);
+  const size_t number_of_points_coarse_to_fine =
+      test_kerr(FastFlow::FlowType::Fast, 2.0, 100, 4);
+  CAPTURE(number_of_points);
+  CAPTURE(number_of_points_coarse_to_fine);
+  CHECK(number_of_points_coarse_to_fine < number_of_points);
+  // A coarse resolution that is not smaller than the surface resolution has no
+  // effect
+  CHECK(test_kerr(FastFlow::FlowType::Fast, 2.0, 100, 8) == number_of_points);
 }
 
 }  // namespace
@@ -286,7 +336,7 @@ SPECTRE_TEST_CASE("Unit.ApparentHorizons.CurvatureSchwarzschild",
 }
 
 SPECTRE_TEST_CASE("Unit.ApparentHorizons.FastFlowKerr", "[Utilities][Unit]") {
-  test_kerr(FastFlow::FlowType::Fast, 2.0, 100);
+  test_coarse_to_fine();
 }
 
 SPECTRE_TEST_CASE("Unit.ApparentHorizons.JacobiKerr", "[Utilities][Unit]") {
@@ -305,6 +355,7 @@ SPECTRE_TEST_CASE("Unit.ApparentHorizons.FastFlowMisc", "[Utilities][Unit]") {
   test_construct_from_options_fast();
   test_construct_from_options_jacobi();
   test_construct_from_options_curvature();
+  test_construct_from_options_coarse();
   test_copy_and_move();
   test_serialize();
   test_ostream();
@@ -322,7 +373,8 @@ SPECTRE_TEST_CASE("Unit.ApparentHorizons.FastFlowOptFail",
       "TruncationTol: 1.e-3\n"
       "DivergenceTol: 0.5\n"
       "DivergenceIter: 6\n"
-      "MaxIts: 200");
+      "MaxIts: 200\n"
+      "CoarseLMax: None");
 }
 
 // [[OutputRegex, Failed to convert "Crud" to FastFlow::FlowType]]
@@ -337,5 +389,6 @@ SPECTRE_TEST_CASE("Unit.ApparentHorizons.FastFlowOptFail2",
       "TruncationTol: 1.e-3\n"
       "DivergenceTol: 1.1\n"
       "DivergenceIter: 6\n"
-      "MaxIts: 200");
+      "MaxIts: 200\n"
+      "CoarseLMax: None");
 }
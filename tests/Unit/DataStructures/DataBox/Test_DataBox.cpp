@@ -2845,6 +2845,30 @@ void test_output() {
   std::string output_stream = os.str();
   std::string expected_stream = expected_types + "\n" + expected_items+ "\n";
   CHECK(output_stream == expected_stream);
+
+  const auto sizes = box.size_of_items();
+  REQUIRE(sizes.size() == 5);
+  CHECK(sizes[0].first == "Tag0");
+  CHECK(sizes[1].first == "Tag1");
+  CHECK(sizes[2].first == "Tag2");
+  CHECK(sizes[3].first == "Tag4");
+  CHECK(sizes[4].first == "Tag5");
+  // Each item is serialized with a flag that marks it as valid or evaluated
+  PUP::sizer item_sizer{};
+  bool flag = true;
+  double value = 3.14;
+  item_sizer | flag;
+  item_sizer | value;
+  CHECK(sizes[0].second == item_sizer.size());
+  CHECK(sizes[3].second == item_sizer.size());
+  CHECK(sizes[1].second > sizes[0].second);
+  PUP::sizer box_sizer{};
+  box_sizer | box;
+  size_t total_size = 0;
+  for (const auto& name_and_size : sizes) {
+    total_size += name_and_size.second;
+  }
+  CHECK(total_size == box_sizer.size());
 }
 
 void test_remove_item() {
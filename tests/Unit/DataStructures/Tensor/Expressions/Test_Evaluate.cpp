@@ -3,15 +3,24 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <cstddef>
+#include <random>
 #include <type_traits>
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tags/TempTensor.hpp"
 #include "DataStructures/Tensor/Expressions/Evaluate.hpp"
 #include "DataStructures/Tensor/Expressions/TensorIndex.hpp"
 #include "DataStructures/Tensor/IndexType.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "Helpers/DataStructures/Tensor/Expressions/EvaluateRank0.hpp"
 #include "Helpers/DataStructures/Tensor/Expressions/EvaluateRank1.hpp"
 #include "Helpers/DataStructures/Tensor/Expressions/EvaluateRank2.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
 
 namespace {
 template <auto&... TensorIndices>
@@ -32,11 +41,113 @@ void test_contains_indices_to_contract() {
   test_contains_indices_to_contract_impl<ti::j, ti::c, ti::J, ti::A, ti::a>(
       true);
 }
+
+// Checks the evaluation of DataVector expressions one block of grid points at a
+// time, including the last partial block
+void test_point_blocked_evaluation() {
+  MAKE_GENERATOR(generator);
+  std::uniform_real_distribution<> distribution(-1.0, 1.0);
+  const DataVector used_for_size{3 * tenex::detail::points_per_block + 5};
+
+  const auto R = make_with_random_values<tnsr::ab<DataVector, 3>>(
+      make_not_null(&generator), make_not_null(&distribution), used_for_size);
+  const auto S = make_with_random_values<tnsr::Ab<DataVector, 3>>(
+      make_not_null(&generator), make_not_null(&distribution), used_for_size);
+  const auto T = make_with_random_values<Scalar<DataVector>>(
+      make_not_null(&generator), make_not_null(&distribution), used_for_size);
+
+  // An expression with few enough operations that it isn't split into
+  // subtrees, so its LHS components are computed one block of points at a time
+  using blocked_expression = decltype(R(ti::a, ti::b) * T() - R(ti::b, ti::a));
+  static_assert(
+      not blocked_expression::primary_subtree_contains_primary_start,
+      "The expression must not be split, so that it is evaluated in blocks");
+  tnsr::ab<DataVector, 3> expected{used_for_size.size(), 0.0};
+  for (size_t a = 0; a < 4; ++a) {
+    for (size_t b = 0; b < 4; ++b) {
+      expected.get(a, b) = R.get(a, b) * get(T) - R.get(b, a);
+    }
+  }
+
+  // LHS components are sized by the evaluation
+  tnsr::ab<DataVector, 3> result{};
+  tenex::evaluate<ti::a, ti::b>(make_not_null(&result),
+                                R(ti::a, ti::b) * T() - R(ti::b, ti::a));
+  for (size_t a = 0; a < 4; ++a) {
+    for (size_t b = 0; b < 4; ++b) {
+      CHECK_ITERABLE_APPROX(result.get(a, b), expected.get(a, b));
+    }
+  }
+
+  // LHS components that point into a Variables
+  using result_tag = ::Tags::TempTensor<0, tnsr::ab<DataVector, 3>>;
+  Variables<tmpl::list<result_tag>> result_vars{used_for_size.size()};
+  auto& result_in_vars = get<result_tag>(result_vars);
+  tenex::evaluate<ti::a, ti::b>(make_not_null(&result_in_vars),
+                                R(ti::a, ti::b) * T() - R(ti::b, ti::a));
+  for (size_t a = 0; a < 4; ++a) {
+    for (size_t b = 0; b < 4; ++b) {
+      CHECK_ITERABLE_APPROX(result_in_vars.get(a, b), expected.get(a, b));
+    }
+  }
+
+  // An expression that is split into subtrees is still evaluated one LHS
+  // component at a time
+  using split_expression =
+      decltype(R(ti::a, ti::c) * S(ti::C, ti::b) - T() * R(ti::b, ti::a));
+  static_assert(split_expression::primary_subtree_contains_primary_start,
+                "The expression must be split into subtrees");
+  tnsr::ab<DataVector, 3> expected_split{used_for_size.size(), 0.0};
+  for (size_t a = 0; a < 4; ++a) {
+    for (size_t b = 0; b < 4; ++b) {
+      for (size_t c = 0; c < 4; ++c) {
+        expected_split.get(a, b) += R.get(a, c) * S.get(c, b);
+      }
+      expected_split.get(a, b) -= get(T) * R.get(b, a);
+    }
+  }
+  tnsr::ab<DataVector, 3> split_result{};
+  tenex::evaluate<ti::a, ti::b>(
+      make_not_null(&split_result),
+      R(ti::a, ti::c) * S(ti::C, ti::b) - T() * R(ti::b, ti::a));
+  for (size_t a = 0; a < 4; ++a) {
+    for (size_t b = 0; b < 4; ++b) {
+      CHECK_ITERABLE_APPROX(split_result.get(a, b), expected_split.get(a, b));
+    }
+  }
+
+  // LHS tensor in the RHS expression
+  tenex::update<ti::a, ti::b>(make_not_null(&result),
+                              2.0 * result(ti::a, ti::b) + R(ti::a, ti::b));
+  for (size_t a = 0; a < 4; ++a) {
+    for (size_t b = 0; b < 4; ++b) {
+      CHECK_ITERABLE_APPROX(result.get(a, b),
+                            DataVector{2.0 * expected.get(a, b) + R.get(a, b)});
+    }
+  }
+
+  // Only the spatial components of the LHS are computed
+  tnsr::ab<DataVector, 3> spatial_result{used_for_size.size(), -1.0};
+  tenex::evaluate<ti::i, ti::j>(make_not_null(&spatial_result),
+                                R(ti::i, ti::j) + R(ti::j, ti::i));
+  for (size_t a = 0; a < 4; ++a) {
+    for (size_t b = 0; b < 4; ++b) {
+      if (a == 0 or b == 0) {
+        CHECK(spatial_result.get(a, b) ==
+              DataVector(used_for_size.size(), -1.0));
+      } else {
+        CHECK_ITERABLE_APPROX(spatial_result.get(a, b),
+                              DataVector{R.get(a, b) + R.get(b, a)});
+      }
+    }
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.Expression.Evaluate",
                   "[DataStructures][Unit]") {
   test_contains_indices_to_contract();
+  test_point_blocked_evaluation();
 
   // Rank 0: double
   TestHelpers::tenex::test_evaluate_rank_0<double>(-7.31);
@@ -0,0 +1,75 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionalIdMap.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/MaxNumberOfNeighbors.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Utilities/GetOutput.hpp"
+
+namespace {
+template <size_t Dim>
+void test_directional_id_map() {
+  INFO("Dim = " + get_output(Dim));
+  using Key = std::pair<Direction<Dim>, ElementId<Dim>>;
+  constexpr size_t neighbors_per_direction =
+      maximum_number_of_neighbors(Dim) / (2 * Dim);
+
+  // Fill the map with the maximum number of neighbors
+  std::vector<Key> keys{};
+  for (const auto& direction : Direction<Dim>::all_directions()) {
+    for (size_t i = 0; i < neighbors_per_direction; ++i) {
+      keys.emplace_back(direction, ElementId<Dim>{keys.size()});
+    }
+  }
+  REQUIRE(keys.size() == maximum_number_of_neighbors(Dim));
+
+  DirectionalIdMap<Dim, size_t> map{};
+  CHECK(map.empty());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    CHECK(map.insert({keys[i], i}).second);
+  }
+  CHECK(map.size() == keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    CHECK(map.contains(keys[i]));
+    CHECK(map.at(keys[i]) == i);
+  }
+  size_t sum = 0;
+  for (const auto& [key, value] : map) {
+    CHECK(key == keys[value]);
+    sum += value;
+  }
+  CHECK(sum == keys.size() * (keys.size() - 1) / 2);
+  CHECK(not map.contains(
+      Key{Direction<Dim>::lower_xi(), ElementId<Dim>::external_boundary_id()}));
+
+  test_serialization(map);
+  const auto copied_map = map;
+  CHECK(copied_map == map);
+
+  // Entries can be found after erasing others
+  for (size_t i = 0; i < keys.size(); i += 2) {
+    CHECK(map.erase(keys[i]) == 1);
+  }
+  CHECK(map.size() == keys.size() / 2);
+  for (size_t i = 0; i < keys.size(); ++i) {
+    CHECK(map.contains(keys[i]) == (i % 2 == 1));
+  }
+  CHECK(map != copied_map);
+  map[keys[0]] = 7;
+  CHECK(map.at(keys[0]) == 7);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Domain.Structure.DirectionalIdMap", "[Domain][Unit]") {
+  test_directional_id_map<1>();
+  test_directional_id_map<2>();
+  test_directional_id_map<3>();
+}
@@ -7,8 +7,10 @@
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <numeric>
 #include <pup.h>
 #include <type_traits>
+#include <vector>
 
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -28,6 +30,7 @@
 #include "Domain/Structure/Side.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
 #include "Utilities/MakeArray.hpp"
 #include "Utilities/TMPL.hpp"
@@ -459,6 +462,50 @@ void test_2d_orient_variables_on_slice() {
   CHECK(number_of_orientations_checked == 48);
 }
 
+void test_cached_offsets_and_buffers() {
+  const OrientationMap<3> orientation_map(std::array<Direction<3>, 3>{
+      {Direction<3>::lower_eta(), Direction<3>::upper_zeta(),
+       Direction<3>::lower_xi()}});
+  const Index<3> extents{2, 3, 4};
+  const Index<2> slice_extents{3, 4};
+
+  // The permutations are computed once and then reused
+  namespace helpers = OrientationMapHelpers_detail;
+  const auto& offset = helpers::oriented_offset(extents, orientation_map);
+  CHECK(&offset == &helpers::oriented_offset(extents, orientation_map));
+  CHECK(&offset !=
+        &helpers::oriented_offset(Index<3>{4, 3, 2}, orientation_map));
+  CHECK(&offset != &helpers::oriented_offset(extents, OrientationMap<3>{}));
+  const auto& slice_offset =
+      helpers::oriented_offset_on_slice(slice_extents, 0, orientation_map);
+  CHECK(&slice_offset ==
+        &helpers::oriented_offset_on_slice(slice_extents, 0, orientation_map));
+  CHECK(&slice_offset !=
+        &helpers::oriented_offset_on_slice(slice_extents, 1, orientation_map));
+
+  // Orienting into a buffer keeps the capacity reserved by the caller
+  std::vector<double> vars(2 * extents.product());
+  std::iota(vars.begin(), vars.end(), 1.0);
+  std::vector<double> oriented_vars{};
+  oriented_vars.reserve(vars.size() + 10);
+  const double* const buffer = oriented_vars.data();
+  orient_variables(make_not_null(&oriented_vars), vars, extents,
+                   orientation_map);
+  CHECK(oriented_vars == orient_variables(vars, extents, orientation_map));
+  CHECK(oriented_vars.data() == buffer);
+  orient_variables(make_not_null(&oriented_vars), vars, extents,
+                   OrientationMap<3>{});
+  CHECK(oriented_vars == vars);
+  CHECK(oriented_vars.data() == buffer);
+
+  std::vector<double> vars_on_slice(3 * slice_extents.product());
+  std::iota(vars_on_slice.begin(), vars_on_slice.end(), -4.0);
+  orient_variables_on_slice(make_not_null(&oriented_vars), vars_on_slice,
+                            slice_extents, 0, orientation_map);
+  CHECK(oriented_vars == orient_variables_on_slice(vars_on_slice, slice_extents,
+                                                   0, orientation_map));
+  CHECK(oriented_vars.data() == buffer);
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.Structure.OrientationMapHelpers",
@@ -478,4 +525,8 @@ SPECTRE_TEST_CASE("Unit.Domain.Structure.OrientationMapHelpers",
     test_1d_orient_variables_on_slice();
     test_2d_orient_variables_on_slice();
   }
+
+  SECTION("Testing cached offsets and orienting into buffers") {
+    test_cached_offsets_and_buffers();
+  }
 }
@@ -79,6 +79,12 @@ std::vector<std::vector<size_t>> make_proc_map_for_domain(
       // Check that we ignored the correct proc
       CHECK(not procs_to_ignore.count(proc_map.at(block).at(element_index)));
     }
+    // Check that exactly the procs that have elements in the block are listed
+    const std::vector<size_t> procs_for_block =
+        distribution.procs_for_block(block);
+    CHECK(std::set<size_t>(procs_for_block.begin(), procs_for_block.end()) ==
+          std::set<size_t>(proc_map.at(block).begin(),
+                           proc_map.at(block).end()));
   }
   return proc_map;
 }
@@ -330,6 +330,26 @@ struct TestSubdomainOperatorMatrix {
         make_not_null(&result_buffer), subdomain_operator,
         std::forward_as_tuple(box));
 
+    // The subdomain operator supports batched applications, which
+    // `build_matrix` uses. Check that it builds the same matrix as applying
+    // the operator column by column.
+    {
+      const auto apply_per_column = [&subdomain_operator](
+                                        const auto result, const auto& operand,
+                                        const auto& local_box) {
+        subdomain_operator(result, operand, local_box);
+      };
+      blaze::DynamicMatrix<double, blaze::columnMajor>
+          per_column_operator_matrix{operator_size, operator_size};
+      ::LinearSolver::Serial::build_matrix(
+          make_not_null(&per_column_operator_matrix),
+          make_not_null(&operand_buffer), make_not_null(&result_buffer),
+          apply_per_column, std::forward_as_tuple(box));
+      Approx custom_approx = Approx::custom().epsilon(1.e-12).scale(1.0);
+      CHECK_MATRIX_CUSTOM_APPROX(operator_matrix, per_column_operator_matrix,
+                                 custom_approx);
+    }
+
     // Check the matrix is equivalent to the operator by applying it to the
     // data. We need to do the matrix multiplication on a contiguous buffer
     // because the `ElementCenteredSubdomainData` is not contiguous.
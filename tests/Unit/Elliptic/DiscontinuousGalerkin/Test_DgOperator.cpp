@@ -326,6 +326,21 @@ void test_dg_operator(
                                           custom_aux_approx);
           }
         }
+        {
+          INFO("Boundary-corrected primal fluxes are kept in the DataBox");
+          for (const auto& element_id : all_element_ids) {
+            CAPTURE(element_id);
+            // Every element has at least one mortar or external boundary, so
+            // boundary corrections are always added to the primal fluxes
+            CHECK(get_tag(::elliptic::dg::Actions::detail::
+                              PrimalFluxesCorrectedBuffer<
+                                  primal_fluxes_vars_tag>{},
+                          element_id)
+                      .number_of_grid_points() ==
+                  get_tag(domain::Tags::Mesh<Dim>{}, element_id)
+                      .number_of_grid_points());
+          }
+        }
         {
           INFO("Operator applied to variables");
           for (const auto& [element_id, expected_operator_applied_to_vars] :
@@ -3,10 +3,8 @@
 
 #include "Framework/TestingFramework.hpp"
 
-#include <boost/functional/hash.hpp>
 #include <cstddef>
 #include <numeric>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -16,6 +14,7 @@
 #include "DataStructures/Variables.hpp"
 #include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/DirectionMap.hpp"
+#include "Domain/Structure/DirectionalIdMap.hpp"
 #include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/Neighbors.hpp"
@@ -82,10 +81,7 @@ void test() {
     const Vars interior_lower_packaged_data = lower_packaged_data;
     const Vars interior_upper_packaged_data = upper_packaged_data;
 
-    std::unordered_map<std::pair<Direction<Dim>, ElementId<Dim>>,
-                       evolution::dg::MortarData<Dim>,
-                       boost::hash<std::pair<Direction<Dim>, ElementId<Dim>>>>
-        mortar_data{};
+    DirectionalIdMap<Dim, evolution::dg::MortarData<Dim>> mortar_data{};
     const Direction<Dim> upper{direction_to_check, Side::Upper};
     const Direction<Dim> lower{direction_to_check, Side::Lower};
     const std::pair upper_neighbor{upper,
@@ -4,10 +4,8 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <array>
-#include <boost/functional/hash.hpp>
 #include <cstddef>
 #include <string>
-#include <unordered_map>
 #include <utility>
 
 #include "DataStructures/DataBox/Prefixes.hpp"
@@ -19,6 +17,7 @@
 #include "Domain/Structure/CreateInitialMesh.hpp"
 #include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/DirectionMap.hpp"
+#include "Domain/Structure/DirectionalIdMap.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/Neighbors.hpp"
 #include "Domain/Structure/SegmentId.hpp"
@@ -89,9 +88,7 @@ struct Metavariables {
 };
 
 template <size_t Dim, typename MappedType>
-using MortarMap =
-    std::unordered_map<std::pair<Direction<Dim>, ElementId<Dim>>, MappedType,
-                       boost::hash<std::pair<Direction<Dim>, ElementId<Dim>>>>;
+using MortarMap = DirectionalIdMap<Dim, MappedType>;
 
 template <bool LocalTimeStepping, size_t Dim>
 void test_impl(
@@ -160,6 +157,8 @@ void test_impl(
   CHECK(static_cast<bool>(
       get_tag(evolution::dg::Tags::NormalCovectorAndMagnitude<Dim>{}) ==
       expected_normal_covector_quantities));
+
+  CHECK_FALSE(get_tag(Tags::LocalGeometricQuantities<Dim>{}).has_value());
 }
 
 template <size_t Dim, bool LocalTimeStepping>
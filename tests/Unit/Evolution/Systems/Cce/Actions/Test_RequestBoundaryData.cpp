@@ -224,7 +224,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.Actions.RequestBoundaryData",
           l_max, filename, buffer_size,
           std::make_unique<intrp::BarycentricRationalSpanInterpolator>(3_st,
                                                                        4_st),
-          false, false, std::optional<double>{}));
+          false, false, std::optional<double>{}, false));
 
   // this should run the initializations
   for (size_t i = 0; i < 5; ++i) {
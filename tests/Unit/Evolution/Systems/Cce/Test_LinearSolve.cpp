@@ -4,6 +4,8 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <algorithm>
+#include <cstddef>
+#include <initializer_list>
 
 #include "DataStructures/ComplexDataVector.hpp"
 #include "DataStructures/ComplexModalVector.hpp"
@@ -15,6 +17,7 @@
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "Helpers/Evolution/Systems/Cce/CceComputationTestHelpers.hpp"
 #include "NumericalAlgorithms/Spectral/SwshCollocation.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/VectorAlgebra.hpp"
 
 namespace Cce {
@@ -294,7 +297,7 @@ void test_pole_integration(const gsl::not_null<Generator*> gen,
 template <typename BondiValueTag, typename Generator>
 void test_pole_integration_with_linear_operator(
     const gsl::not_null<Generator*> gen, size_t number_of_radial_grid_points,
-    size_t l_max) {
+    size_t l_max, const size_t number_of_threads) {
   // The typical linear solve performed during realistic CCE evolution involves
   // fairly small wave amplitudes
   UniformCustomDistribution<double> dist(0.01, 0.1);
@@ -455,13 +458,14 @@ void test_pole_integration_with_linear_operator(
                               TestHelpers::volume_one_minus_y, l_max);
 
   db::mutate_apply<RadialIntegrateBondi<Tags::BoundaryValue, BondiValueTag>>(
-      make_not_null(&box));
+      make_not_null(&box), number_of_threads);
 
   Approx numerical_differentiation_approximation =
       Approx::custom()
           .epsilon(std::numeric_limits<double>::epsilon() * 1.0e6)
           .scale(1.0);
   INFO("number of radial grid points: " << number_of_radial_grid_points);
+  INFO("number of threads: " << number_of_threads);
   CHECK_ITERABLE_CUSTOM_APPROX(expected,
                                get(db::get<BondiValueTag>(box)).data(),
                                numerical_differentiation_approximation);
@@ -481,8 +485,13 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.LinearSolve", "[Unit][Cce]") {
                                       number_of_radial_grid_points, l_max);
   test_pole_integration<Tags::BondiW>(make_not_null(&gen),
                                       number_of_radial_grid_points, l_max);
-  test_pole_integration_with_linear_operator<Tags::BondiH>(
-      make_not_null(&gen), number_of_radial_grid_points, l_max);
+  // The angular points are split unevenly between the threads when there are
+  // three of them.
+  for (const size_t number_of_threads : {1_st, 3_st}) {
+    test_pole_integration_with_linear_operator<Tags::BondiH>(
+        make_not_null(&gen), number_of_radial_grid_points, l_max,
+        number_of_threads);
+  }
 }
 }  // namespace
 }  // namespace Cce
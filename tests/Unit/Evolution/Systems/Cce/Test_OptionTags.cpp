@@ -51,6 +51,8 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.OptionTags", "[Unit][Cce]") {
   TestHelpers::db::test_simple_tag<Cce::Tags::LMax>("LMax");
   TestHelpers::db::test_simple_tag<Cce::Tags::NumberOfRadialPoints>(
       "NumberOfRadialPoints");
+  TestHelpers::db::test_simple_tag<Cce::Tags::NumberOfThreads>(
+      "NumberOfThreads");
   TestHelpers::db::test_simple_tag<Cce::Tags::ObservationLMax>(
       "ObservationLMax");
   TestHelpers::db::test_simple_tag<Cce::Tags::FilterLMax>("FilterLMax");
@@ -92,6 +94,8 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.OptionTags", "[Unit][Cce]") {
         6_st);
   CHECK(TestHelpers::test_option_tag<Cce::OptionTags::NumberOfRadialPoints>(
             "3") == 3_st);
+  CHECK(TestHelpers::test_option_tag<Cce::OptionTags::NumberOfThreads>("4") ==
+        4_st);
   CHECK(TestHelpers::test_option_tag<Cce::OptionTags::ExtractionRadius>(
             "100.0") == 100.0);
 
@@ -107,6 +111,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.OptionTags", "[Unit][Cce]") {
             "OptionTagsCceR0100.h5") == "OptionTagsCceR0100.h5");
   CHECK(TestHelpers::test_option_tag<Cce::OptionTags::H5LookaheadTimes>("5") ==
         5_st);
+  CHECK(TestHelpers::test_option_tag<Cce::OptionTags::H5PrefetchData>("true"));
   CHECK(TestHelpers::test_option_tag<Cce::OptionTags::ScriInterpolationOrder>(
             "4") == 4_st);
 
@@ -173,11 +178,17 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.OptionTags", "[Unit][Cce]") {
 
   CHECK(Cce::Tags::H5WorldtubeBoundaryDataManager::create_from_options(
             8, filename, 3, std::make_unique<intrp::CubicSpanInterpolator>(),
-            false, true, std::nullopt)
+            false, true, std::nullopt, false)
+            ->get_l_max() == 8);
+  // Prefetching falls back to synchronous reads if HDF5 isn't thread-safe
+  CHECK(Cce::Tags::H5WorldtubeBoundaryDataManager::create_from_options(
+            8, filename, 3, std::make_unique<intrp::CubicSpanInterpolator>(),
+            false, true, std::nullopt, true)
             ->get_l_max() == 8);
 
   CHECK(Cce::Tags::LMax::create_from_options(8u) == 8u);
   CHECK(Cce::Tags::NumberOfRadialPoints::create_from_options(6u) == 6u);
+  CHECK(Cce::Tags::NumberOfThreads::create_from_options(2u) == 2u);
 
   CHECK(Cce::Tags::StartTimeFromFile::create_from_options(
             std::optional<double>{}, "OptionTagsTestCceR0100.h5", false) ==
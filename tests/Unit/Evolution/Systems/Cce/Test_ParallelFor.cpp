@@ -0,0 +1,65 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "Evolution/Systems/Cce/ParallelFor.hpp"
+
+namespace Cce {
+namespace {
+void test_coverage(const size_t number_of_threads,
+                   const size_t number_of_items) {
+  CAPTURE(number_of_threads);
+  CAPTURE(number_of_items);
+  // Each item should be processed by exactly one block, so the counts need no
+  // synchronization if parallel_for is correct.  The test framework
+  // assertions are not thread-safe, so the checks are done afterwards.
+  std::vector<size_t> visits(number_of_items, 0);
+  std::atomic<size_t> number_of_empty_blocks{0};
+  parallel_for(number_of_threads, number_of_items,
+               [&visits, &number_of_empty_blocks](const size_t begin,
+                                                  const size_t end) {
+                 if (begin >= end) {
+                   ++number_of_empty_blocks;
+                 }
+                 for (size_t i = begin; i < end; ++i) {
+                   ++visits[i];
+                 }
+               });
+  CHECK(number_of_empty_blocks == 0);
+  for (const size_t count : visits) {
+    CHECK(count == 1);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.ParallelFor", "[Unit][Cce]") {
+  for (size_t number_of_threads = 0; number_of_threads < 6;
+       ++number_of_threads) {
+    for (size_t number_of_items = 1; number_of_items < 12; ++number_of_items) {
+      test_coverage(number_of_threads, number_of_items);
+    }
+  }
+
+  size_t number_of_calls = 0;
+  parallel_for(4, 0, [&number_of_calls](const size_t begin, const size_t end) {
+    CHECK(begin == end);
+    ++number_of_calls;
+  });
+  CHECK(number_of_calls == 1);
+
+  CHECK_THROWS_WITH(
+      parallel_for(3, 9,
+                   [](const size_t begin, const size_t /*end*/) {
+                     if (begin > 0) {
+                       throw std::runtime_error("Failure in a block");
+                     }
+                   }),
+      Catch::Contains("Failure in a block"));
+}
+}  // namespace Cce
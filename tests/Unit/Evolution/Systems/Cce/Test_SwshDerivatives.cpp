@@ -335,8 +335,10 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.SwshDerivatives", "[Unit][Cce]") {
   mutate_all_pre_swsh_derivatives_for_tag<TestSpinWeightedScalar<1>>(
       make_not_null(&computation_box));
 
+  // the radial shells are distributed unevenly over three threads, which must
+  // give the same result as the serial computation
   mutate_all_swsh_derivatives_for_tag<TestSpinWeightedScalar<1>>(
-      make_not_null(&computation_box));
+      make_not_null(&computation_box), 3);
 
   // this can be tightened at the cost of needing a higher resolution due to the
   // inherent aliasing in this system. A loose approx allows the test to be
@@ -4,6 +4,9 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "DataStructures/ComplexDataVector.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
@@ -359,7 +362,8 @@ template <typename DataManager, typename DummyUpdater, typename Generator>
 void test_data_manager_with_dummy_buffer_updater(
     const gsl::not_null<Generator*> gen,
     const bool apply_normalization_bug = false, const bool is_spec_input = true,
-    const std::optional<double> extraction_radius = std::nullopt) {
+    const std::optional<double> extraction_radius = std::nullopt,
+    const bool prefetch_buffers = false) {
   // note that the default_extraction_radius is what will be reported
   // from the buffer updater when the extraction_radius is the default
   // `std::nullopt`.
@@ -397,7 +401,7 @@ void test_data_manager_with_dummy_buffer_updater(
               l_max, false, is_spec_input),
           l_max, buffer_size,
           std::make_unique<intrp::BarycentricRationalSpanInterpolator>(3u, 4u),
-          is_spec_input};
+          is_spec_input, prefetch_buffers};
     } else {
       boundary_data_manager = DataManager{
           std::make_unique<DummyUpdater>(time_buffer, solution,
@@ -405,7 +409,7 @@ void test_data_manager_with_dummy_buffer_updater(
                                          frequency, l_max, true, false),
           l_max, buffer_size,
           std::make_unique<intrp::BarycentricRationalSpanInterpolator>(3u, 4u),
-          is_spec_input};
+          is_spec_input, prefetch_buffers};
     }
   } else {
     // avoid compiler warnings in the case where the normalization bug booleans
@@ -416,7 +420,8 @@ void test_data_manager_with_dummy_buffer_updater(
         std::make_unique<DummyUpdater>(time_buffer, solution, extraction_radius,
                                        amplitude, frequency, l_max, false),
         l_max, buffer_size,
-        std::make_unique<intrp::BarycentricRationalSpanInterpolator>(3u, 4u)};
+        std::make_unique<intrp::BarycentricRationalSpanInterpolator>(3u, 4u),
+        prefetch_buffers};
   }
   const size_t number_of_angular_points =
       Spectral::Swsh::number_of_swsh_collocation_points(l_max);
@@ -426,57 +431,78 @@ void test_data_manager_with_dummy_buffer_updater(
   Variables<Tags::characteristic_worldtube_boundary_tags<Tags::BoundaryValue>>
       interpolated_boundary_variables{number_of_angular_points};
 
-  Parallel::NodeLock hdf5_lock{};
-  boundary_data_manager.populate_hypersurface_boundary_data(
-      make_not_null(&interpolated_boundary_variables), target_time,
-      make_not_null(&hdf5_lock));
-
-  // populate the expected variables with the result from the analytic modes
-  // passed to the boundary data computation.
-  const size_t libsharp_size =
-      Spectral::Swsh::size_of_libsharp_coefficient_vector(l_max);
-  tnsr::ii<ComplexModalVector, 3> spatial_metric_coefficients{libsharp_size};
-  tnsr::ii<ComplexModalVector, 3> dt_spatial_metric_coefficients{libsharp_size};
-  tnsr::ii<ComplexModalVector, 3> dr_spatial_metric_coefficients{libsharp_size};
-  tnsr::I<ComplexModalVector, 3> shift_coefficients{libsharp_size};
-  tnsr::I<ComplexModalVector, 3> dt_shift_coefficients{libsharp_size};
-  tnsr::I<ComplexModalVector, 3> dr_shift_coefficients{libsharp_size};
-  Scalar<ComplexModalVector> lapse_coefficients{libsharp_size};
-  Scalar<ComplexModalVector> dt_lapse_coefficients{libsharp_size};
-  Scalar<ComplexModalVector> dr_lapse_coefficients{libsharp_size};
-  TestHelpers::create_fake_time_varying_modal_data(
-      make_not_null(&spatial_metric_coefficients),
-      make_not_null(&dt_spatial_metric_coefficients),
-      make_not_null(&dr_spatial_metric_coefficients),
-      make_not_null(&shift_coefficients), make_not_null(&dt_shift_coefficients),
-      make_not_null(&dr_shift_coefficients), make_not_null(&lapse_coefficients),
-      make_not_null(&dt_lapse_coefficients),
-      make_not_null(&dr_lapse_coefficients), solution,
-      extraction_radius.value_or(default_extraction_radius), amplitude,
-      frequency, target_time, l_max, false);
-
-  create_bondi_boundary_data(
-      make_not_null(&expected_boundary_variables), spatial_metric_coefficients,
-      dt_spatial_metric_coefficients, dr_spatial_metric_coefficients,
-      shift_coefficients, dt_shift_coefficients, dr_shift_coefficients,
-      lapse_coefficients, dt_lapse_coefficients, dr_lapse_coefficients,
-      extraction_radius.value_or(default_extraction_radius), l_max);
-  Approx angular_derivative_approx =
-      Approx::custom()
-          .epsilon(std::numeric_limits<double>::epsilon() * 1.0e4)
-          .scale(1.0);
+  // In addition to the `target_time`, which is between rows of the time
+  // buffer, check a sequence of the times of the rows that spans several
+  // buffer updates. The interpolation to those times is only exact if the
+  // buffers hold the correct data.
+  std::vector<double> times{};
+  for (size_t i = 9; i < 23; ++i) {
+    times.push_back(time_buffer[i]);
+    if (i == 15) {
+      times.push_back(target_time);
+    }
+  }
 
-  tmpl::for_each<
-      Tags::characteristic_worldtube_boundary_tags<Tags::BoundaryValue>>(
-      [&expected_boundary_variables, &interpolated_boundary_variables,
-       &angular_derivative_approx](auto tag_v) {
-        using tag = typename decltype(tag_v)::type;
-        INFO(db::tag_name<tag>());
-        const auto& test_lhs = get<tag>(expected_boundary_variables);
-        const auto& test_rhs = get<tag>(interpolated_boundary_variables);
-        CHECK_ITERABLE_CUSTOM_APPROX(test_lhs, test_rhs,
-                                     angular_derivative_approx);
-      });
+  Parallel::NodeLock hdf5_lock{};
+  for (const double time : times) {
+    CAPTURE(time);
+    boundary_data_manager.populate_hypersurface_boundary_data(
+        make_not_null(&interpolated_boundary_variables), time,
+        make_not_null(&hdf5_lock));
+
+    // populate the expected variables with the result from the analytic modes
+    // passed to the boundary data computation.
+    const size_t libsharp_size =
+        Spectral::Swsh::size_of_libsharp_coefficient_vector(l_max);
+    tnsr::ii<ComplexModalVector, 3> spatial_metric_coefficients{libsharp_size};
+    tnsr::ii<ComplexModalVector, 3> dt_spatial_metric_coefficients{
+        libsharp_size};
+    tnsr::ii<ComplexModalVector, 3> dr_spatial_metric_coefficients{
+        libsharp_size};
+    tnsr::I<ComplexModalVector, 3> shift_coefficients{libsharp_size};
+    tnsr::I<ComplexModalVector, 3> dt_shift_coefficients{libsharp_size};
+    tnsr::I<ComplexModalVector, 3> dr_shift_coefficients{libsharp_size};
+    Scalar<ComplexModalVector> lapse_coefficients{libsharp_size};
+    Scalar<ComplexModalVector> dt_lapse_coefficients{libsharp_size};
+    Scalar<ComplexModalVector> dr_lapse_coefficients{libsharp_size};
+    TestHelpers::create_fake_time_varying_modal_data(
+        make_not_null(&spatial_metric_coefficients),
+        make_not_null(&dt_spatial_metric_coefficients),
+        make_not_null(&dr_spatial_metric_coefficients),
+        make_not_null(&shift_coefficients),
+        make_not_null(&dt_shift_coefficients),
+        make_not_null(&dr_shift_coefficients),
+        make_not_null(&lapse_coefficients),
+        make_not_null(&dt_lapse_coefficients),
+        make_not_null(&dr_lapse_coefficients), solution,
+        extraction_radius.value_or(default_extraction_radius), amplitude,
+        frequency, time, l_max, false);
+
+    create_bondi_boundary_data(
+        make_not_null(&expected_boundary_variables),
+        spatial_metric_coefficients, dt_spatial_metric_coefficients,
+        dr_spatial_metric_coefficients,
+        shift_coefficients, dt_shift_coefficients, dr_shift_coefficients,
+        lapse_coefficients, dt_lapse_coefficients, dr_lapse_coefficients,
+        extraction_radius.value_or(default_extraction_radius), l_max);
+    Approx angular_derivative_approx =
+        Approx::custom()
+            .epsilon(std::numeric_limits<double>::epsilon() * 1.0e4)
+            .scale(1.0);
+
+    tmpl::for_each<
+        Tags::characteristic_worldtube_boundary_tags<Tags::BoundaryValue>>(
+        [&expected_boundary_variables, &interpolated_boundary_variables,
+         &angular_derivative_approx](auto tag_v) {
+          using tag = typename decltype(tag_v)::type;
+          INFO(db::tag_name<tag>());
+          const auto& test_lhs = get<tag>(expected_boundary_variables);
+          const auto& test_rhs = get<tag>(interpolated_boundary_variables);
+          CHECK_ITERABLE_CUSTOM_APPROX(test_lhs, test_rhs,
+                                       angular_derivative_approx);
+        });
+  }
+  CHECK(boundary_data_manager.get_io_wait_time() >= 0.0);
 }
 
 template <typename Generator>
@@ -638,6 +664,22 @@ void test_reduced_spec_worldtube_buffer_updater(
   ComplexModalVector output_libsharp_mode_buffer{
       Spectral::Swsh::size_of_libsharp_coefficient_vector(file_l_max)};
 
+  using reduced_boundary_tags =
+      tmpl::list<Cce::Tags::BoundaryValue<Cce::Tags::BondiBeta>,
+                 Cce::Tags::BoundaryValue<Cce::Tags::BondiU>,
+                 Cce::Tags::BoundaryValue<Cce::Tags::BondiQ>,
+                 Cce::Tags::BoundaryValue<Cce::Tags::BondiW>,
+                 Cce::Tags::BoundaryValue<Cce::Tags::BondiJ>,
+                 Cce::Tags::BoundaryValue<Cce::Tags::Dr<Cce::Tags::BondiJ>>,
+                 Cce::Tags::BoundaryValue<Cce::Tags::Du<Cce::Tags::BondiJ>>,
+                 Cce::Tags::BoundaryValue<Cce::Tags::BondiR>,
+                 Cce::Tags::BoundaryValue<Cce::Tags::Du<Cce::Tags::BondiR>>>;
+  // For one of the files, the rows are written in a single chunk per dataset
+  // after all times have been computed, as is done by ReduceCceWorldtube.
+  const bool write_rows_in_chunks = extraction_radius_in_filename;
+  std::unordered_map<std::string, std::vector<std::vector<double>>>
+      chunked_rows{};
+
   // scoped to close the file
   {
     Cce::ReducedWorldtubeModeRecorder recorder{filename};
@@ -662,21 +704,11 @@ void test_reduced_spec_worldtube_buffer_updater(
           lapse_coefficients, dt_lapse_coefficients, dr_lapse_coefficients,
           extraction_radius, file_l_max);
 
-      using reduced_boundary_tags = tmpl::list<
-          Cce::Tags::BoundaryValue<Cce::Tags::BondiBeta>,
-          Cce::Tags::BoundaryValue<Cce::Tags::BondiU>,
-          Cce::Tags::BoundaryValue<Cce::Tags::BondiQ>,
-          Cce::Tags::BoundaryValue<Cce::Tags::BondiW>,
-          Cce::Tags::BoundaryValue<Cce::Tags::BondiJ>,
-          Cce::Tags::BoundaryValue<Cce::Tags::Dr<Cce::Tags::BondiJ>>,
-          Cce::Tags::BoundaryValue<Cce::Tags::Du<Cce::Tags::BondiJ>>,
-          Cce::Tags::BoundaryValue<Cce::Tags::BondiR>,
-          Cce::Tags::BoundaryValue<Cce::Tags::Du<Cce::Tags::BondiR>>>;
-
       // loop over the tags that we want to dump.
       tmpl::for_each<reduced_boundary_tags>(
           [&recorder, &boundary_data_variables, &output_goldberg_mode_buffer,
-           &output_libsharp_mode_buffer, &file_l_max, &time](auto tag_v) {
+           &output_libsharp_mode_buffer, &file_l_max, &time,
+           &write_rows_in_chunks, &chunked_rows](auto tag_v) {
             using tag = typename decltype(tag_v)::type;
             SpinWeighted<ComplexModalVector, tag::type::type::spin>
                 spin_weighted_libsharp_view;
@@ -696,12 +728,27 @@ void test_reduced_spec_worldtube_buffer_updater(
                 make_not_null(&spin_weighted_goldberg_view),
                 spin_weighted_libsharp_view, file_l_max);
 
-            recorder.append_worldtube_mode_data(
-                "/" + dataset_label_for_tag<tag>(), time,
-                output_goldberg_mode_buffer, file_l_max,
-                tag::type::type::spin == 0);
+            if (write_rows_in_chunks) {
+              chunked_rows["/" + dataset_label_for_tag<tag>()].push_back(
+                  Cce::ReducedWorldtubeModeRecorder::worldtube_mode_data_row(
+                      time, output_goldberg_mode_buffer, file_l_max,
+                      tag::type::type::spin == 0));
+            } else {
+              recorder.append_worldtube_mode_data(
+                  "/" + dataset_label_for_tag<tag>(), time,
+                  output_goldberg_mode_buffer, file_l_max,
+                  tag::type::type::spin == 0);
+            }
           });
     }
+    tmpl::for_each<reduced_boundary_tags>(
+        [&recorder, &chunked_rows, &file_l_max](auto tag_v) {
+          using tag = typename decltype(tag_v)::type;
+          recorder.append_worldtube_mode_data(
+              "/" + dataset_label_for_tag<tag>(),
+              chunked_rows["/" + dataset_label_for_tag<tag>()], file_l_max,
+              tag::type::type::spin == 0);
+        });
   }
   // request an appropriate buffer
   auto buffer_updater =
@@ -820,6 +867,13 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.ReadBoundaryDataH5",
     test_data_manager_with_dummy_buffer_updater<BondiWorldtubeDataManager,
                                                 ReducedDummyBufferUpdater>(
         make_not_null(&gen));
+    // with the next buffer read on a background thread
+    test_data_manager_with_dummy_buffer_updater<MetricWorldtubeDataManager,
+                                                DummyBufferUpdater>(
+        make_not_null(&gen), false, true, std::nullopt, true);
+    test_data_manager_with_dummy_buffer_updater<BondiWorldtubeDataManager,
+                                                ReducedDummyBufferUpdater>(
+        make_not_null(&gen), false, true, std::nullopt, true);
   }
 }
 }  // namespace Cce
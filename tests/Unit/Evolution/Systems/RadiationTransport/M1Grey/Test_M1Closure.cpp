@@ -19,6 +19,107 @@
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 
+namespace {
+// Compare the batched closure computation with the point-by-point one, for
+// moments ranging from the optically thick to the optically thin regime and
+// fluid velocities ranging from zero to mildly relativistic.
+void test_batched_closure_matches_pointwise() {
+  const size_t number_of_points = 60;
+  const DataVector used_for_size(number_of_points);
+  Scalar<DataVector> energy_density(used_for_size);
+  tnsr::i<DataVector, 3, Frame::Inertial> momentum_density(used_for_size);
+  tnsr::I<DataVector, 3, Frame::Inertial> fluid_velocity(used_for_size);
+  tnsr::ii<DataVector, 3, Frame::Inertial> spatial_metric(used_for_size);
+  for (size_t m = 0; m < 3; m++) {
+    spatial_metric.get(m, m) = 1. + 0.1 * m * m;
+    for (size_t n = m + 1; n < 3; n++) {
+      spatial_metric.get(m, n) = 0.1 * (m + n);
+    }
+  }
+  for (size_t s = 0; s < number_of_points; ++s) {
+    const double speed = 0.1 * static_cast<double>(s / 10);
+    get(energy_density)[s] = 1. + 0.1 * static_cast<double>(s % 7);
+    for (size_t m = 0; m < 3; m++) {
+      fluid_velocity.get(m)[s] = speed * (0.5 - 0.2 * m);
+      momentum_density.get(m)[s] = 0.4 + 0.3 * m - 0.1 * (s % 3);
+    }
+  }
+  const auto det_and_inv = determinant_and_inverse(spatial_metric);
+  const auto& inv_spatial_metric = det_and_inv.second;
+  // Scale the momentum density to the chosen fraction of the energy density
+  const auto momentum_magnitude =
+      magnitude(momentum_density, inv_spatial_metric);
+  for (size_t s = 0; s < number_of_points; ++s) {
+    const double flux_fraction =
+        static_cast<double>(s % 10) / 10. + 0.005 * static_cast<double>(s / 10);
+    for (size_t m = 0; m < 3; m++) {
+      momentum_density.get(m)[s] *= flux_fraction * get(energy_density)[s] /
+                                    get(momentum_magnitude)[s];
+    }
+  }
+  Scalar<DataVector> fluid_lorentz_factor(
+      1. / sqrt(1. - get(dot_product(fluid_velocity, fluid_velocity,
+                                     spatial_metric))));
+
+  Scalar<DataVector> closure_factor(number_of_points, -1.);
+  tnsr::II<DataVector, 3, Frame::Inertial> pressure_tensor(used_for_size);
+  Scalar<DataVector> comoving_energy_density(used_for_size);
+  Scalar<DataVector> comoving_momentum_density_normal(used_for_size);
+  tnsr::i<DataVector, 3, Frame::Inertial> comoving_momentum_density_spatial(
+      used_for_size);
+  auto expected_closure_factor = closure_factor;
+  auto expected_pressure_tensor = pressure_tensor;
+  auto expected_comoving_energy_density = comoving_energy_density;
+  auto expected_comoving_momentum_density_normal =
+      comoving_momentum_density_normal;
+  auto expected_comoving_momentum_density_spatial =
+      comoving_momentum_density_spatial;
+
+  RadiationTransport::M1Grey::detail::compute_closure_impl(
+      make_not_null(&closure_factor), make_not_null(&pressure_tensor),
+      make_not_null(&comoving_energy_density),
+      make_not_null(&comoving_momentum_density_normal),
+      make_not_null(&comoving_momentum_density_spatial), energy_density,
+      momentum_density, fluid_velocity, fluid_lorentz_factor, spatial_metric,
+      inv_spatial_metric);
+  RadiationTransport::M1Grey::detail::compute_closure_impl_pointwise(
+      make_not_null(&expected_closure_factor),
+      make_not_null(&expected_pressure_tensor),
+      make_not_null(&expected_comoving_energy_density),
+      make_not_null(&expected_comoving_momentum_density_normal),
+      make_not_null(&expected_comoving_momentum_density_spatial),
+      energy_density, momentum_density, fluid_velocity, fluid_lorentz_factor,
+      spatial_metric, inv_spatial_metric);
+
+  // Both root finds are accurate to about 6 digits
+  Approx custom_approx = Approx::custom().epsilon(1.e-5).scale(1.0);
+  CHECK_ITERABLE_CUSTOM_APPROX(closure_factor, expected_closure_factor,
+                               custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(pressure_tensor, expected_pressure_tensor,
+                               custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(comoving_energy_density,
+                               expected_comoving_energy_density, custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(comoving_momentum_density_normal,
+                               expected_comoving_momentum_density_normal,
+                               custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(comoving_momentum_density_spatial,
+                               expected_comoving_momentum_density_spatial,
+                               custom_approx);
+
+  // Using the converged closure factor as initial guess reproduces it
+  const auto previous_closure_factor = closure_factor;
+  RadiationTransport::M1Grey::detail::compute_closure_impl(
+      make_not_null(&closure_factor), make_not_null(&pressure_tensor),
+      make_not_null(&comoving_energy_density),
+      make_not_null(&comoving_momentum_density_normal),
+      make_not_null(&comoving_momentum_density_spatial), energy_density,
+      momentum_density, fluid_velocity, fluid_lorentz_factor, spatial_metric,
+      inv_spatial_metric);
+  CHECK_ITERABLE_CUSTOM_APPROX(closure_factor, previous_closure_factor,
+                               custom_approx);
+}
+}  // namespace
+
 // Test M1 closure function
 SPECTRE_TEST_CASE("Evolution.Systems.RadiationTransport.M1Grey.M1Closure",
                   "[Unit][M1Grey]") {
@@ -97,4 +198,6 @@ SPECTRE_TEST_CASE("Evolution.Systems.RadiationTransport.M1Grey.M1Closure",
   const DataVector expected_xi1{1.0, 1.0, 1.0, 1.0, 1.0};
   CHECK_ITERABLE_CUSTOM_APPROX(get(closure_factor), expected_xi1,
                                custom_approx);
+
+  test_batched_closure_matches_pointwise();
 }
@@ -8,6 +8,7 @@
 #include <optional>
 #include <ostream>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <vector>
@@ -1679,6 +1680,16 @@ void test_impl(const Spectral::Quadrature quadrature,
           make_not_null(&local_face_det_jacobian));
       CHECK_ITERABLE_APPROX(local_face_det_jacobian,
                             expected_local_face_det_jacobian);
+
+      // The Jacobian determinants are cached in the DataBox for later steps
+      const auto& local_geometric_quantities =
+          get_tag(::evolution::dg::Tags::LocalGeometricQuantities<Dim>{});
+      REQUIRE(local_geometric_quantities.has_value());
+      CHECK(std::get<0>(*local_geometric_quantities) == mesh);
+      CHECK(std::get<1>(*local_geometric_quantities) == det_inv_jacobian);
+      CHECK_ITERABLE_APPROX(
+          std::get<2>(*local_geometric_quantities).at(mortar_id.first),
+          expected_local_face_det_jacobian);
     }
   };
   if (LocalTimeStepping) {
@@ -21,6 +21,7 @@
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
 #include "Framework/ActionTesting.hpp"
+#include "IO/H5/ModalCompression.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/ObservationId.hpp"
 #include "IO/Observer/ObserverComponent.hpp"
@@ -234,13 +235,15 @@ struct ScalarSystem {
       "Error(Scalar)]\n"
       "  FloatingPointTypes: [Double]\n";
   static ObserveEvent make_test_object(
-      const std::optional<Mesh<volume_dim>>& interpolating_mesh) {
+      const std::optional<Mesh<volume_dim>>& interpolating_mesh,
+      const std::optional<h5::ModalCompression>& modal_compression = {}) {
     return ObserveEvent{
         "element_data",
         FloatingPointType::Double,
         {FloatingPointType::Double},
         {"Scalar", "ScalarVarTimesTwo", "ScalarVarTimesThree", "Error(Scalar)"},
-        interpolating_mesh};
+        interpolating_mesh,
+        modal_compression};
   }
 };
 
@@ -355,7 +358,8 @@ struct ComplicatedSystem {
       "                       Double, Float]\n";
 
   static ObserveEvent make_test_object(
-      const std::optional<Mesh<volume_dim>>& interpolating_mesh) {
+      const std::optional<Mesh<volume_dim>>& interpolating_mesh,
+      const std::optional<h5::ModalCompression>& modal_compression = {}) {
     return ObserveEvent(
         "element_data", FloatingPointType::Double,
         {FloatingPointType::Double, FloatingPointType::Double,
@@ -364,7 +368,7 @@ struct ComplicatedSystem {
          FloatingPointType::Double, FloatingPointType::Float},
         {"Scalar", "ScalarVarTimesTwo", "ScalarVarTimesThree", "Vector",
          "Tensor", "Tensor2", "Error(Vector)", "Error(Tensor2)"},
-        interpolating_mesh);
+        interpolating_mesh, modal_compression);
   }
 };
 }  // namespace TestHelpers::dg::Events::ObserveFields
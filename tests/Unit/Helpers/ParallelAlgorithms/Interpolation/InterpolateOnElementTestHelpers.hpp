@@ -5,9 +5,11 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <random>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
@@ -27,6 +29,7 @@
 #include "Parallel/PhaseDependentActionList.hpp"
 #include "ParallelAlgorithms/Interpolation/Actions/InterpolationTargetVarsFromElement.hpp"
 #include "ParallelAlgorithms/Interpolation/InterpolationTarget.hpp"
+#include "ParallelAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
 #include "ParallelAlgorithms/Interpolation/PointInfoTag.hpp"
 #include "ParallelAlgorithms/Interpolation/Protocols/ComputeVarsToInterpolate.hpp"
 #include "ParallelAlgorithms/Interpolation/Protocols/InterpolationTargetTag.hpp"
@@ -56,6 +59,10 @@ struct TestTargetPoints : db::SimpleTag {
 struct MultiplyByTwo : db::SimpleTag {
   using type = Scalar<DataVector>;
 };
+// Tag holding the indices of the target points that have been received.
+struct ReceivedPoints : db::SimpleTag {
+  using type = std::vector<size_t>;
+};
 // Compute tag for test.
 struct MultiplyByTwoCompute : MultiplyByTwo, db::ComputeTag {
   static void function(const gsl::not_null<Scalar<DataVector>*> result,
@@ -126,7 +133,7 @@ struct MockInterpolationTargetVarsFromElement {
       const std::vector<std::optional<
           IdPair<domain::BlockId, tnsr::I<double, Metavariables::volume_dim,
                                           typename ::Frame::BlockLogical>>>>&
-      /*block_logical_coords*/,
+          block_logical_coords,
       const std::vector<std::vector<size_t>>& global_offsets,
       const TemporalId& /*temporal_id*/) {
     CHECK(global_offsets.size() == vars_src.size());
@@ -134,6 +141,16 @@ struct MockInterpolationTargetVarsFromElement {
     // directly from the elements; the outer vector is used only by
     // the Interpolator parallel component.
     CHECK(global_offsets.size() == 1);
+    // Each target (or shard of a target) only receives the coordinates of
+    // its own points
+    CHECK(block_logical_coords.size() ==
+          get<0>(db::get<Tags::TestTargetPoints>(box)).size());
+    db::mutate<Tags::ReceivedPoints>(
+        make_not_null(&box),
+        [&global_offsets](const gsl::not_null<std::vector<size_t>*> received) {
+          received->insert(received->end(), global_offsets[0].begin(),
+                           global_offsets[0].end());
+        });
 
     // Here we have received only some of the points.
     const size_t num_pts_received = global_offsets[0].size();
@@ -179,7 +196,7 @@ struct mock_interpolation_target {
   using array_index = size_t;
   using component_being_mocked =
       intrp::InterpolationTarget<Metavariables, InterpolationTargetTag>;
-  using simple_tags = tmpl::list<Tags::TestTargetPoints>;
+  using simple_tags = tmpl::list<Tags::TestTargetPoints, Tags::ReceivedPoints>;
   using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
       Parallel::Phase::Initialization,
       tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>>;
@@ -299,10 +316,29 @@ void test_interpolate_on_element(
     }
   }();
 
+  // Emplace target component. A sharded target holds one shard per array
+  // element, each of which only knows its own points.
+  constexpr size_t number_of_shards =
+      intrp::InterpolationTarget_detail::number_of_shards<
+          typename metavars::InterpolationTargetA>;
   ActionTesting::set_phase(make_not_null(&runner),
                            Parallel::Phase::Initialization);
-  ActionTesting::emplace_component_and_initialize<target_component>(
-      &runner, 0, {target_points});
+  std::vector<tnsr::I<DataVector, 3, Frame::Inertial>> points_of_shards{};
+  for (size_t shard = 0; shard < number_of_shards; ++shard) {
+    const auto [first_point, end_point] =
+        intrp::InterpolationTarget_detail::shard_point_range(
+            num_points, number_of_shards, shard);
+    tnsr::I<DataVector, 3, Frame::Inertial> shard_points(end_point -
+                                                         first_point);
+    for (size_t d = 0; d < 3; ++d) {
+      for (size_t i = first_point; i < end_point; ++i) {
+        shard_points.get(d)[i - first_point] = target_points.get(d)[i];
+      }
+    }
+    points_of_shards.push_back(shard_points);
+    ActionTesting::emplace_component_and_initialize<target_component>(
+        &runner, shard, {std::move(shard_points), std::vector<size_t>{}});
+  }
 
   static_assert(
       std::is_same_v<typename metavars::InterpolationTargetA::temporal_id::type,
@@ -328,9 +364,37 @@ void test_interpolate_on_element(
   // Only some of the actions/events just invoked on elements (those
   // elements which contain target points) will queue a simple action on the
   // InterpolationTarget.  Invoke those simple actions now.
-  while (not ActionTesting::is_simple_action_queue_empty<target_component>(
-      runner, 0)) {
-    runner.template invoke_queued_simple_action<target_component>(0);
+  // Every point of each shard that is in the domain is received exactly once.
+  for (size_t shard = 0; shard < number_of_shards; ++shard) {
+    while (not ActionTesting::is_simple_action_queue_empty<target_component>(
+        runner, shard)) {
+      runner.template invoke_queued_simple_action<target_component>(shard);
+    }
+    const auto block_logical_coords = [&points_of_shards, &runner, &shard,
+                                       &temporal_id]() {
+      const auto& cache = ActionTesting::cache<target_component>(runner, shard);
+      if constexpr (std::is_same_v<typename metavars::InterpolationTargetA::
+                                       temporal_id::type,
+                                   double>) {
+        return intrp::InterpolationTarget_detail::block_logical_coords<
+            typename metavars::InterpolationTargetA>(
+            cache, points_of_shards[shard], temporal_id.substep_time().value());
+      } else {
+        return intrp::InterpolationTarget_detail::block_logical_coords<
+            typename metavars::InterpolationTargetA>(
+            cache, points_of_shards[shard], temporal_id);
+      }
+    }();
+    std::vector<size_t> expected_points{};
+    for (size_t i = 0; i < block_logical_coords.size(); ++i) {
+      if (block_logical_coords[i].has_value()) {
+        expected_points.push_back(i);
+      }
+    }
+    auto received_points = ActionTesting::get_databox_tag<
+        target_component, Tags::ReceivedPoints>(runner, shard);
+    std::sort(received_points.begin(), received_points.end());
+    CHECK(received_points == expected_points);
   }
 }
 }  // namespace InterpolateOnElementTestHelpers
@@ -0,0 +1,167 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/ModalVector.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "IO/H5/ModalCompression.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+
+namespace {
+void test_options() {
+  const auto modal_compression =
+      TestHelpers::test_creation<h5::ModalCompression>(
+          "AbsoluteTolerance: 1.e-8\n"
+          "RelativeTolerance: 1.e-4\n");
+  CHECK(modal_compression == h5::ModalCompression{1.e-8, 1.e-4});
+  CHECK(modal_compression != h5::ModalCompression{1.e-8, 1.e-3});
+  CHECK(modal_compression.error_bound(2.) == approx(1.e-8 + 2.e-4));
+  test_serialization(modal_compression);
+}
+
+void test_is_modally_compressible() {
+  CHECK(h5::is_modally_compressible(
+      {Spectral::Basis::Legendre, Spectral::Basis::Chebyshev}));
+  CHECK_FALSE(h5::is_modally_compressible(
+      {Spectral::Basis::Legendre, Spectral::Basis::FiniteDifference}));
+  CHECK_FALSE(
+      h5::is_modally_compressible({Spectral::Basis::SphericalHarmonic,
+                                   Spectral::Basis::SphericalHarmonic}));
+}
+
+void test_truncate_1d() {
+  const ModalVector modal_coefficients{1., 0.5, 1.e-3, 1.e-6};
+  const std::vector<size_t> extents{4};
+  {
+    const auto [retained_extents, retained_modes] =
+        h5::truncate_modes(modal_coefficients, extents, 1.e-5);
+    CHECK(retained_extents == std::vector<size_t>{3});
+    CHECK(retained_modes == DataVector{1., 0.5, 1.e-3});
+  }
+  {
+    const auto [retained_extents, retained_modes] =
+        h5::truncate_modes(modal_coefficients, extents, 2.e-3);
+    CHECK(retained_extents == std::vector<size_t>{2});
+    CHECK(retained_modes == DataVector{1., 0.5});
+  }
+  {
+    // The rounding error of the retained modes counts towards the bound
+    const auto [retained_extents, retained_modes] =
+        h5::truncate_modes(modal_coefficients, extents, 2.e-3, 1.e-3);
+    CHECK(retained_extents == std::vector<size_t>{3});
+    CHECK(retained_modes == DataVector{1., 0.5, 1.e-3});
+  }
+  {
+    // No modes are dropped if the rounding error alone exceeds the bound
+    const auto [retained_extents, retained_modes] =
+        h5::truncate_modes(modal_coefficients, extents, 1.e-4, 1.e-3);
+    CHECK(retained_extents == extents);
+  }
+  {
+    // At least one mode is always retained
+    const auto [retained_extents, retained_modes] =
+        h5::truncate_modes(modal_coefficients, extents, 10.);
+    CHECK(retained_extents == std::vector<size_t>{1});
+    CHECK(retained_modes == DataVector{1.});
+  }
+  {
+    // Vanishing modes are dropped without error
+    const auto [retained_extents, retained_modes] =
+        h5::truncate_modes(ModalVector{1., 2., 0., 0.}, extents, 0.);
+    CHECK(retained_extents == std::vector<size_t>{2});
+    CHECK(retained_modes == DataVector{1., 2.});
+  }
+}
+
+void test_truncate_2d() {
+  // Only the modes (i, j) with i < 2 and j < 3 are nonzero
+  const std::vector<size_t> extents{3, 4};
+  ModalVector modal_coefficients(12, 0.);
+  DataVector expected_retained_modes(6);
+  for (size_t j = 0; j < 3; ++j) {
+    for (size_t i = 0; i < 2; ++i) {
+      modal_coefficients[i + 3 * j] = 1. + static_cast<double>(i + 2 * j);
+      expected_retained_modes[i + 2 * j] = modal_coefficients[i + 3 * j];
+    }
+  }
+  const auto [retained_extents, retained_modes] =
+      h5::truncate_modes(modal_coefficients, extents, 0.);
+  CHECK(retained_extents == std::vector<size_t>{2, 3});
+  CHECK(retained_modes == expected_retained_modes);
+}
+
+void test_error_bound() {
+  // Truncate decaying modes and check the error of the reconstructed data
+  const std::vector<size_t> extents{6, 5, 4};
+  const std::vector<Spectral::Basis> bases{Spectral::Basis::Legendre,
+                                           Spectral::Basis::Chebyshev,
+                                           Spectral::Basis::Legendre};
+  const std::vector<Spectral::Quadrature> quadratures{
+      Spectral::Quadrature::GaussLobatto, Spectral::Quadrature::Gauss,
+      Spectral::Quadrature::Gauss};
+  ModalVector modal_coefficients(120);
+  DataVector full_modes(120);
+  for (size_t k = 0; k < 4; ++k) {
+    for (size_t j = 0; j < 5; ++j) {
+      for (size_t i = 0; i < 6; ++i) {
+        const size_t offset = i + 6 * (j + 5 * k);
+        modal_coefficients[offset] =
+            (offset % 2 == 0 ? 1. : -1.) *
+            pow(10., -static_cast<double>(i + 2 * j + k));
+        full_modes[offset] = modal_coefficients[offset];
+      }
+    }
+  }
+  const DataVector nodal_data = h5::nodal_data_from_truncated_modes(
+      full_modes, extents, extents, bases, quadratures);
+  for (const double error_bound : {1.e-2, 1.e-4, 1.e-8}) {
+    CAPTURE(error_bound);
+    const auto [retained_extents, retained_modes] =
+        h5::truncate_modes(modal_coefficients, extents, error_bound);
+    CHECK(retained_modes.size() < modal_coefficients.size());
+    const DataVector reconstructed = h5::nodal_data_from_truncated_modes(
+        retained_modes, retained_extents, extents, bases, quadratures);
+    CHECK(max(abs(reconstructed - nodal_data)) <= error_bound);
+  }
+  // The bound also holds when the retained modes are rounded to single
+  // precision
+  const double float_roundoff = 0.5 * std::numeric_limits<float>::epsilon();
+  for (const double error_bound : {1.e-2, 1.e-4}) {
+    CAPTURE(error_bound);
+    auto [retained_extents, retained_modes] = h5::truncate_modes(
+        modal_coefficients, extents, error_bound, float_roundoff);
+    CHECK(retained_modes.size() < modal_coefficients.size());
+    for (double& mode : retained_modes) {
+      mode = static_cast<double>(static_cast<float>(mode));
+    }
+    const DataVector reconstructed = h5::nodal_data_from_truncated_modes(
+        retained_modes, retained_extents, extents, bases, quadratures);
+    CHECK(max(abs(reconstructed - nodal_data)) <= error_bound);
+  }
+
+  // Data on grids that are not modally compressible is returned unchanged
+  const DataVector fd_data{1., 2., 3., 4.};
+  CHECK(h5::nodal_data_from_truncated_modes(
+            fd_data, {2, 2}, {2, 2},
+            {Spectral::Basis::FiniteDifference,
+             Spectral::Basis::FiniteDifference},
+            {Spectral::Quadrature::CellCentered,
+             Spectral::Quadrature::CellCentered}) == fd_data);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.H5.ModalCompression", "[Unit][IO][H5]") {
+  test_options();
+  test_is_modally_compressible();
+  test_truncate_1d();
+  test_truncate_2d();
+  test_error_bound();
+}
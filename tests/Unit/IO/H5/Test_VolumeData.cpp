@@ -3,21 +3,31 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
+#include <hdf5.h>
 #include <memory>
+#include <optional>
 #include <string>
+#include <variant>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ModalVector.hpp"
 #include "DataStructures/Tensor/TensorData.hpp"
 #include "Helpers/IO/VolumeData.hpp"
 #include "IO/H5/AccessType.hpp"
 #include "IO/H5/File.hpp"
+#include "IO/H5/Helpers.hpp"
+#include "IO/H5/ModalCompression.hpp"
+#include "IO/H5/OpenGroup.hpp"
 #include "IO/H5/VolumeData.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Strahlkorper.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/YlmSpherepack.hpp"
+#include "Utilities/Algorithm.hpp"
 #include "Utilities/FileSystem.hpp"
 
 namespace {
@@ -93,6 +103,358 @@ void test_strahlkorper() {
   }
 }
 
+void test_modal_compression() {
+  const std::string h5_file_name("Unit.IO.H5.VolumeData.ModalCompression.h5");
+  const uint32_t version_number = 4;
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+
+  // A spectral element with smooth data that is written as truncated modal
+  // coefficients, and a finite-difference element whose data is written as
+  // nodal values
+  const std::vector<size_t> spectral_extents{4, 3};
+  const std::vector<Spectral::Basis> spectral_bases{
+      Spectral::Basis::Legendre, Spectral::Basis::Chebyshev};
+  const std::vector<Spectral::Quadrature> spectral_quadratures{
+      Spectral::Quadrature::GaussLobatto, Spectral::Quadrature::Gauss};
+  ModalVector modal_coefficients(12, 0.0);
+  modal_coefficients[0] = 1.0;
+  modal_coefficients[1] = -2.0;
+  modal_coefficients[6] = 0.5;
+  DataVector full_modes(12);
+  std::copy(modal_coefficients.begin(), modal_coefficients.end(),
+            full_modes.begin());
+  const DataVector spectral_nodal_data = h5::nodal_data_from_truncated_modes(
+      full_modes, spectral_extents, spectral_extents, spectral_bases,
+      spectral_quadratures);
+  const auto [retained_extents, retained_modes] =
+      h5::truncate_modes(modal_coefficients, spectral_extents, 0.0);
+  CHECK(retained_extents == std::vector<size_t>{3, 2});
+
+  const std::vector<size_t> fd_extents{2, 2};
+  const std::vector<Spectral::Basis> fd_bases{
+      2, Spectral::Basis::FiniteDifference};
+  const std::vector<Spectral::Quadrature> fd_quadratures{
+      2, Spectral::Quadrature::CellCentered};
+  const DataVector fd_nodal_data{1.0, 2.0, 3.0, 4.0};
+
+  const DataVector spectral_coords(12, 1.0);
+  const DataVector fd_coords(4, 2.0);
+  {
+    h5::H5File<h5::AccessType::ReadWrite> h5_file(h5_file_name);
+    auto& volume_file =
+        h5_file.insert<h5::VolumeData>("/element_data", version_number);
+    volume_file.write_volume_data(
+        100, 1.0,
+        {{spectral_extents,
+          {TensorComponent{"Psi", retained_modes, retained_extents},
+           TensorComponent{"x", spectral_coords}},
+          spectral_bases,
+          spectral_quadratures,
+          "Spectral"},
+         {fd_extents,
+          {TensorComponent{"Psi", fd_nodal_data, fd_extents},
+           TensorComponent{"x", fd_coords}},
+          fd_bases,
+          fd_quadratures,
+          "FD"}});
+  }
+
+  h5::H5File<h5::AccessType::ReadOnly> h5_file(h5_file_name);
+  const auto& volume_file =
+      h5_file.get<h5::VolumeData>("/element_data", version_number);
+  auto tensor_components = volume_file.list_tensor_components(100);
+  alg::sort(tensor_components);
+  CHECK(tensor_components == std::vector<std::string>{"Psi", "x"});
+
+  // The nodal data is reconstructed when reading
+  const auto psi = volume_file.get_tensor_component(100, "Psi");
+  const auto& psi_data = std::get<DataVector>(psi.data);
+  REQUIRE(psi_data.size() == 16);
+  CHECK_ITERABLE_APPROX(DataVector(const_cast<double*>(psi_data.data()), 12),
+                        spectral_nodal_data);
+  CHECK(DataVector(const_cast<double*>(psi_data.data()) + 12, 4) ==
+        fd_nodal_data);
+  const auto psi_on_fd_grid =
+      volume_file.get_tensor_component(100, "Psi", {"FD"});
+  CHECK(std::get<DataVector>(psi_on_fd_grid.data) == fd_nodal_data);
+  const auto psi_on_spectral_grid =
+      volume_file.get_tensor_component(100, "Psi", {"Spectral"});
+  CHECK_ITERABLE_APPROX(std::get<DataVector>(psi_on_spectral_grid.data),
+                        spectral_nodal_data);
+  const auto x = volume_file.get_tensor_component(100, "x");
+  CHECK(std::get<DataVector>(x.data) ==
+        DataVector{1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+                   2.0, 2.0, 2.0, 2.0});
+
+  // Reading data by element also reconstructs the nodal data
+  const auto data_by_element =
+      volume_file.get_data_by_element(std::nullopt, std::nullopt,
+                                      std::vector<std::string>{"Psi"});
+  REQUIRE(data_by_element.size() == 1);
+  const auto& elements = std::get<2>(data_by_element[0]);
+  REQUIRE(elements.size() == 2);
+  CHECK(elements[0].element_name == "FD");
+  CHECK(std::get<DataVector>(elements[0].tensor_components[0].data) ==
+        fd_nodal_data);
+  CHECK_ITERABLE_APPROX(
+      std::get<DataVector>(elements[1].tensor_components[0].data),
+      spectral_nodal_data);
+
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
+
+void test_shared_topology() {
+  const std::string h5_file_name("Unit.IO.H5.VolumeData.SharedTopology.h5");
+  const uint32_t version_number = 4;
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+
+  const std::vector<Spectral::Basis> bases{2, Spectral::Basis::Legendre};
+  const std::vector<Spectral::Quadrature> quadratures{
+      2, Spectral::Quadrature::GaussLobatto};
+  const auto make_elements = [&bases, &quadratures](
+                                 const size_t extent, const double value) {
+    const std::vector<size_t> extents{extent, extent};
+    const DataVector data(extent * extent, value);
+    return std::vector<ElementVolumeData>{
+        {extents, {TensorComponent{"x", data}}, bases, quadratures, "A"},
+        {extents, {TensorComponent{"x", 2.0 * data}}, bases, quadratures,
+         "B"}};
+  };
+  // The grids change between observations 1 and 2
+  const std::vector<size_t> observation_extents{2, 2, 3, 3};
+  {
+    h5::H5File<h5::AccessType::ReadWrite> h5_file(h5_file_name);
+    auto& volume_file =
+        h5_file.insert<h5::VolumeData>("/element_data", version_number);
+    for (size_t observation_id = 0; observation_id < 4; ++observation_id) {
+      volume_file.write_volume_data(
+          observation_id, static_cast<double>(observation_id),
+          make_elements(observation_extents[observation_id],
+                        static_cast<double>(observation_id)));
+    }
+  }
+
+  h5::H5File<h5::AccessType::ReadOnly> h5_file(h5_file_name);
+  const auto& volume_file =
+      h5_file.get<h5::VolumeData>("/element_data", version_number);
+  CHECK(volume_file.list_observation_ids() ==
+        std::vector<size_t>{0, 1, 2, 3});
+  CHECK(volume_file.get_topology_observation_id(0) == 0);
+  CHECK(volume_file.get_topology_observation_id(1) == 0);
+  CHECK(volume_file.get_topology_observation_id(2) == 2);
+  CHECK(volume_file.get_topology_observation_id(3) == 2);
+  for (size_t observation_id = 0; observation_id < 4; ++observation_id) {
+    CAPTURE(observation_id);
+    const size_t extent = observation_extents[observation_id];
+    // Every observation holds all topology datasets
+    CHECK(volume_file.list_tensor_components(observation_id) ==
+          std::vector<std::string>{"x"});
+    CHECK(volume_file.get_grid_names(observation_id) ==
+          std::vector<std::string>{"A", "B"});
+    CHECK(volume_file.get_extents(observation_id) ==
+          std::vector<std::vector<size_t>>(2, {extent, extent}));
+    CHECK(volume_file.get_bases(observation_id) ==
+          std::vector<std::vector<std::string>>(
+              2, {"Legendre", "Legendre"}));
+    CHECK(volume_file.get_quadratures(observation_id) ==
+          std::vector<std::vector<std::string>>(
+              2, {"GaussLobatto", "GaussLobatto"}));
+  }
+
+  const auto data_by_element =
+      volume_file.get_data_by_element(std::nullopt, std::nullopt);
+  REQUIRE(data_by_element.size() == 4);
+  for (size_t observation_id = 0; observation_id < 4; ++observation_id) {
+    CAPTURE(observation_id);
+    const auto expected_elements =
+        make_elements(observation_extents[observation_id],
+                      static_cast<double>(observation_id));
+    CHECK(std::get<0>(data_by_element[observation_id]) == observation_id);
+    CHECK(std::get<2>(data_by_element[observation_id]) == expected_elements);
+  }
+
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
+
+std::vector<int> read_connectivity(const std::string& h5_file_name,
+                                   const size_t observation_id) {
+  const hid_t file_id =
+      H5Fopen(h5_file_name.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  std::vector<int> connectivity{};
+  {
+    const h5::detail::OpenGroup observation_group(
+        file_id,
+        "element_data.vol/ObservationId" + std::to_string(observation_id),
+        h5::AccessType::ReadOnly);
+    connectivity = h5::read_data<1, std::vector<int>>(observation_group.id(),
+                                                      "connectivity");
+  }
+  H5Fclose(file_id);
+  return connectivity;
+}
+
+std::vector<size_t> read_modal_extents(const std::string& h5_file_name,
+                                       const size_t observation_id,
+                                       const std::string& tensor_component) {
+  const hid_t file_id =
+      H5Fopen(h5_file_name.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  std::vector<size_t> modal_extents{};
+  {
+    const h5::detail::OpenGroup modal_extents_group(
+        file_id,
+        "element_data.vol/ObservationId" + std::to_string(observation_id) +
+            "/modal_extents",
+        h5::AccessType::ReadOnly);
+    modal_extents = h5::read_data<1, std::vector<size_t>>(
+        modal_extents_group.id(), tensor_component);
+  }
+  H5Fclose(file_id);
+  return modal_extents;
+}
+
+void test_concatenate() {
+  const std::string file_prefix("Unit.IO.H5.VolumeData.Concatenate");
+  const std::array<std::string, 4> h5_file_names{
+      {file_prefix + "0.h5", file_prefix + "1.h5", file_prefix + "Expected.h5",
+       file_prefix + "Combined.h5"}};
+  const uint32_t version_number = 4;
+  for (const auto& h5_file_name : h5_file_names) {
+    if (file_system::check_if_file_exists(h5_file_name)) {
+      file_system::rm(h5_file_name, true);
+    }
+  }
+
+  const std::vector<Spectral::Basis> bases{2, Spectral::Basis::Legendre};
+  const std::vector<Spectral::Quadrature> quadratures{
+      2, Spectral::Quadrature::GaussLobatto};
+  const auto make_element = [&bases, &quadratures](
+                                const std::string& name,
+                                const std::vector<size_t>& extents,
+                                const double value) {
+    const size_t num_points = extents[0] * extents[1];
+    DataVector x(num_points);
+    std::vector<float> y(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+      x[i] = value + static_cast<double>(i);
+      y[i] = static_cast<float>(2.0 * value + static_cast<double>(i));
+    }
+    // A component written as truncated modal coefficients
+    const std::vector<size_t> modal_extents{extents[0] - 1, extents[1]};
+    DataVector z(modal_extents[0] * modal_extents[1]);
+    for (size_t i = 0; i < z.size(); ++i) {
+      z[i] = 3.0 * value - static_cast<double>(i);
+    }
+    return ElementVolumeData{extents,
+                             {TensorComponent{"x", x}, TensorComponent{"y", y},
+                              TensorComponent{"z", z, modal_extents}},
+                             bases,
+                             quadratures,
+                             name};
+  };
+  // The elements of the two files at each observation. The grids of the second
+  // file change between observations 1 and 2.
+  const auto make_elements = [&make_element](const size_t file,
+                                             const size_t observation_id) {
+    const auto value = static_cast<double>(observation_id);
+    if (file == 0) {
+      return std::vector<ElementVolumeData>{
+          make_element("A", {3, 2}, value), make_element("B", {2, 2}, value)};
+    }
+    const size_t extent = observation_id < 2 ? 3 : 4;
+    return std::vector<ElementVolumeData>{
+        make_element("C", {extent, extent}, value)};
+  };
+  for (size_t file = 0; file < 3; ++file) {
+    h5::H5File<h5::AccessType::ReadWrite> h5_file(h5_file_names[file]);
+    auto& volume_file =
+        h5_file.insert<h5::VolumeData>("/element_data", version_number);
+    for (size_t observation_id = 0; observation_id < 3; ++observation_id) {
+      auto elements = make_elements(file == 2 ? 0 : file, observation_id);
+      if (file == 2) {
+        const auto other_elements = make_elements(1, observation_id);
+        elements.insert(elements.end(), other_elements.begin(),
+                        other_elements.end());
+      }
+      volume_file.write_volume_data(observation_id,
+                                    0.5 * static_cast<double>(observation_id),
+                                    elements);
+    }
+  }
+
+  {
+    std::vector<std::unique_ptr<h5::H5File<h5::AccessType::ReadOnly>>>
+        input_files{};
+    std::vector<const h5::VolumeData*> input_volume_files{};
+    for (size_t file = 0; file < 2; ++file) {
+      input_files.push_back(
+          std::make_unique<h5::H5File<h5::AccessType::ReadOnly>>(
+              h5_file_names[file]));
+      input_volume_files.push_back(
+          &input_files.back()->get<h5::VolumeData>("/element_data"));
+    }
+    h5::H5File<h5::AccessType::ReadWrite> h5_file(h5_file_names[3]);
+    auto& volume_file =
+        h5_file.insert<h5::VolumeData>("/element_data", version_number);
+    // Copy the datasets in small pieces to test the buffering
+    for (size_t observation_id = 0; observation_id < 3; ++observation_id) {
+      volume_file.write_concatenated_volume_data(observation_id,
+                                                 input_volume_files, 5);
+    }
+  }
+
+  {
+    const h5::H5File<h5::AccessType::ReadOnly> expected_file(
+        h5_file_names[2]);
+    const auto& expected_volume_file =
+        expected_file.get<h5::VolumeData>("/element_data");
+    const h5::H5File<h5::AccessType::ReadOnly> combined_file(
+        h5_file_names[3]);
+    const auto& combined_volume_file =
+        combined_file.get<h5::VolumeData>("/element_data");
+    CHECK(combined_volume_file.list_observation_ids() ==
+          std::vector<size_t>{0, 1, 2});
+    CHECK(combined_volume_file.get_dimension() == 2);
+    // The topology is shared between the observations that have the same grids
+    CHECK(combined_volume_file.get_topology_observation_id(0) == 0);
+    CHECK(combined_volume_file.get_topology_observation_id(1) == 0);
+    CHECK(combined_volume_file.get_topology_observation_id(2) == 2);
+    for (size_t observation_id = 0; observation_id < 3; ++observation_id) {
+      CAPTURE(observation_id);
+      CHECK(combined_volume_file.get_observation_value(observation_id) ==
+            0.5 * static_cast<double>(observation_id));
+      CHECK(combined_volume_file.get_grid_names(observation_id) ==
+            std::vector<std::string>{"A", "B", "C"});
+      CHECK(combined_volume_file.get_extents(observation_id) ==
+            expected_volume_file.get_extents(observation_id));
+    }
+    CHECK(combined_volume_file.get_data_by_element(std::nullopt,
+                                                   std::nullopt) ==
+          expected_volume_file.get_data_by_element(std::nullopt,
+                                                   std::nullopt));
+  }
+  for (size_t observation_id = 0; observation_id < 3; ++observation_id) {
+    CAPTURE(observation_id);
+    CHECK(read_connectivity(h5_file_names[3], observation_id) ==
+          read_connectivity(h5_file_names[2], observation_id));
+    CHECK(read_modal_extents(h5_file_names[3], observation_id, "z") ==
+          read_modal_extents(h5_file_names[2], observation_id, "z"));
+  }
+
+  for (const auto& h5_file_name : h5_file_names) {
+    if (file_system::check_if_file_exists(h5_file_name)) {
+      file_system::rm(h5_file_name, true);
+    }
+  }
+}
+
 template <typename DataType>
 void test() {
   const std::string h5_file_name("Unit.IO.H5.VolumeData.h5");
@@ -239,6 +601,31 @@ void test() {
     CHECK(last_grid_offset_and_length.second == 8);
   }
 
+  {
+    INFO("get_tensor_component for selected grids");
+    const size_t observation_id = observation_ids.front();
+    const DataType expected_first_grid = TestHelpers::io::VolumeData::multiply(
+        observation_values.front(), tensor_components_and_coords[0]);
+    const DataType expected_last_grid = TestHelpers::io::VolumeData::multiply(
+        observation_values.front(), tensor_components_and_coords[1]);
+    const auto last_grid = volume_file.get_tensor_component(
+        observation_id, "S", {grid_names.back()});
+    CHECK(last_grid.name == "S");
+    CHECK(std::get<DataType>(last_grid.data) == expected_last_grid);
+    const auto reversed_grids = volume_file.get_tensor_component(
+        observation_id, "S", {grid_names.back(), grid_names.front()});
+    const auto& reversed_data = std::get<DataType>(reversed_grids.data);
+    REQUIRE(reversed_data.size() == 16);
+    for (size_t i = 0; i < 8; ++i) {
+      CHECK(reversed_data[i] == expected_last_grid[i]);
+      CHECK(reversed_data[i + 8] == expected_first_grid[i]);
+    }
+    const auto all_grids = volume_file.get_tensor_component(
+        observation_id, "S", {grid_names.front(), grid_names.back()});
+    CHECK(all_grids.data ==
+          volume_file.get_tensor_component(observation_id, "S").data);
+  }
+
   if (file_system::check_if_file_exists(h5_file_name)) {
     file_system::rm(h5_file_name, true);
   }
@@ -249,6 +636,36 @@ SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData", "[Unit][IO][H5]") {
   test<DataVector>();
   test<std::vector<float>>();
   test_strahlkorper();
+  test_modal_compression();
+  test_shared_topology();
+  test_concatenate();
+
+  CHECK_THROWS_WITH(
+      []() {
+        const std::string h5_file_name(
+            "Unit.IO.H5.VolumeData.MixedModalAndNodal.h5");
+        const uint32_t version_number = 4;
+        if (file_system::check_if_file_exists(h5_file_name)) {
+          file_system::rm(h5_file_name, true);
+        }
+        h5::H5File<h5::AccessType::ReadWrite> h5_file(h5_file_name);
+        auto& volume_file =
+            h5_file.insert<h5::VolumeData>("/element_data", version_number);
+        volume_file.write_volume_data(
+            100, 10.0,
+            {{{2},
+              {TensorComponent{"S", DataVector{1.0}, {1}}},
+              {Spectral::Basis::Legendre},
+              {Spectral::Quadrature::Gauss},
+              "grid0"},
+             {{2},
+              {TensorComponent{"S", DataVector{1.0, 2.0}}},
+              {Spectral::Basis::Legendre},
+              {Spectral::Quadrature::Gauss},
+              "grid1"}});
+      }(),
+      Catch::Contains("must be written either as modal coefficients on all "
+                      "elements or as nodal values on all elements"));
 
 #ifdef SPECTRE_DEBUG
   CHECK_THROWS_WITH(
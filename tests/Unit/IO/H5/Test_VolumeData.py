@@ -164,6 +164,46 @@ class TestVolumeData(unittest.TestCase):
                         tensor_component=expected_tensor_component_names[i]).
                     data)[0:8], expected_tensor_component_data)
 
+    # Test that only the requested grids are read and that the data can be
+    # viewed as a NumPy array without copying it
+    def test_tensor_components_on_grids(self):
+        obs_id = 0
+        component = self.vol_file.get_tensor_component(
+            observation_id=obs_id,
+            tensor_component="field_1",
+            grid_names=["grid_2"])
+        self.assertEqual(component.name, "field_1")
+        component_data = np.asarray(component)
+        self.assertFalse(component_data.flags.writeable)
+        self.assertFalse(component_data.flags.owndata)
+        npt.assert_almost_equal(component_data,
+                                self.tensor_component_data[1])
+        reversed_grids = np.asarray(
+            self.vol_file.get_tensor_component(
+                observation_id=obs_id,
+                tensor_component="field_1",
+                grid_names=["grid_2", "grid_1"]))
+        npt.assert_almost_equal(reversed_grids[0:8],
+                                self.tensor_component_data[1])
+        npt.assert_almost_equal(reversed_grids[8:16],
+                                self.tensor_component_data[0])
+        # Converting or copying the data yields a writable array
+        copied_data = component.__array__(copy=True)
+        self.assertTrue(copied_data.flags.writeable)
+        self.assertTrue(copied_data.flags.owndata)
+        npt.assert_equal(copied_data, component_data)
+        float_data = np.array(component, dtype=np.float32)
+        self.assertEqual(float_data.dtype, np.float32)
+        self.assertTrue(float_data.flags.writeable)
+        npt.assert_almost_equal(float_data,
+                                self.tensor_component_data[1],
+                                decimal=5)
+        self.assertEqual(
+            component.__array__(dtype=np.float64, copy=False).dtype,
+            np.float64)
+        with self.assertRaisesRegex(ValueError, 'without a copy'):
+            component.__array__(dtype=np.float32, copy=False)
+
     def test_get_data_by_element(self):
         obs_id = 0
         volume_data = self.vol_file.get_data_by_element(None, None, None)
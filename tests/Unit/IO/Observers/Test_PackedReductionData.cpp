@@ -0,0 +1,44 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/IO/Observers/ObserverHelpers.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/PackedReductionData.hpp"
+#include "Parallel/Serialize.hpp"
+
+namespace observers {
+SPECTRE_TEST_CASE("Unit.IO.Observers.PackedReductionData",
+                  "[Unit][Observers]") {
+  using reduction_data = TestObservers_detail::reduction_data_from_vector;
+  const reduction_data data(1.5, size_t{4}, std::vector<double>{1., 2., 3.});
+  const PackedReductionData packed{
+      2, ObservationId{1.5, "ElementObservationType"}, "/element_data",
+      std::vector<std::string>{"Time", "NumberOfPoints", "Vec0", "Vec1",
+                               "Vec2"},
+      serialize<reduction_data>(data)};
+  CHECK(packed == packed);
+  CHECK_FALSE(packed != packed);
+  auto other_packed = packed;
+  other_packed.type_index = 1;
+  CHECK(packed != other_packed);
+  other_packed = packed;
+  other_packed.observation_id = ObservationId{2.5, "ElementObservationType"};
+  CHECK(packed != other_packed);
+  other_packed = packed;
+  other_packed.subfile_name = "/other_data";
+  CHECK(packed != other_packed);
+  test_serialization(packed);
+
+  // The reduction data survives packing and serialization of the bundle
+  const auto unpacked = deserialize<reduction_data>(
+      serialize_and_deserialize(packed).data.data());
+  CHECK(unpacked.data() == data.data());
+}
+}  // namespace observers
@@ -0,0 +1,128 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "DataStructures/Matrix.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/Observer/ReductionDataBuffer.hpp"
+#include "Utilities/FileSystem.hpp"
+
+namespace {
+void check_dat(const std::string& file_name, const std::string& subfile_name,
+               const std::vector<std::string>& expected_legend,
+               const std::vector<std::vector<double>>& expected_rows) {
+  const h5::H5File<h5::AccessType::ReadOnly> h5file(file_name);
+  const auto& dat = h5file.get<h5::Dat>(subfile_name);
+  CHECK(dat.get_legend() == expected_legend);
+  const Matrix data = dat.get_data();
+  REQUIRE(data.rows() == expected_rows.size());
+  for (size_t i = 0; i < expected_rows.size(); ++i) {
+    REQUIRE(data.columns() == expected_rows[i].size());
+    for (size_t j = 0; j < expected_rows[i].size(); ++j) {
+      CHECK(data(i, j) == expected_rows[i][j]);
+    }
+  }
+  h5file.close_current_object();
+}
+
+void test_buffering() {
+  const std::string file_name = "./Unit.IO.Observers.ReductionDataBuffer.h5";
+  const std::string other_file_name =
+      "./Unit.IO.Observers.ReductionDataBuffer1.h5";
+  for (const auto& name : {file_name, other_file_name}) {
+    if (file_system::check_if_file_exists(name)) {
+      file_system::rm(name, true);
+    }
+  }
+  const std::vector<std::string> legend{"Time", "Value"};
+  const std::vector<std::string> other_legend{"Time", "A", "B"};
+
+  observers::ReductionDataBuffer buffer{
+      4, std::numeric_limits<double>::infinity()};
+  CHECK(buffer.max_buffered_rows() == 4);
+  CHECK(buffer.flush_interval() == std::numeric_limits<double>::infinity());
+  buffer.append(file_name, "", "/Norms", legend, {0.0, 1.0});
+  buffer.append(file_name, "", "/Other", other_legend, {0.0, 2.0, 3.0});
+  buffer.append(other_file_name, "", "/Norms", legend, {0.0, 4.0});
+  CHECK(buffer.number_of_buffered_rows() == 3);
+  CHECK_FALSE(file_system::check_if_file_exists(file_name));
+  CHECK_FALSE(file_system::check_if_file_exists(other_file_name));
+
+  // The buffered rows are serialized
+  auto deserialized_buffer = serialize_and_deserialize(buffer);
+  CHECK(deserialized_buffer.number_of_buffered_rows() == 3);
+  CHECK(deserialized_buffer.max_buffered_rows() == 4);
+
+  // Reaching the maximum number of rows writes all of them
+  buffer.append(file_name, "", "/Norms", legend, {1.0, 5.0});
+  CHECK(buffer.number_of_buffered_rows() == 0);
+  check_dat(file_name, "/Norms", legend, {{0.0, 1.0}, {1.0, 5.0}});
+  check_dat(file_name, "/Other", other_legend, {{0.0, 2.0, 3.0}});
+  check_dat(other_file_name, "/Norms", legend, {{0.0, 4.0}});
+
+  // Flushing explicitly appends to the existing subfiles
+  buffer.append(file_name, "", "/Norms", legend, {2.0, 6.0});
+  CHECK(buffer.number_of_buffered_rows() == 1);
+  buffer.flush();
+  CHECK(buffer.number_of_buffered_rows() == 0);
+  check_dat(file_name, "/Norms", legend,
+            {{0.0, 1.0}, {1.0, 5.0}, {2.0, 6.0}});
+  // Flushing an empty buffer does nothing
+  buffer.flush();
+  check_dat(file_name, "/Norms", legend,
+            {{0.0, 1.0}, {1.0, 5.0}, {2.0, 6.0}});
+
+  // The default buffer writes every row immediately
+  observers::ReductionDataBuffer write_through_buffer{};
+  CHECK(write_through_buffer.max_buffered_rows() == 1);
+  write_through_buffer.append(other_file_name, "", "/Norms", legend,
+                              {1.0, 7.0});
+  CHECK(write_through_buffer.number_of_buffered_rows() == 0);
+  check_dat(other_file_name, "/Norms", legend, {{0.0, 4.0}, {1.0, 7.0}});
+
+  // A zero flush interval writes every row immediately
+  observers::ReductionDataBuffer zero_interval_buffer{100, 0.0};
+  zero_interval_buffer.append(other_file_name, "", "/Norms", legend,
+                              {2.0, 8.0});
+  CHECK(zero_interval_buffer.number_of_buffered_rows() == 0);
+  check_dat(other_file_name, "/Norms", legend,
+            {{0.0, 4.0}, {1.0, 7.0}, {2.0, 8.0}});
+
+  for (const auto& name : {file_name, other_file_name}) {
+    if (file_system::check_if_file_exists(name)) {
+      file_system::rm(name, true);
+    }
+  }
+}
+
+void test_errors() {
+  const std::string file_name =
+      "./Unit.IO.Observers.ReductionDataBufferErrors.h5";
+  observers::ReductionDataBuffer buffer{
+      10, std::numeric_limits<double>::infinity()};
+  CHECK_THROWS_WITH(
+      buffer.append(file_name, "", "/Norms", {"Time", "Value"}, {0.0}),
+      Catch::Contains("There must be one name provided for each piece of "
+                      "data. You provided 2 names"));
+  buffer.append(file_name, "", "/Norms", {"Time", "Value"}, {0.0, 1.0});
+  CHECK_THROWS_WITH(
+      buffer.append(file_name, "", "/Norms", {"Time", "Other"}, {1.0, 2.0}),
+      Catch::Contains("changed while its data was buffered"));
+  CHECK_FALSE(file_system::check_if_file_exists(file_name));
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.Observers.ReductionDataBuffer",
+                  "[Unit][Observers]") {
+  test_buffering();
+  test_errors();
+}
@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <functional>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -56,6 +57,178 @@ struct FormatErrors
 // [formatter_example]
 static_assert(tt::assert_conforms_to_v<
               FormatErrors, observers::protocols::ReductionDataFormatter>);
+
+template <typename Metavariables>
+struct coalescing_observer_writer_component
+    : helpers::observer_writer_component<Metavariables> {
+  using const_global_cache_tags =
+      tmpl::list<observers::Tags::ReductionFileName,
+                 observers::Tags::VolumeFileName,
+                 observers::Tags::CoalesceReductions>;
+};
+
+template <typename RegistrationActionsList>
+struct CoalescingMetavariables {
+  using component_list = tmpl::list<
+      helpers::element_component<CoalescingMetavariables,
+                                 RegistrationActionsList>,
+      helpers::observer_component<CoalescingMetavariables>,
+      coalescing_observer_writer_component<CoalescingMetavariables>>;
+
+  using observed_reduction_data_tags = observers::make_reduction_data_tags<
+      tmpl::list<helpers::reduction_data_from_doubles,
+                 helpers::reduction_data_from_vector,
+                 helpers::reduction_data_from_ds_and_vs>>;
+};
+
+// Reductions that complete at the same observation value are sent to node 0
+// in one message per node once a node completes a reduction at a different
+// observation value, or when the reduction data is flushed.
+void test_coalesced_reductions() {
+  using registration_list = tmpl::list<
+      observers::Actions::RegisterWithObservers<
+          helpers::RegisterObservers<observers::TypeOfObservation::Reduction>>,
+      Parallel::Actions::TerminatePhase>;
+
+  using metavariables = CoalescingMetavariables<registration_list>;
+  using obs_component = helpers::observer_component<metavariables>;
+  using obs_writer = coalescing_observer_writer_component<metavariables>;
+  using element_comp =
+      helpers::element_component<metavariables, registration_list>;
+
+  tuples::TaggedTuple<observers::Tags::ReductionFileName,
+                      observers::Tags::VolumeFileName,
+                      observers::Tags::CoalesceReductions>
+      cache_data{"./Unit.IO.Observers.CoalescedReductions", "", true};
+  const std::string h5_file_name =
+      tuples::get<observers::Tags::ReductionFileName>(cache_data) + ".h5";
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  const std::vector<size_t> num_cores_per_node{1, 2};
+  ActionTesting::MockRuntimeSystem<metavariables> runner{
+      cache_data, {}, num_cores_per_node};
+  ActionTesting::emplace_group_component<obs_component>(&runner);
+  for (size_t core_id = 0; core_id < 3; ++core_id) {
+    for (size_t i = 0; i < 2; ++i) {
+      ActionTesting::next_action<obs_component>(make_not_null(&runner),
+                                                core_id);
+    }
+  }
+  ActionTesting::emplace_nodegroup_component<obs_writer>(&runner);
+  for (size_t node_id = 0; node_id < 2; ++node_id) {
+    for (size_t i = 0; i < 2; ++i) {
+      ActionTesting::next_action<obs_writer>(make_not_null(&runner), node_id);
+    }
+  }
+  // One element on each core. The Block ID is the node and the first segment
+  // index is the local core ID on that node.
+  const std::vector<ElementId<2>> element_ids{{0, {{{1, 0}, {1, 0}}}},
+                                              {1, {{{1, 0}, {1, 0}}}},
+                                              {1, {{{1, 1}, {1, 0}}}}};
+  for (const auto& id : element_ids) {
+    ActionTesting::emplace_array_component<element_comp>(
+        &runner, ActionTesting::NodeId{id.block_id()},
+        ActionTesting::LocalCoreId{id.segment_ids()[0].index()}, id);
+  }
+  ActionTesting::set_phase(make_not_null(&runner), Parallel::Phase::Register);
+  for (const auto& id : element_ids) {
+    ActionTesting::next_action<element_comp>(make_not_null(&runner), id);
+    ActionTesting::invoke_queued_simple_action<obs_component>(
+        make_not_null(&runner), id.block_id() + id.segment_ids()[0].index());
+  }
+  for (size_t node_id = 0; node_id < 2; ++node_id) {
+    while (not ActionTesting::is_simple_action_queue_empty<obs_writer>(
+        runner, node_id)) {
+      ActionTesting::invoke_queued_simple_action<obs_writer>(
+          make_not_null(&runner), node_id);
+    }
+  }
+  while (not ActionTesting::is_simple_action_queue_empty<obs_writer>(runner,
+                                                                     0)) {
+    ActionTesting::invoke_queued_simple_action<obs_writer>(
+        make_not_null(&runner), 0);
+  }
+  ActionTesting::set_phase(make_not_null(&runner), Parallel::Phase::Testing);
+
+  const std::vector<std::string> doubles_legend{"Time", "NumberOfPoints",
+                                                "Error0", "Error1"};
+  const std::vector<std::string> vector_legend{"Time", "NumberOfPoints",
+                                               "Vec0", "Vec1", "Vec2"};
+  const auto contribute = [&runner, &element_ids](
+                              const double time, const std::string& subfile,
+                              const std::vector<std::string>& legend,
+                              auto reduction_data) {
+    for (const auto& id : element_ids) {
+      runner.simple_action<obs_component,
+                           observers::Actions::ContributeReductionData>(
+          id.block_id() + id.segment_ids()[0].index(),
+          observers::ObservationId{time, "ElementObservationType"},
+          observers::ArrayComponentId{
+              std::add_pointer_t<element_comp>{nullptr},
+              Parallel::ArrayIndex<typename element_comp::array_index>(id)},
+          subfile, legend, reduction_data,
+          std::optional<observers::NoFormatter>{std::nullopt});
+    }
+    // Collect the data on each node
+    runner.invoke_queued_threaded_action<obs_writer>(0);
+    runner.invoke_queued_threaded_action<obs_writer>(1);
+    runner.invoke_queued_threaded_action<obs_writer>(1);
+  };
+  const auto num_rows = [&h5_file_name](const std::string& subfile) {
+    if (not file_system::check_if_file_exists(h5_file_name)) {
+      return size_t{0};
+    }
+    const auto file = h5::H5File<h5::AccessType::ReadOnly>(h5_file_name);
+    return file.get<h5::Dat>(subfile).get_data().rows();
+  };
+
+  // Two reductions at the same time are held on each node
+  contribute(1.0, "/doubles", doubles_legend,
+             helpers::reduction_data_from_doubles(1.0, size_t{4}, 1.0, 2.0));
+  contribute(1.0, "/vector", vector_legend,
+             helpers::reduction_data_from_vector(
+                 1.0, size_t{4}, std::vector<double>{1.0, 2.0, 3.0}));
+  CHECK(ActionTesting::is_threaded_action_queue_empty<obs_writer>(runner, 0));
+  CHECK(ActionTesting::is_threaded_action_queue_empty<obs_writer>(runner, 1));
+
+  // A reduction at a later time sends one bundle from each node
+  contribute(2.0, "/doubles", doubles_legend,
+             helpers::reduction_data_from_doubles(2.0, size_t{4}, 1.0, 2.0));
+  CHECK(ActionTesting::number_of_queued_threaded_actions<obs_writer>(
+            runner, 0) == 2);
+  CHECK(ActionTesting::is_threaded_action_queue_empty<obs_writer>(runner, 1));
+  runner.invoke_queued_threaded_action<obs_writer>(0);
+  runner.invoke_queued_threaded_action<obs_writer>(0);
+  CHECK(num_rows("/doubles") == 1);
+  CHECK(num_rows("/vector") == 1);
+  {
+    const auto file = h5::H5File<h5::AccessType::ReadOnly>(h5_file_name);
+    const Matrix written_data = file.get<h5::Dat>("/vector").get_data();
+    CHECK(written_data(0, 0) == 1.0);
+    CHECK(written_data(0, 1) == 12.0);
+    CHECK(written_data(0, 2) == 3.0);
+    CHECK(written_data(0, 3) == 6.0);
+    CHECK(written_data(0, 4) == 9.0);
+  }
+
+  // Flushing sends the held reductions
+  for (size_t node_id = 0; node_id < 2; ++node_id) {
+    runner.threaded_action<obs_writer,
+                           observers::ThreadedActions::FlushReductionData>(
+        node_id);
+  }
+  CHECK(ActionTesting::number_of_queued_threaded_actions<obs_writer>(
+            runner, 0) == 2);
+  runner.invoke_queued_threaded_action<obs_writer>(0);
+  runner.invoke_queued_threaded_action<obs_writer>(0);
+  CHECK(ActionTesting::is_threaded_action_queue_empty<obs_writer>(runner, 0));
+  CHECK(num_rows("/doubles") == 2);
+
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
 }  // namespace
 
 void test_reduction_observer(const bool observe_per_core) {
@@ -384,4 +557,5 @@ void test_reduction_observer(const bool observe_per_core) {
 SPECTRE_TEST_CASE("Unit.IO.Observers.ReductionObserver", "[Unit][Observers]") {
   test_reduction_observer(false);
   test_reduction_observer(true);
+  test_coalesced_reductions();
 }
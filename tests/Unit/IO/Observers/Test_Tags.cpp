@@ -32,12 +32,19 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.Tags", "[Unit][Observers]") {
   TestHelpers::db::test_simple_tag<ReductionData<double>>("ReductionData");
   TestHelpers::db::test_simple_tag<ReductionDataNames<double>>(
       "ReductionDataNames");
+  TestHelpers::db::test_simple_tag<ReductionDataBuffer>("ReductionDataBuffer");
   TestHelpers::db::test_simple_tag<H5FileLock>("H5FileLock");
   TestHelpers::db::test_simple_tag<ObservationKey<TestTag>>(
       "ObservationKey(TestTag)");
   TestHelpers::db::test_simple_tag<VolumeFileName>("VolumeFileName");
   TestHelpers::db::test_simple_tag<ReductionFileName>("ReductionFileName");
   TestHelpers::db::test_simple_tag<SurfaceFileName>("SurfaceFileName");
+  TestHelpers::db::test_simple_tag<ReductionBufferSize>("ReductionBufferSize");
+  TestHelpers::db::test_simple_tag<ReductionFlushInterval>(
+      "ReductionFlushInterval");
+  TestHelpers::db::test_simple_tag<CoalesceReductions>("CoalesceReductions");
+  TestHelpers::db::test_simple_tag<PendingReductionData>(
+      "PendingReductionData");
   static_assert(
       std::is_same_v<typename ReductionData<double, int, char>::names_tag,
                      ReductionDataNames<double, int, char>>,
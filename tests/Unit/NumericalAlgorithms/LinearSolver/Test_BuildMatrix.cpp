@@ -4,12 +4,15 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <array>
+#include <cstddef>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/StaticVector.h>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
@@ -33,6 +36,70 @@ namespace {
 struct ScalarFieldTag : db::SimpleTag {
   using type = Scalar<DataVector>;
 };
+
+// Supports applying the matrix to multiple operands at once
+struct ApplyMatrixBatched {
+  blaze::DynamicMatrix<double> matrix;
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable size_t invocations = 0;
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable size_t batch_invocations = 0;
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable size_t applied_operands = 0;
+
+  void operator()(const gsl::not_null<blaze::DynamicVector<double>*> result,
+                  const blaze::DynamicVector<double>& operand,
+                  const double scale) const {
+    *result = scale * matrix * operand;
+    ++invocations;
+  }
+
+  void apply_batch(
+      const gsl::not_null<std::vector<blaze::DynamicVector<double>>*> results,
+      const std::vector<blaze::DynamicVector<double>>& operands,
+      const double scale) const {
+    REQUIRE(results->size() == operands.size());
+    for (size_t i = 0; i < operands.size(); ++i) {
+      REQUIRE((*results)[i].size() == matrix.rows());
+      (*results)[i] = scale * matrix * operands[i];
+    }
+    ++batch_invocations;
+    applied_operands += operands.size();
+  }
+};
+
+// Applies a block-diagonal matrix to element-centered subdomain data, either
+// to one operand or to a batch of operands
+template <typename SubdomainData>
+struct ApplySubdomainMatricesBatched {
+  Matrix matrix_element;
+  Matrix matrix_overlap;
+  ::LinearSolver::Schwarz::OverlapId<1> overlap_id;
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable size_t batch_invocations = 0;
+
+  void operator()(const gsl::not_null<SubdomainData*> result,
+                  const SubdomainData& operand) const {
+    const std::array<std::reference_wrapper<const Matrix>, 1>
+        matrices_element{matrix_element};
+    const std::array<std::reference_wrapper<const Matrix>, 1>
+        matrices_overlap{matrix_overlap};
+    apply_matrices(make_not_null(&result->element_data), matrices_element,
+                   operand.element_data, Index<1>{matrix_element.rows()});
+    apply_matrices(make_not_null(&result->overlap_data.at(overlap_id)),
+                   matrices_overlap, operand.overlap_data.at(overlap_id),
+                   Index<1>{matrix_overlap.rows()});
+  }
+
+  void apply_batch(const gsl::not_null<std::vector<SubdomainData>*> results,
+                   const std::vector<SubdomainData>& operands) const {
+    REQUIRE(results->size() == operands.size());
+    for (size_t i = 0; i < operands.size(); ++i) {
+      (*this)(make_not_null(&(*results)[i]), operands[i]);
+    }
+    ++batch_invocations;
+  }
+};
 }  // namespace
 
 namespace LinearSolver::Serial {
@@ -114,6 +181,122 @@ SPECTRE_TEST_CASE("Unit.LinearSolver.Serial.BuildMatrix",
                  linear_operator);
     CHECK_MATRIX_APPROX(matrix_representation, expected_matrix);
   }
+  {
+    INFO("Build matrix with a batched operator");
+    const size_t size = 2 * detail::build_matrix_batch_size + 3;
+    blaze::DynamicMatrix<double> matrix(size, size);
+    for (size_t i = 0; i < size; ++i) {
+      for (size_t j = 0; j < size; ++j) {
+        matrix(i, j) = (i + j) % 3 == 0 ? 0. : static_cast<double>(i * j) + 1.;
+      }
+    }
+    const ApplyMatrixBatched linear_operator{matrix};
+    // Build the matrix column by column for comparison
+    const auto apply_per_column =
+        [&linear_operator](
+            const gsl::not_null<blaze::DynamicVector<double>*> result,
+            const blaze::DynamicVector<double>& operand, const double scale) {
+          linear_operator(result, operand, scale);
+        };
+    blaze::DynamicVector<double> operand_buffer(size, 0.);
+    blaze::DynamicVector<double> result_buffer(size, 0.);
+    blaze::DynamicMatrix<double> per_column_matrix_representation(size, size);
+    build_matrix(make_not_null(&per_column_matrix_representation),
+                 make_not_null(&operand_buffer), make_not_null(&result_buffer),
+                 apply_per_column, std::make_tuple(2.));
+    CHECK(linear_operator.invocations == size);
+    CHECK(linear_operator.batch_invocations == 0);
+    CHECK_MATRIX_APPROX(per_column_matrix_representation, 2. * matrix);
+    linear_operator.invocations = 0;
+
+    blaze::DynamicMatrix<double> matrix_representation(size, size);
+    build_matrix(make_not_null(&matrix_representation),
+                 make_not_null(&operand_buffer), make_not_null(&result_buffer),
+                 linear_operator, std::make_tuple(2.));
+    CHECK(matrix_representation == per_column_matrix_representation);
+    CHECK(linear_operator.invocations == 0);
+    CHECK(linear_operator.batch_invocations == 3);
+    CHECK(linear_operator.applied_operands == size);
+    // The operand buffer is left untouched
+    CHECK(operand_buffer == blaze::DynamicVector<double>(size, 0.));
+
+    INFO("Build sparse matrix with a batched operator");
+    blaze::CompressedMatrix<double> per_column_sparse_matrix_representation(
+        size, size);
+    build_matrix(make_not_null(&per_column_sparse_matrix_representation),
+                 make_not_null(&operand_buffer), make_not_null(&result_buffer),
+                 apply_per_column, std::make_tuple(2.));
+    blaze::CompressedMatrix<double> sparse_matrix_representation(size, size);
+    build_matrix(make_not_null(&sparse_matrix_representation),
+                 make_not_null(&operand_buffer), make_not_null(&result_buffer),
+                 linear_operator, std::make_tuple(2.));
+    CHECK(sparse_matrix_representation ==
+          per_column_sparse_matrix_representation);
+    CHECK(sparse_matrix_representation.nonZeros() ==
+          per_column_sparse_matrix_representation.nonZeros());
+    CHECK(linear_operator.batch_invocations == 6);
+  }
+  {
+    INFO("Build matrix from a heterogeneous data structure in batches");
+    using SubdomainData = ::LinearSolver::Schwarz::ElementCenteredSubdomainData<
+        1, tmpl::list<ScalarFieldTag>>;
+    // Choose sizes so the batches straddle the boundary between the element
+    // and the overlap data
+    const size_t num_points_element = detail::build_matrix_batch_size + 3;
+    const size_t num_points_overlap = detail::build_matrix_batch_size + 2;
+    const size_t size = num_points_element + num_points_overlap;
+    Matrix matrix_element(num_points_element, num_points_element);
+    for (size_t i = 0; i < num_points_element; ++i) {
+      for (size_t j = 0; j < num_points_element; ++j) {
+        matrix_element(i, j) = static_cast<double>(i + 2 * j) + 1.;
+      }
+    }
+    Matrix matrix_overlap(num_points_overlap, num_points_overlap);
+    for (size_t i = 0; i < num_points_overlap; ++i) {
+      for (size_t j = 0; j < num_points_overlap; ++j) {
+        matrix_overlap(i, j) = static_cast<double>(3 * i + j) - 2.;
+      }
+    }
+    Matrix expected_matrix(size, size, 0.);
+    blaze::submatrix(expected_matrix, 0, 0, num_points_element,
+                     num_points_element) = matrix_element;
+    blaze::submatrix(expected_matrix, num_points_element, num_points_element,
+                     num_points_overlap, num_points_overlap) = matrix_overlap;
+    const ApplySubdomainMatricesBatched<SubdomainData> linear_operator{
+        matrix_element, matrix_overlap,
+        ::LinearSolver::Schwarz::OverlapId<1>{Direction<1>::lower_xi(),
+                                              ElementId<1>{0}}};
+    const auto apply_per_column =
+        [&linear_operator](const gsl::not_null<SubdomainData*> result,
+                           const SubdomainData& operand) {
+          linear_operator(result, operand);
+        };
+
+    SubdomainData operand_buffer{num_points_element};
+    get(get<ScalarFieldTag>(operand_buffer.element_data)) =
+        DataVector(num_points_element, 0.);
+    operand_buffer.overlap_data.emplace(
+        linear_operator.overlap_id,
+        typename SubdomainData::OverlapData{num_points_overlap});
+    get(get<ScalarFieldTag>(
+        operand_buffer.overlap_data.at(linear_operator.overlap_id))) =
+        DataVector(num_points_overlap, 0.);
+    auto result_buffer = make_with_value<SubdomainData>(operand_buffer, 0.);
+
+    blaze::DynamicMatrix<double> per_column_matrix_representation(size, size);
+    build_matrix(make_not_null(&per_column_matrix_representation),
+                 make_not_null(&operand_buffer), make_not_null(&result_buffer),
+                 apply_per_column);
+    CHECK_MATRIX_APPROX(per_column_matrix_representation, expected_matrix);
+    CHECK(linear_operator.batch_invocations == 0);
+
+    blaze::DynamicMatrix<double> matrix_representation(size, size);
+    build_matrix(make_not_null(&matrix_representation),
+                 make_not_null(&operand_buffer), make_not_null(&result_buffer),
+                 linear_operator);
+    CHECK(matrix_representation == per_column_matrix_representation);
+    CHECK(linear_operator.batch_invocations == 3);
+  }
 }
 
 }  // namespace LinearSolver::Serial
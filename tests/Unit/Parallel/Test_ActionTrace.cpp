@@ -0,0 +1,128 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Parallel/ActionTrace.hpp"
+#include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/Phase.hpp"
+
+namespace {
+struct ComponentA {};
+struct ActionA {};
+struct ActionB {};
+
+// Counts the non-overlapping occurrences of `pattern` in `text`
+size_t count(const std::string& text, const std::string& pattern) {
+  size_t result = 0;
+  for (size_t position = text.find(pattern); position != std::string::npos;
+       position = text.find(pattern, position + pattern.size())) {
+    ++result;
+  }
+  return result;
+}
+
+void test_statistics() {
+  Parallel::ActionTrace::Statistics statistics{};
+  statistics.add(2.0, false);
+  statistics.add(1.0, true);
+  CHECK(statistics.calls == 2);
+  CHECK(statistics.retries == 1);
+  CHECK(statistics.total_time == 3.0);
+  CHECK(statistics.max_time == 2.0);
+
+  Parallel::ActionTrace::Statistics other{};
+  other.add(4.0, true);
+  statistics.merge(other);
+  CHECK(statistics.calls == 3);
+  CHECK(statistics.retries == 2);
+  CHECK(statistics.total_time == 7.0);
+  CHECK(statistics.max_time == 4.0);
+}
+
+void test_record() {
+  using Parallel::AlgorithmExecution;
+  Parallel::ActionTrace::clear();
+
+  const size_t action_a =
+      Parallel::ActionTrace::action_id<ComponentA,
+                                       Parallel::Phase::Evolve, ActionA>();
+  const size_t action_b =
+      Parallel::ActionTrace::action_id<ComponentA,
+                                       Parallel::Phase::Evolve, ActionB>();
+  CHECK(action_a != action_b);
+  // The identifier is registered only once
+  CHECK(Parallel::ActionTrace::action_id<ComponentA, Parallel::Phase::Evolve,
+                                         ActionA>() == action_a);
+  const auto actions = Parallel::ActionTrace::registered_actions();
+  CHECK(actions[action_a].component == "ComponentA");
+  CHECK(actions[action_a].phase == Parallel::Phase::Evolve);
+  CHECK(actions[action_b].action == "ActionB");
+
+  const size_t element_0 =
+      Parallel::ActionTrace::register_element("ComponentA[0]");
+  const size_t element_1 =
+      Parallel::ActionTrace::register_element("ComponentA[\"1\"]");
+  CHECK(element_0 != element_1);
+  CHECK(Parallel::ActionTrace::register_element("ComponentA[0]") == element_0);
+
+  Parallel::ActionTrace::record(action_a, element_0, 1.0, 1.5,
+                                AlgorithmExecution::Continue);
+  Parallel::ActionTrace::record(action_a, element_1, 2.0, 2.25,
+                                AlgorithmExecution::Retry);
+  Parallel::ActionTrace::record(action_b, element_1, 3.0, 4.0,
+                                AlgorithmExecution::Halt);
+
+  const auto data = Parallel::ActionTrace::recorded_data();
+  REQUIRE(data.size() == 1);
+  const auto& statistics = data[0].statistics;
+  CHECK(statistics[action_a].calls == 2);
+  CHECK(statistics[action_a].retries == 1);
+  CHECK(statistics[action_a].total_time == 0.75);
+  CHECK(statistics[action_a].max_time == 0.5);
+  CHECK(statistics[action_b].calls == 1);
+  CHECK(statistics[action_b].retries == 0);
+  REQUIRE(data[0].events.size() == 3);
+  CHECK(data[0].events[1].element_id == element_1);
+  CHECK(data[0].events[1].retried);
+  CHECK(data[0].events[2].duration == 1.0);
+  CHECK(data[0].dropped_events == 0);
+
+  const std::string trace = Parallel::ActionTrace::chrome_trace(3);
+  CHECK(count(trace, "\"ph\":\"X\"") == 3);
+  CHECK(count(trace, "\"pid\":3") == 5);
+  CHECK(count(trace, "\"name\":\"ActionA\"") == 2);
+  CHECK(count(trace, "\"element\":\"ComponentA[\\\"1\\\"]\"") == 2);
+  // Times are in microseconds
+  CHECK(count(trace, "\"ts\":2000000,\"dur\":250000") == 1);
+  CHECK(count(trace, "\"action\":\"ActionA\",\"calls\":2,\"retries\":1") == 1);
+  CHECK(count(trace, "\"action\":\"ActionB\",\"calls\":1,\"retries\":0") == 1);
+  CHECK(count(trace, "\"droppedEvents\":0") == 1);
+
+  // Only the first events are kept, but all are counted
+  Parallel::ActionTrace::clear();
+  for (size_t i = 0; i < Parallel::ActionTrace::max_events_per_proc + 2; ++i) {
+    Parallel::ActionTrace::record(action_b, element_0, 0.0, 1.0,
+                                  AlgorithmExecution::Continue);
+  }
+  const auto many_data = Parallel::ActionTrace::recorded_data();
+  CHECK(many_data[0].events.size() ==
+        Parallel::ActionTrace::max_events_per_proc);
+  CHECK(many_data[0].dropped_events == 2);
+  CHECK(many_data[0].statistics[action_b].calls ==
+        Parallel::ActionTrace::max_events_per_proc + 2);
+  CHECK(many_data[0].statistics[action_a].calls == 0);
+
+  Parallel::ActionTrace::clear();
+  CHECK(Parallel::ActionTrace::recorded_data()[0].statistics.empty());
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.ActionTrace", "[Parallel][Unit]") {
+  test_statistics();
+  test_record();
+}
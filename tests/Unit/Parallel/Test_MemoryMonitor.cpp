@@ -7,6 +7,7 @@
 #include <type_traits>
 #include <unordered_map>
 
+#include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
@@ -24,6 +25,7 @@
 #include "Parallel/TypeTraits.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ContributeMemoryData.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessArray.hpp"
+#include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessDataBoxItems.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessGroups.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessSingleton.hpp"
 #include "ParallelAlgorithms/Events/MonitorMemory.hpp"
@@ -434,6 +436,71 @@ void test_process_array(const gsl::not_null<Gen*> gen) {
   check_output<array_comp<metavars>>(runner, time, num_nodes, size_per_node);
 }
 
+void test_process_data_box_items() {
+  INFO("Test ProcessDataBoxItems");
+
+  // 4 mock nodes, 3 mock cores per node
+  const size_t num_nodes = 4;
+  const size_t num_procs_per_node = 3;
+  ActionTesting::MockRuntimeSystem<metavars> runner{
+      {}, {}, std::vector<size_t>(num_nodes, num_procs_per_node)};
+
+  setup_runner(make_not_null(&runner));
+
+  auto& cache = ActionTesting::cache<mem_mon_comp<metavars>>(runner, 0);
+  auto& mem_monitor_proxy =
+      Parallel::get_parallel_component<mem_mon_comp<metavars>>(cache);
+
+  const double time = 0.5;
+  const size_t number_of_elements = 4;
+  const std::vector<std::string> item_names{"Mesh", "Jacobian"};
+  // Sizes in bytes
+  const std::vector<double> min_sizes{1.0e3, 2.0e6};
+  const std::vector<double> total_sizes{8.0e3, 1.2e7};
+  const std::vector<double> max_sizes{4.0e3, 5.0e6};
+
+  Parallel::simple_action<
+      mem_monitor::ProcessDataBoxItems<array_comp<metavars>>>(
+      mem_monitor_proxy, time, number_of_elements, item_names, min_sizes,
+      total_sizes, max_sizes);
+  CHECK(ActionTesting::number_of_queued_simple_actions<mem_mon_comp<metavars>>(
+            runner, 0) == 1);
+  ActionTesting::invoke_queued_simple_action<mem_mon_comp<metavars>>(
+      make_not_null(&runner), 0);
+
+  CHECK(ActionTesting::number_of_queued_threaded_actions<
+            obs_writer_comp<metavars>>(runner, 0) == 1);
+  ActionTesting::invoke_queued_threaded_action<obs_writer_comp<metavars>>(
+      make_not_null(&runner), 0);
+
+  auto& read_file = ActionTesting::get_databox_tag<
+      obs_writer_comp<metavars>, TestHelpers::observers::MockReductionFileTag>(
+      runner, 0);
+  const auto& dataset = read_file.get_dat(
+      mem_monitor::subfile_name<array_comp<metavars>>() + "DataBoxItems");
+  const std::vector<std::string> expected_legend{"Time",
+                                                 "Number of elements",
+                                                 "Mesh min (MB)",
+                                                 "Mesh mean (MB)",
+                                                 "Mesh max (MB)",
+                                                 "Jacobian min (MB)",
+                                                 "Jacobian mean (MB)",
+                                                 "Jacobian max (MB)"};
+  CHECK(dataset.get_legend() == expected_legend);
+
+  const Matrix data = dataset.get_data();
+  CHECK(data.rows() == 1);
+  REQUIRE(data.columns() == expected_legend.size());
+  CHECK(data(0, 0) == time);
+  CHECK(data(0, 1) == 4.0);
+  CHECK(data(0, 2) == approx(1.0e-3));
+  CHECK(data(0, 3) == approx(2.0e-3));
+  CHECK(data(0, 4) == approx(4.0e-3));
+  CHECK(data(0, 5) == approx(2.0));
+  CHECK(data(0, 6) == approx(3.0));
+  CHECK(data(0, 7) == approx(5.0));
+}
+
 void test_process_singleton() {
   INFO("Test ProcessSingleton");
 
@@ -487,7 +554,7 @@ void test_event_construction() {
         std::vector<std::string> misspelled_component{"GlabolCahce"};
 
         Events::MonitorMemory<1, TimeTag> event{
-            {misspelled_component}, Options::Context{}, metavars{}};
+            {misspelled_component}, false, Options::Context{}, metavars{}};
       }()),
       Catch::Contains(
           "Cannot monitor memory usage of unknown parallel component"));
@@ -496,7 +563,7 @@ void test_event_construction() {
       ([]() {
         std::vector<std::string> array_component{"ArrayParallelComponent"};
 
-        Events::MonitorMemory<2, TimeTag> event{{array_component},
+        Events::MonitorMemory<2, TimeTag> event{{array_component}, true,
                                                 Options::Context{},
                                                 BadArrayChareMetavariables{}};
       }()),
@@ -534,15 +601,19 @@ void test_monitor_memory_event() {
 
   // Create event
   Events::MonitorMemory<3, TimeTag> monitor_memory{
-      {components_to_monitor}, Options::Context{}, metavars{}};
+      {components_to_monitor}, true, Options::Context{}, metavars{}};
 
   const auto& element =
       ActionTesting::get_databox_tag<dg_elem_comp<event_metavars>,
                                      domain::Tags::Element<3>>(runner, 0);
+  // The DataBox items are only monitored for the DgElementArray, which isn't
+  // monitored here, so any DataBox will do
+  const auto box =
+      db::create<db::AddSimpleTags<domain::Tags::Element<3>>>(element);
 
   // Run the event. This will queue a lot of actions
   const double time = 1.4;
-  monitor_memory(time, element, cache, 0,
+  monitor_memory(time, element, box, cache, 0,
                  std::add_pointer_t<dg_elem_comp<event_metavars>>{});
 
   // Check how many simple actions are queued:
@@ -662,6 +733,7 @@ SPECTRE_TEST_CASE("Unit.Parallel.MemoryMonitor", "[Unit][Parallel]") {
   // Then test the Process(Node)Group actions (second arg true)
   test_contribute_memory_data(make_not_null(&gen), true);
   test_process_array(make_not_null(&gen));
+  test_process_data_box_items();
   test_process_singleton();
   test_event_construction();
   test_monitor_memory_event();
@@ -3,6 +3,7 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <memory>
@@ -11,6 +12,7 @@
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -29,6 +31,7 @@
 #include "Framework/TestCreation.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/ParallelAlgorithms/Events/ObserveFields.hpp"
+#include "IO/H5/ModalCompression.hpp"
 #include "IO/Observer/Actions/RegisterEvents.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/ObservationId.hpp"
@@ -98,7 +101,9 @@ void test_observe(
     const std::unique_ptr<ObserveEvent> observe,
     const std::optional<Mesh<System::volume_dim>>& interpolating_mesh,
     const bool has_analytic_solutions,
-    const std::optional<std::string>& section = std::nullopt) {
+    const std::optional<std::string>& section = std::nullopt,
+    const std::optional<h5::ModalCompression>& modal_compression =
+        std::nullopt) {
   using metavariables = Metavariables<System, false>;
   constexpr size_t volume_dim = System::volume_dim;
   using element_component = ElementComponent<metavariables>;
@@ -230,10 +235,12 @@ void test_observe(
   // gcc 6.4.0 gets confused if we try to capture tensor_data by
   // reference and fails to compile because it wants it to be
   // non-const, so we capture a pointer instead.
+  const Mesh<volume_dim> observation_mesh = interpolating_mesh.value_or(mesh);
   const auto check_component = [&num_components_observed,
                                 tensor_data = &results.in_received_tensor_data,
-                                &interpolant](const std::string& component,
-                                              const DataVector& expected) {
+                                &interpolant, &modal_compression,
+                                &observation_mesh](const std::string& component,
+                                                   const DataVector& expected) {
     CAPTURE(*tensor_data);
     CAPTURE(component);
     const DataVector interpolated_expected = interpolant.interpolate(expected);
@@ -243,9 +250,36 @@ void test_observe(
         });
     REQUIRE(it != tensor_data->end());
     CAPTURE(component);
-    if (component.substr(0, 6) == "Tensor" or
-        component.substr(0, 7) == "Tensor2" or
-        component.substr(0, 14) == "Error(Tensor2)") {
+    const bool is_float = component.substr(0, 6) == "Tensor" or
+                          component.substr(0, 7) == "Tensor2" or
+                          component.substr(0, 14) == "Error(Tensor2)";
+    if (modal_compression.has_value()) {
+      // Reconstruct the nodal data from the truncated modal coefficients and
+      // check it is within the error bound
+      REQUIRE(it->modal_extents.size() == volume_dim);
+      DataVector retained_modes{};
+      std::visit(
+          [&retained_modes](const auto& data) {
+            retained_modes.destructive_resize(data.size());
+            std::copy(data.begin(), data.end(), retained_modes.begin());
+          },
+          it->data);
+      const std::vector<size_t> extents(observation_mesh.extents().begin(),
+                                        observation_mesh.extents().end());
+      const std::vector<Spectral::Basis> bases(observation_mesh.basis().begin(),
+                                               observation_mesh.basis().end());
+      const std::vector<Spectral::Quadrature> quadratures(
+          observation_mesh.quadrature().begin(),
+          observation_mesh.quadrature().end());
+      const DataVector reconstructed = h5::nodal_data_from_truncated_modes(
+          retained_modes, it->modal_extents, extents, bases, quadratures);
+      const double max_abs_value = max(abs(interpolated_expected));
+      // Allow for the roundoff error of the transforms and of the conversion
+      // to float
+      const double roundoff = (is_float ? 1.0e-5 : 1.0e-12) * max_abs_value;
+      CHECK(max(abs(reconstructed - interpolated_expected)) <=
+            modal_compression->error_bound(max_abs_value) + roundoff);
+    } else if (is_float) {
       CHECK(std::get<std::vector<float>>(it->data) ==
             std::vector<float>{interpolated_expected.begin(),
                                interpolated_expected.end()});
@@ -302,29 +336,40 @@ void test_system(
     const std::string& mesh_creation_string,
     const std::optional<Mesh<System::volume_dim>>& interpolating_mesh = {},
     const bool has_analytic_solutions = true,
-    const std::optional<std::string>& section = std::nullopt) {
+    const std::optional<std::string>& section = std::nullopt,
+    const std::optional<h5::ModalCompression>& modal_compression =
+        std::nullopt) {
   INFO(pretty_type::get_name<System>());
   CAPTURE(has_analytic_solutions);
   CAPTURE(mesh_creation_string);
   using ArraySectionIdTag = typename System::array_section_id;
   INFO(pretty_type::get_name<ArraySectionIdTag>());
   CAPTURE(section);
+  CAPTURE(modal_compression.has_value());
   using metavariables = Metavariables<System, false>;
   test_observe<System, ArraySectionIdTag>(
       std::make_unique<typename System::ObserveEvent>(
-          System::make_test_object(interpolating_mesh)),
-      interpolating_mesh, has_analytic_solutions, section);
+          System::make_test_object(interpolating_mesh, modal_compression)),
+      interpolating_mesh, has_analytic_solutions, section, modal_compression);
   INFO("create/serialize");
   Parallel::register_factory_classes_with_charm<metavariables>();
-  const std::string creation_string =
-      System::creation_string_for_test + mesh_creation_string;
+  const std::string modal_compression_str =
+      modal_compression.has_value()
+          ? "\n  ModalCompression:\n    AbsoluteTolerance: " +
+                get_output(modal_compression->absolute_tolerance) +
+                "\n    RelativeTolerance: " +
+                get_output(modal_compression->relative_tolerance)
+          : std::string{"\n  ModalCompression: None"};
+  const std::string creation_string = System::creation_string_for_test +
+                                      mesh_creation_string +
+                                      modal_compression_str;
   const auto factory_event =
       TestHelpers::test_creation<std::unique_ptr<Event>, metavariables>(
           creation_string);
   auto serialized_event = serialize_and_deserialize(factory_event);
-  test_observe<System, ArraySectionIdTag>(std::move(serialized_event),
-                                          interpolating_mesh,
-                                          has_analytic_solutions, section);
+  test_observe<System, ArraySectionIdTag>(
+      std::move(serialized_event), interpolating_mesh, has_analytic_solutions,
+      section, modal_compression);
 }
 }  // namespace
 
@@ -452,6 +497,27 @@ SPECTRE_TEST_CASE("Unit.Evolution.dG.ObserveFields", "[Unit][Evolution]") {
                 interpolating_mesh)),
         interpolating_mesh, true);
   }
+
+  {
+    INFO("Modal compression")
+    const h5::ModalCompression modal_compression{1.0e-10, 1.0e-3};
+    const std::string interpolating_mesh_str = "  InterpolateToMesh: None";
+    INVOKE_TEST_FUNCTION(test_system,
+                         (interpolating_mesh_str, std::nullopt, true,
+                          std::nullopt, modal_compression),
+                         (ScalarSystem<dg::Events::ObserveFields>,
+                          ComplicatedSystem<dg::Events::ObserveFields>));
+    // Data on finite-difference meshes is written as nodal values
+    const std::string fd_mesh_str =
+        "  InterpolateToMesh:\n"
+        "    Extents: 8\n"
+        "    Basis: FiniteDifference\n"
+        "    Quadrature: CellCentered";
+    const Mesh<2> fd_mesh{8, Spectral::Basis::FiniteDifference,
+                          Spectral::Quadrature::CellCentered};
+    test_system<ComplicatedSystem<dg::Events::ObserveFields>>(
+        fd_mesh_str, fd_mesh, true, std::nullopt, modal_compression);
+  }
 }
 
 // [[OutputRegex, NotAVar is not an available variable.*Scalar]]
@@ -464,7 +530,8 @@ SPECTRE_TEST_CASE("Unit.Evolution.dG.ObserveFields.bad_field",
       "CoordinatesFloatingPointType: Double\n"
       "VariablesToObserve: [NotAVar]\n"
       "FloatingPointTypes: [Double]\n"
-      "InterpolateToMesh: None\n");
+      "InterpolateToMesh: None\n"
+      "ModalCompression: None\n");
 }
 
 // [[OutputRegex, Scalar specified multiple times]]
@@ -477,5 +544,6 @@ SPECTRE_TEST_CASE("Unit.Evolution.dG.ObserveFields.repeated_field",
       "CoordinatesFloatingPointType: Double\n"
       "VariablesToObserve: [Scalar, Scalar]\n"
       "FloatingPointTypes: [Double]\n"
-      "InterpolateToMesh: None\n");
+      "InterpolateToMesh: None\n"
+      "ModalCompression: None\n");
 }
@@ -0,0 +1,177 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Domain/Creators/Disk.hpp"
+#include "Domain/ElementDistribution.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/InitialElementIds.hpp"
+#include "Domain/Tags.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/ParallelComponentHelpers.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "ParallelAlgorithms/Initialization/InsertInitialElements.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+// \endcond
+
+namespace {
+// The elements inserted into the `RecordingArray`, along with the proc they
+// were placed on and the node that inserted them
+struct InsertedElement {
+  ElementId<2> id;
+  size_t proc;
+  size_t inserting_node;
+};
+std::vector<InsertedElement> inserted_elements{};
+size_t num_done_inserting = 0;
+size_t inserting_node = 0;
+
+// Mocks the proxy to an array element that is being created
+struct RecordingArrayElementProxy {
+  template <typename GlobalCacheProxy, typename InitializationItems>
+  void insert(const GlobalCacheProxy& /*global_cache*/,
+              const InitializationItems& /*initialization_items*/,
+              const size_t proc) {
+    inserted_elements.push_back({id, proc, inserting_node});
+  }
+
+  ElementId<2> id;
+};
+
+// Mocks the proxy to an array that supports dynamic insertion
+struct RecordingArrayProxy {
+  RecordingArrayElementProxy operator()(const ElementId<2>& id) { return {id}; }
+  void doneInserting() { ++num_done_inserting; }
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& /*p*/) {}
+};
+
+struct RecordingArray {
+  template <typename Component, typename Index>
+  using cproxy = RecordingArrayProxy;
+};
+}  // namespace
+
+namespace Parallel {
+template <>
+struct get_array_index<RecordingArray> {
+  template <typename ParallelComponent>
+  using f = typename ParallelComponent::array_index;
+};
+}  // namespace Parallel
+
+namespace {
+template <typename Metavariables>
+struct ElementArray {
+  using chare_type = RecordingArray;
+  using metavariables = Metavariables;
+  using array_index = ElementId<2>;
+  using const_global_cache_tags = tmpl::list<domain::Tags::Domain<2>>;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization, tmpl::list<>>>;
+};
+
+struct Metavariables {
+  static constexpr size_t volume_dim = 2;
+  // The insertion routine is invoked on every node when the elements are
+  // created in parallel
+  static constexpr bool distribute_element_creation = true;
+  using component_list = tmpl::list<ElementArray<Metavariables>>;
+};
+
+void test_insert_elements(const std::vector<size_t>& procs_per_node,
+                          const std::unordered_set<size_t>& procs_to_ignore,
+                          const bool insert_on_all_nodes) {
+  CAPTURE(procs_per_node);
+  CAPTURE(procs_to_ignore);
+  CAPTURE(insert_on_all_nodes);
+  inserted_elements.clear();
+  num_done_inserting = 0;
+  // A domain with multiple blocks, so that some nodes hold no elements of some
+  // blocks
+  const domain::creators::Disk domain_creator{0.5, 2., 1, {{3, 3}}, false};
+  const auto initial_refinement_levels =
+      domain_creator.initial_refinement_levels();
+  const tuples::TaggedTuple<domain::Tags::InitialRefinementLevels<2>>
+      initialization_items{initial_refinement_levels};
+  const size_t num_nodes = insert_on_all_nodes ? 1 : procs_per_node.size();
+  size_t first_proc_on_node = 0;
+  for (inserting_node = 0; inserting_node < num_nodes; ++inserting_node) {
+    Parallel::MutableGlobalCache<Metavariables> mutable_cache{};
+    Parallel::GlobalCache<Metavariables> cache{
+        {domain_creator.create_domain()},
+        &mutable_cache,
+        procs_per_node,
+        static_cast<int>(first_proc_on_node),
+        static_cast<int>(inserting_node)};
+    Initialization::InsertInitialElements<2, ElementArray<Metavariables>>::
+        apply(cache, initialization_items, procs_to_ignore,
+              insert_on_all_nodes);
+    first_proc_on_node += procs_per_node[inserting_node];
+  }
+  // When inserting per node, the caller finishes the insertion once all nodes
+  // are done
+  CHECK(num_done_inserting == (insert_on_all_nodes ? 1 : 0));
+
+  // Every element is inserted exactly once, on the proc that the element
+  // distribution assigns to it, and by the node that holds this proc
+  const size_t num_procs = alg::accumulate(procs_per_node, 0_st);
+  std::vector<size_t> node_of_proc{};
+  for (size_t node = 0; node < procs_per_node.size(); ++node) {
+    node_of_proc.insert(node_of_proc.end(), procs_per_node[node], node);
+  }
+  const domain::BlockZCurveProcDistribution<2> element_distribution{
+      num_procs - procs_to_ignore.size(), initial_refinement_levels,
+      procs_to_ignore};
+  std::unordered_map<ElementId<2>, size_t> num_insertions{};
+  for (const auto& inserted_element : inserted_elements) {
+    CAPTURE(inserted_element.id);
+    ++num_insertions[inserted_element.id];
+    CHECK(inserted_element.proc ==
+          element_distribution.get_proc_for_element(inserted_element.id));
+    CHECK(procs_to_ignore.count(inserted_element.proc) == 0);
+    if (not insert_on_all_nodes) {
+      CHECK(node_of_proc.at(inserted_element.proc) ==
+            inserted_element.inserting_node);
+    }
+  }
+  size_t num_elements = 0;
+  for (size_t block_id = 0; block_id < initial_refinement_levels.size();
+       ++block_id) {
+    for (const auto& element_id :
+         initial_element_ids(block_id, initial_refinement_levels[block_id])) {
+      CAPTURE(element_id);
+      CHECK(num_insertions[element_id] == 1);
+      ++num_elements;
+    }
+  }
+  CHECK(inserted_elements.size() == num_elements);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE(
+    "Unit.ParallelAlgorithms.Initialization.InsertInitialElements",
+    "[Unit][ParallelAlgorithms]") {
+  for (const bool insert_on_all_nodes : {false, true}) {
+    test_insert_elements({1}, {}, insert_on_all_nodes);
+    test_insert_elements({3, 1, 4}, {}, insert_on_all_nodes);
+    test_insert_elements({3, 1, 4}, {0, 3}, insert_on_all_nodes);
+    test_insert_elements({2, 2, 2, 2, 2, 2, 2, 2}, {0}, insert_on_all_nodes);
+  }
+}
@@ -96,7 +96,8 @@ struct initialize_elements_and_queue_simple_actions {
   }
 };
 
-template <bool HaveComputeVarsToInterpolate, bool UseTimeDependentMaps>
+template <bool HaveComputeVarsToInterpolate, bool UseTimeDependentMaps,
+          size_t NumberOfShards = 1>
 struct MockMetavariables {
   static constexpr bool use_time_dependent_maps = UseTimeDependentMaps;
   using const_global_cache_tags = tmpl::list<domain::Tags::Domain<3>>;
@@ -119,6 +120,7 @@ struct MockMetavariables {
     using post_interpolation_callback =
         intrp::callbacks::ObserveTimeSeriesOnSurface<
             tmpl::list<>, InterpolationTargetAWithComputeVarsToInterpolate>;
+    static constexpr size_t number_of_shards = NumberOfShards;
   };
   struct InterpolationTargetAWithoutComputeVarsToInterpolate
       : tt::ConformsTo<intrp::protocols::InterpolationTargetTag> {
@@ -133,6 +135,7 @@ struct MockMetavariables {
     using post_interpolation_callback =
         intrp::callbacks::ObserveTimeSeriesOnSurface<
             tmpl::list<>, InterpolationTargetAWithoutComputeVarsToInterpolate>;
+    static constexpr size_t number_of_shards = NumberOfShards;
   };
   using InterpolationTargetA =
       tmpl::conditional_t<HaveComputeVarsToInterpolate,
@@ -176,5 +179,8 @@ SPECTRE_TEST_CASE(
   run_test<MockMetavariables<true, false>>();
   run_test<MockMetavariables<false, true>>();
   run_test<MockMetavariables<true, true>>();
+  // Targets whose points are distributed over several shards
+  run_test<MockMetavariables<false, false, 3>>();
+  run_test<MockMetavariables<true, true, 3>>();
 }
 }  // namespace
@@ -89,6 +89,7 @@ SPECTRE_TEST_CASE(
       "  DivergenceTol: 1.2\n"
       "  DivergenceIter: 5\n"
       "  MaxIts: 100\n"
+      "  CoarseLMax: None\n"
       "Verbosity: Verbose\n"
       "InitialGuess:\n"
       "  Center: [0.05, 0.06, 0.07]\n"
@@ -4,6 +4,7 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <cstddef>
+#include <type_traits>
 #include <unordered_set>
 #include <vector>
 
@@ -19,14 +20,18 @@
 #include "Parallel/PhaseDependentActionList.hpp"
 #include "ParallelAlgorithms/Interpolation/Actions/InitializeInterpolationTarget.hpp"
 #include "ParallelAlgorithms/Interpolation/Actions/InterpolationTargetVarsFromElement.hpp"
+#include "ParallelAlgorithms/Interpolation/InterpolatedVars.hpp"
+#include "ParallelAlgorithms/Interpolation/InterpolationTarget.hpp"
 #include "ParallelAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
 #include "ParallelAlgorithms/Interpolation/Protocols/ComputeTargetPoints.hpp"
 #include "ParallelAlgorithms/Interpolation/Protocols/InterpolationTargetTag.hpp"
 #include "ParallelAlgorithms/Interpolation/Protocols/PostInterpolationCallback.hpp"
+#include "ParallelAlgorithms/Interpolation/Tags.hpp"
 #include "Time/Slab.hpp"
 #include "Time/Tags.hpp"
 #include "Time/Time.hpp"
 #include "Time/TimeStepId.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/MakeWithValue.hpp"
 #include "Utilities/ProtocolHelpers.hpp"
 #include "Utilities/Rational.hpp"
@@ -152,6 +157,183 @@ struct MockMetavariables {
       mock_interpolation_target<MockMetavariables, InterpolationTargetA>>;
 };
 
+struct MockShardedMetavariables {
+  struct InterpolationTargetB
+      : tt::ConformsTo<intrp::protocols::InterpolationTargetTag> {
+    using temporal_id = ::Tags::TimeStepId;
+    using vars_to_interpolate_to_target = tmpl::list<Tags::TestSolution>;
+    using compute_items_on_target = tmpl::list<Tags::SquareCompute>;
+    using compute_target_points = MockComputeTargetPoints;
+    using post_interpolation_callback = MockPostInterpolationCallback;
+    static constexpr size_t number_of_shards = 2;
+  };
+  static constexpr size_t volume_dim = 3;
+  using interpolation_target_tags = tmpl::list<InterpolationTargetB>;
+
+  using component_list = tmpl::list<mock_interpolation_target<
+      MockShardedMetavariables, InterpolationTargetB>>;
+};
+
+void test_shard_point_ranges() {
+  for (size_t number_of_points : {1_st, 7_st, 10_st, 64_st}) {
+    for (size_t number_of_shards = 1; number_of_shards <= number_of_points;
+         ++number_of_shards) {
+      size_t expected_first_point = 0;
+      for (size_t shard = 0; shard < number_of_shards; ++shard) {
+        const auto [first_point, end_point] =
+            intrp::InterpolationTarget_detail::shard_point_range(
+                number_of_points, number_of_shards, shard);
+        CHECK(first_point == expected_first_point);
+        // The shards have the same number of points, up to one.
+        CHECK(end_point - first_point >= number_of_points / number_of_shards);
+        CHECK(end_point - first_point <=
+              number_of_points / number_of_shards + 1);
+        for (size_t point = first_point; point < end_point; ++point) {
+          CHECK(intrp::InterpolationTarget_detail::shard_of_point(
+                    number_of_points, number_of_shards, point) == shard);
+        }
+        expected_first_point = end_point;
+      }
+      CHECK(expected_first_point == number_of_points);
+    }
+  }
+}
+
+void test_sharded_target() {
+  using metavars = MockShardedMetavariables;
+  using target_tag = typename metavars::InterpolationTargetB;
+  using temporal_id_type = typename target_tag::temporal_id::type;
+  using target_component = mock_interpolation_target<metavars, target_tag>;
+  using vars_type =
+      Variables<typename target_tag::vars_to_interpolate_to_target>;
+  static_assert(
+      intrp::InterpolationTarget_detail::gather_shards<target_tag>);
+  static_assert(std::is_same_v<
+                typename intrp::InterpolationTarget<metavars,
+                                                    target_tag>::chare_type,
+                Parallel::Algorithms::Array>);
+
+  Slab slab(0.0, 1.0);
+  const TimeStepId first_temporal_id(true, 0, Time(slab, Rational(13, 15)));
+  const auto domain_creator =
+      domain::creators::Shell(0.9, 4.9, 1, {{5, 5}}, false);
+
+  ActionTesting::MockRuntimeSystem<metavars> runner{
+      {domain_creator.create_domain()}};
+  for (size_t shard = 0; shard < 2; ++shard) {
+    ActionTesting::emplace_component_and_initialize<target_component>(
+        &runner, shard,
+        {std::unordered_map<temporal_id_type, std::unordered_set<size_t>>{},
+         std::unordered_map<temporal_id_type, std::unordered_set<size_t>>{},
+         std::deque<temporal_id_type>{}, std::deque<temporal_id_type>{},
+         std::deque<temporal_id_type>{},
+         std::unordered_map<temporal_id_type, vars_type>{}, vars_type{1},
+         std::unordered_map<
+             temporal_id_type,
+             intrp::Vars::GatheredShards<
+                 typename target_tag::vars_to_interpolate_to_target>>{}});
+  }
+  ActionTesting::set_phase(make_not_null(&runner), Parallel::Phase::Testing);
+
+  const auto block_logical_coords =
+      intrp::InterpolationTarget_detail::block_logical_coords<target_tag>(
+          ActionTesting::get_databox<target_component>(make_not_null(&runner),
+                                                       0),
+          tmpl::type_<metavars>{});
+  REQUIRE(block_logical_coords.size() == 10);
+
+  // Sends the data of one element to the shards that own its points, the
+  // way the element's interpolation event does.  The value at each point is
+  // the index of the point, as expected by the callback.
+  const auto send_from_element = [&runner, &block_logical_coords,
+                                   &first_temporal_id](
+                                     const std::vector<size_t>& offsets,
+                                     const std::vector<size_t>& shards) {
+    vars_type vars{offsets.size()};
+    for (size_t i = 0; i < offsets.size(); ++i) {
+      get(get<Tags::TestSolution>(vars))[i] = static_cast<double>(offsets[i]);
+    }
+    auto vars_by_shard = intrp::InterpolationTarget_detail::split_by_shard(
+        vars, offsets, 10, 2);
+    REQUIRE(vars_by_shard.size() == 2);
+    for (const size_t shard : shards) {
+      const auto [first_point, end_point] =
+          intrp::InterpolationTarget_detail::shard_point_range(10, 2, shard);
+      for (size_t i = 0; i < vars_by_shard[shard].second.size(); ++i) {
+        // The offsets are relative to the first point of the shard.
+        CHECK(get(get<Tags::TestSolution>(vars_by_shard[shard].first))[i] ==
+              static_cast<double>(vars_by_shard[shard].second[i] +
+                                  first_point));
+      }
+      ActionTesting::simple_action<
+          target_component,
+          intrp::Actions::InterpolationTargetVarsFromElement<target_tag>>(
+          make_not_null(&runner), shard,
+          std::vector<vars_type>{{vars_by_shard[shard].first}},
+          std::decay_t<decltype(block_logical_coords)>(
+              block_logical_coords.begin() +
+                  static_cast<std::ptrdiff_t>(first_point),
+              block_logical_coords.begin() +
+                  static_cast<std::ptrdiff_t>(end_point)),
+          std::vector<std::vector<size_t>>{{vars_by_shard[shard].second}},
+          first_temporal_id);
+    }
+  };
+  const auto gathered_shards = [&runner]() -> const auto& {
+    return ActionTesting::get_databox_tag<
+        target_component,
+        intrp::Tags::GatheredShards<target_tag, temporal_id_type>>(runner, 0);
+  };
+
+  send_from_element({3, 6, 2, 7}, {0, 1});
+  // Each shard holds only its own points.
+  CHECK(ActionTesting::get_databox_tag<
+            target_component,
+            intrp::Tags::InterpolatedVars<target_tag, temporal_id_type>>(
+            runner, 1)
+            .at(first_temporal_id)
+            .number_of_grid_points() == 5);
+  CHECK(
+      ActionTesting::get_databox_tag<
+          target_component,
+          intrp::Tags::IndicesOfFilledInterpPoints<temporal_id_type>>(runner, 1)
+          .at(first_temporal_id) == std::unordered_set<size_t>{1, 2});
+
+  // Completing the second shard sends its points to the first shard.
+  send_from_element({1, 8, 0, 4, 9, 5}, {1});
+  CHECK(ActionTesting::get_databox_tag<
+            target_component,
+            intrp::Tags::CompletedTemporalIds<temporal_id_type>>(runner, 1)
+            .size() == 1);
+  CHECK(ActionTesting::is_simple_action_queue_empty<target_component>(runner,
+                                                                     1));
+  REQUIRE(not ActionTesting::is_simple_action_queue_empty<target_component>(
+      runner, 0));
+  ActionTesting::invoke_queued_simple_action<target_component>(
+      make_not_null(&runner), 0);
+  CHECK(gathered_shards().at(first_temporal_id).vars.count(1) == 1);
+
+  // Completing the first shard gathers all the points and calls the callback,
+  // which checks the values at all the points.
+  send_from_element({1, 8, 0, 4, 9, 5}, {0});
+  REQUIRE(not ActionTesting::is_simple_action_queue_empty<target_component>(
+      runner, 0));
+  ActionTesting::invoke_queued_simple_action<target_component>(
+      make_not_null(&runner), 0);
+  CHECK(gathered_shards().empty());
+  CHECK(ActionTesting::get_databox_tag<
+            target_component,
+            intrp::Tags::InterpolatedVars<target_tag, temporal_id_type>>(
+            runner, 0)
+            .empty());
+  CHECK(ActionTesting::get_databox_tag<
+            target_component,
+            intrp::Tags::CompletedTemporalIds<temporal_id_type>>(runner, 0)
+            .size() == 1);
+  CHECK(
+      ActionTesting::is_simple_action_queue_empty<target_component>(runner, 0));
+}
+
 SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.TargetVarsFromElement",
                   "[Unit]") {
   domain::creators::register_derived_with_charm();
@@ -397,5 +579,8 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.TargetVarsFromElement",
   // Should be no queued simple action.
   CHECK(
       ActionTesting::is_simple_action_queue_empty<target_component>(runner, 0));
+
+  test_shard_point_ranges();
+  test_sharded_target();
 }
 }  // namespace
@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <ostream>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "Domain/Structure/ElementId.hpp"
@@ -28,6 +29,44 @@ SPECTRE_TEST_CASE("Unit.ParallelMultigrid.Hierarchy",
           std::vector<std::array<size_t, 3>>{
               {{0, 0, 1}}, {{0, 0, 0}}, {{1, 0, 0}}, {{2, 3, 4}}});
   }
+  {
+    INFO("p-coarsening");
+    CHECK(p_coarsen<1>({{{2}}, {{3}}, {{6}}, {{12}}},
+                       {{{0}}, {{0}}, {{0}}, {{0}}}, 2) ==
+          std::vector<std::array<size_t, 1>>{{{2}}, {{2}}, {{3}}, {{6}}});
+    CHECK(p_coarsen<1>({{{12}}}, {{{1}}}, 2) ==
+          std::vector<std::array<size_t, 1>>{{{12}}});
+    CHECK(p_coarsen<1>({{{4}}, {{7}}}, {{{0}}, {{0}}}, 5) ==
+          std::vector<std::array<size_t, 1>>{{{4}}, {{5}}});
+    CHECK(p_coarsen<2>({{{6, 6}}, {{9, 4}}}, {{{0, 1}}, {{0, 0}}}, 3) ==
+          std::vector<std::array<size_t, 2>>{{{3, 6}}, {{5, 3}}});
+    CHECK(p_coarsen<3>({{{6, 7, 8}}}, {{{0, 0, 2}}}, 2) ==
+          std::vector<std::array<size_t, 3>>{{{3, 4, 8}}});
+    // Alternate h- and p-coarsening until the domain is fully coarsened
+    std::vector<std::array<size_t, 2>> refinement_levels{{{1, 0}}};
+    std::vector<std::array<size_t, 2>> extents{{{8, 8}}};
+    size_t num_levels = 1;
+    while (true) {
+      auto coarse_refinement_levels = coarsen(refinement_levels);
+      auto coarse_extents = p_coarsen(extents, refinement_levels, 2);
+      if (coarse_refinement_levels == refinement_levels and
+          coarse_extents == extents) {
+        break;
+      }
+      refinement_levels = std::move(coarse_refinement_levels);
+      extents = std::move(coarse_extents);
+      ++num_levels;
+    }
+    CHECK(num_levels == 4);
+    CHECK(refinement_levels == std::vector<std::array<size_t, 2>>{{{0, 0}}});
+    CHECK(extents == std::vector<std::array<size_t, 2>>{{{2, 2}}});
+#ifdef SPECTRE_DEBUG
+    CHECK_THROWS_WITH(
+        p_coarsen<1>({{{3}}}, {{{0}}}, 1),
+        Catch::Matchers::Contains(
+            "Can't p-coarsen to fewer than 2 grid points per dimension"));
+#endif  // SPECTRE_DEBUG
+  }
   {
     INFO("Parent ID");
     const size_t block_id = 3;
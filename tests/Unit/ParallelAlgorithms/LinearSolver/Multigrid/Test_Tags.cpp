@@ -26,8 +26,13 @@ SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.LinearSolver.Multigrid.Tags",
       "ChildrenRefinementLevels");
   TestHelpers::db::test_simple_tag<Tags::ParentRefinementLevels<1>>(
       "ParentRefinementLevels");
+  TestHelpers::db::test_simple_tag<Tags::ParentExtents<1>>("ParentExtents");
   TestHelpers::db::test_simple_tag<Tags::MaxLevels<TestSolver>>(
       "MaxLevels(TestSolver)");
+  TestHelpers::db::test_simple_tag<Tags::PCoarseningMinPoints<TestSolver>>(
+      "PCoarseningMinPoints(TestSolver)");
+  TestHelpers::db::test_simple_tag<Tags::MinElementsPerProc<TestSolver>>(
+      "MinElementsPerProc(TestSolver)");
   TestHelpers::db::test_simple_tag<Tags::OutputVolumeData<TestSolver>>(
       "OutputVolumeData(TestSolver)");
   TestHelpers::db::test_simple_tag<Tags::MultigridLevel>("MultigridLevel");
@@ -0,0 +1,296 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/EosTable.hpp"
+#include "IO/H5/File.hpp"
+#include "Parallel/RegisterDerivedClassesWithCharm.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/Factory.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/Tabulated3D.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+const std::array<std::array<double, 2>, 3> table_bounds{
+    {{{1.0e-6, 1.0e-2}}, {{1.0e-2, 10.0}}, {{0.05, 0.55}}}};
+const std::array<size_t, 3> table_number_of_points{{9, 7, 5}};
+const std::array<bool, 3> table_uses_log_spacing{{true, true, false}};
+
+// The logarithms of the pressure and the specific internal energy, and the
+// sound speed squared are linear in the interpolation coordinates, so the
+// trilinear interpolation reproduces them exactly.
+template <typename DataType>
+DataType pressure(const DataType& rest_mass_density,
+                  const DataType& temperature,
+                  const DataType& electron_fraction) {
+  return rest_mass_density * temperature * exp(electron_fraction);
+}
+
+template <typename DataType>
+DataType specific_internal_energy(const DataType& /*rest_mass_density*/,
+                                  const DataType& temperature,
+                                  const DataType& electron_fraction) {
+  return 1.5 * temperature * exp(0.5 * electron_fraction);
+}
+
+template <typename DataType>
+DataType sound_speed_squared(const DataType& rest_mass_density,
+                             const DataType& temperature,
+                             const DataType& electron_fraction) {
+  return 0.1 + 0.01 * log(temperature) + 0.2 * electron_fraction +
+         0.005 * log(rest_mass_density);
+}
+
+double table_value(const size_t dimension, const size_t index) {
+  const double fraction =
+      static_cast<double>(index) /
+      static_cast<double>(gsl::at(table_number_of_points, dimension) - 1);
+  const auto& bounds = gsl::at(table_bounds, dimension);
+  if (gsl::at(table_uses_log_spacing, dimension)) {
+    return bounds[0] * pow(bounds[1] / bounds[0], fraction);
+  }
+  return bounds[0] + fraction * (bounds[1] - bounds[0]);
+}
+
+std::array<DataVector, 3> tabulated_quantities() {
+  const size_t table_size = table_number_of_points[0] *
+                            table_number_of_points[1] *
+                            table_number_of_points[2];
+  std::array<DataVector, 3> quantities{
+      {DataVector{table_size}, DataVector{table_size},
+       DataVector{table_size}}};
+  size_t point = 0;
+  // The electron fraction varies fastest
+  for (size_t i = 0; i < table_number_of_points[0]; ++i) {
+    for (size_t j = 0; j < table_number_of_points[1]; ++j) {
+      for (size_t k = 0; k < table_number_of_points[2]; ++k) {
+        const double rest_mass_density = table_value(0, i);
+        const double temperature = table_value(1, j);
+        const double electron_fraction = table_value(2, k);
+        quantities[0][point] =
+            pressure(rest_mass_density, temperature, electron_fraction);
+        quantities[1][point] = specific_internal_energy(
+            rest_mass_density, temperature, electron_fraction);
+        quantities[2][point] = sound_speed_squared(
+            rest_mass_density, temperature, electron_fraction);
+        ++point;
+      }
+    }
+  }
+  return quantities;
+}
+
+template <bool IsRelativistic, typename DataType>
+void check_interpolation(
+    const EquationsOfState::EquationOfState<IsRelativistic, 3>& eos,
+    const DataType& used_for_size) {
+  MAKE_GENERATOR(generator);
+  std::uniform_real_distribution<> log_density_distribution(
+      log(table_bounds[0][0]), log(table_bounds[0][1]));
+  std::uniform_real_distribution<> log_temperature_distribution(
+      log(table_bounds[1][0]), log(table_bounds[1][1]));
+  std::uniform_real_distribution<> electron_fraction_distribution(
+      table_bounds[2][0], table_bounds[2][1]);
+  const auto rest_mass_density = Scalar<DataType>{
+      exp(make_with_random_values<DataType>(
+          make_not_null(&generator), make_not_null(&log_density_distribution),
+          used_for_size))};
+  const auto temperature = Scalar<DataType>{
+      exp(make_with_random_values<DataType>(
+          make_not_null(&generator),
+          make_not_null(&log_temperature_distribution), used_for_size))};
+  const auto electron_fraction =
+      make_with_random_values<Scalar<DataType>>(
+          make_not_null(&generator),
+          make_not_null(&electron_fraction_distribution), used_for_size);
+
+  // The logarithms and exponentials in the interpolation lose a few digits.
+  Approx custom_approx = Approx::custom().epsilon(1.0e-12).scale(1.0);
+  const DataType expected_pressure = pressure(
+      get(rest_mass_density), get(temperature), get(electron_fraction));
+  const DataType expected_energy = specific_internal_energy(
+      get(rest_mass_density), get(temperature), get(electron_fraction));
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      get(eos.pressure_from_density_and_temperature(
+          rest_mass_density, temperature, electron_fraction)),
+      expected_pressure, custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      get(eos.specific_internal_energy_from_density_and_temperature(
+          rest_mass_density, temperature, electron_fraction)),
+      expected_energy, custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      get(eos.sound_speed_squared_from_density_and_temperature(
+          rest_mass_density, temperature, electron_fraction)),
+      DataType{sound_speed_squared(get(rest_mass_density), get(temperature),
+                                   get(electron_fraction))},
+      custom_approx);
+
+  // The inversion of the interpolated energy is exact
+  const Scalar<DataType> energy{expected_energy};
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      get(eos.temperature_from_density_and_energy(rest_mass_density, energy,
+                                                  electron_fraction)),
+      get(temperature), custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      get(eos.pressure_from_density_and_energy(rest_mass_density, energy,
+                                               electron_fraction)),
+      expected_pressure, custom_approx);
+}
+
+template <bool IsRelativistic>
+void check_bounds(
+    const EquationsOfState::EquationOfState<IsRelativistic, 3>& eos) {
+  Approx custom_approx = Approx::custom().epsilon(1.0e-12).scale(1.0);
+  CHECK(eos.rest_mass_density_lower_bound() == table_bounds[0][0]);
+  CHECK(eos.rest_mass_density_upper_bound() == table_bounds[0][1]);
+  CHECK(eos.temperature_lower_bound() == table_bounds[1][0]);
+  CHECK(eos.temperature_upper_bound() == table_bounds[1][1]);
+  CHECK(eos.electron_fraction_lower_bound() == table_bounds[2][0]);
+  CHECK(eos.electron_fraction_upper_bound() == table_bounds[2][1]);
+  CHECK(eos.specific_internal_energy_lower_bound(1.0e-4, 0.3) ==
+        custom_approx(
+            specific_internal_energy(1.0e-4, table_bounds[1][0], 0.3)));
+  CHECK(eos.specific_internal_energy_upper_bound(1.0e-4, 0.3) ==
+        custom_approx(
+            specific_internal_energy(1.0e-4, table_bounds[1][1], 0.3)));
+  // The smallest enthalpy is at the lowest temperature and electron fraction.
+  const double low_temperature = table_bounds[1][0];
+  const double low_electron_fraction = table_bounds[2][0];
+  CHECK(eos.specific_enthalpy_lower_bound() ==
+        custom_approx((IsRelativistic ? 1.0 : 0.0) +
+                      specific_internal_energy(1.0, low_temperature,
+                                               low_electron_fraction) +
+                      low_temperature * exp(low_electron_fraction)));
+
+  // Values outside the table are clamped to the table.
+  CHECK(get(eos.pressure_from_density_and_temperature(
+            Scalar<double>{1.0e-4}, Scalar<double>{100.0},
+            Scalar<double>{0.3})) ==
+        custom_approx(pressure(1.0e-4, table_bounds[1][1], 0.3)));
+  CHECK(get(eos.temperature_from_density_and_energy(
+            Scalar<double>{1.0e-4}, Scalar<double>{-1.0},
+            Scalar<double>{0.3})) == custom_approx(table_bounds[1][0]));
+}
+
+template <bool IsRelativistic>
+void check_eos(
+    const EquationsOfState::EquationOfState<IsRelativistic, 3>& eos) {
+  check_interpolation(eos, std::numeric_limits<double>::signaling_NaN());
+  check_interpolation(eos, DataVector(20));
+  check_bounds(eos);
+}
+
+template <bool IsRelativistic>
+void test_tabulated_in_memory() {
+  const auto quantities = tabulated_quantities();
+  const EquationsOfState::Tabulated3D<IsRelativistic> eos{
+      table_bounds,  table_number_of_points, table_uses_log_spacing,
+      quantities[0], quantities[1],          quantities[2]};
+  check_eos(eos);
+  check_eos(serialize_and_deserialize(eos));
+}
+
+template <bool IsRelativistic>
+void test_tabulated_from_file(const std::string& filename) {
+  const auto eos = TestHelpers::test_creation<
+      std::unique_ptr<EquationsOfState::EquationOfState<IsRelativistic, 3>>>(
+      "Tabulated3D:\n"
+      "  TableFilename: " +
+      filename +
+      "\n"
+      "  TableSubFilename: TestTable\n");
+  check_eos(*eos);
+  check_eos(*serialize_and_deserialize(eos));
+}
+
+void write_table(const std::string& filename) {
+  if (file_system::check_if_file_exists(filename)) {
+    file_system::rm(filename, true);
+  }
+  const auto quantities = tabulated_quantities();
+  h5::H5File<h5::AccessType::ReadWrite> file{filename};
+  auto& table = file.insert<h5::EosTable>(
+      "/TestTable",
+      std::vector<std::string>{"rest mass density", "temperature",
+                               "electron fraction"},
+      std::vector<std::array<double, 2>>{table_bounds.begin(),
+                                         table_bounds.end()},
+      std::vector<size_t>{table_number_of_points.begin(),
+                          table_number_of_points.end()},
+      std::vector<bool>{table_uses_log_spacing.begin(),
+                        table_uses_log_spacing.end()},
+      false);
+  table.write_quantity("pressure", quantities[0]);
+  table.write_quantity("specific internal energy", quantities[1]);
+  table.write_quantity("sound speed squared", quantities[2]);
+  file.close_current_object();
+}
+
+void test_errors() {
+  auto quantities = tabulated_quantities();
+  // The energy decreases with the temperature between the first two
+  // temperature points.
+  quantities[1][table_number_of_points[2]] = 0.5 * quantities[1][0];
+  CHECK_THROWS_WITH(
+      (EquationsOfState::Tabulated3D<true>{
+          table_bounds, table_number_of_points, table_uses_log_spacing,
+          quantities[0], quantities[1], quantities[2]}),
+      Catch::Matchers::Contains(
+          "The tabulated specific internal energy must increase with the "
+          "temperature"));
+  CHECK_THROWS_WITH(
+      (EquationsOfState::Tabulated3D<true>{
+          table_bounds, table_number_of_points, table_uses_log_spacing,
+          DataVector{3, 1.0}, quantities[1], quantities[2]}),
+      Catch::Matchers::Contains("The tabulated quantities must have"));
+  // A NaN density, as produced e.g. by a failed primitive recovery, can't be
+  // located in the table. (A negative density gives a NaN coordinate as well,
+  // but would trip floating-point exceptions in the test.)
+  const auto valid_quantities = tabulated_quantities();
+  const EquationsOfState::Tabulated3D<true> eos{
+      table_bounds,        table_number_of_points, table_uses_log_spacing,
+      valid_quantities[0], valid_quantities[1],    valid_quantities[2]};
+  CHECK_THROWS_WITH(
+      eos.pressure_from_density_and_temperature(
+          Scalar<double>{std::numeric_limits<double>::quiet_NaN()},
+          Scalar<double>{1.0}, Scalar<double>{0.3}),
+      Catch::Matchers::Contains("at a NaN table coordinate"));
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.PointwiseFunctions.EquationsOfState.Tabulated3D",
+                  "[Unit][EquationsOfState]") {
+  Parallel::register_derived_classes_with_charm<
+      EquationsOfState::EquationOfState<true, 3>>();
+  Parallel::register_derived_classes_with_charm<
+      EquationsOfState::EquationOfState<false, 3>>();
+  test_tabulated_in_memory<true>();
+  test_tabulated_in_memory<false>();
+
+  const std::string filename{"Unit.PointwiseFunctions.Tabulated3D.h5"};
+  write_table(filename);
+  test_tabulated_from_file<true>(filename);
+  test_tabulated_from_file<false>(filename);
+  if (file_system::check_if_file_exists(filename)) {
+    file_system::rm(filename, true);
+  }
+
+  test_errors();
+}
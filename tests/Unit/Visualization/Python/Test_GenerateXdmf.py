@@ -4,8 +4,11 @@
 from spectre.Visualization.GenerateXdmf import generate_xdmf
 
 import spectre.Informer as spectre_informer
+import h5py
+import numpy as np
 import unittest
 import os
+import shutil
 
 # For Py2 compatibility
 try:
@@ -79,6 +82,34 @@ class TestGenerateXdmf(unittest.TestCase):
                           stride=1,
                           coordinates='InertialCoordinates')
 
+    def test_modal_data(self):
+        # Mark a tensor component as written in truncated modal coefficients
+        data_file_prefix = os.path.join(spectre_informer.unit_test_build_path(),
+                                        'Visualization/Python',
+                                        'ModalVolTestData')
+        shutil.copy(
+            os.path.join(spectre_informer.unit_test_src_path(),
+                         'Visualization/Python', 'VolTestData0.h5'),
+            data_file_prefix + '0.h5')
+        with h5py.File(data_file_prefix + '0.h5', 'r+') as h5file:
+            for observation in h5file['element_data.vol'].values():
+                observation.create_group('modal_extents').create_dataset(
+                    'Psi', data=np.zeros(1, dtype=np.uint64))
+        output_filename = os.path.join(spectre_informer.unit_test_build_path(),
+                                       'Visualization/Python',
+                                       'Test_GenerateXdmf_modal')
+
+        with self.assertRaisesRegex(ValueError,
+                                    'truncated modal coefficients'):
+            generate_xdmf(file_prefix=data_file_prefix,
+                          output=output_filename,
+                          subfile_name="element_data",
+                          start_time=0.,
+                          stop_time=1.,
+                          stride=1,
+                          coordinates='InertialCoordinates')
+        os.remove(data_file_prefix + '0.h5')
+
 
 if __name__ == '__main__':
     unittest.main(verbosity=2)